@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <stan/math/rev.hpp>
+#include <limits>
+
+// Compares the serial Cholesky factorization and blocked adjoint with
+// the parallel tiled ones. The first argument is the matrix size, the
+// second the tile size, where 0 selects the serial algorithms. Set
+// STAN_NUM_THREADS to the number of cores to use for the tiled runs.
+
+static Eigen::MatrixXd spd_matrix(int N) {
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd A = X * X.transpose();
+  A.diagonal().array() += N;
+  return A;
+}
+
+static void set_tuning(const benchmark::State& state) {
+  auto& opts = stan::math::cholesky_tuning_opts();
+  if (state.range(1) == 0) {
+    opts.min_rows = std::numeric_limits<int>::max();
+  } else {
+    opts.tile_size = state.range(1);
+    opts.min_rows = 0;
+  }
+}
+
+static void cholesky_forward(benchmark::State& state) {
+  set_tuning(state);
+  Eigen::MatrixXd A = spd_matrix(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::cholesky_decompose(A));
+  }
+}
+
+static void cholesky_gradient(benchmark::State& state) {
+  set_tuning(state);
+  Eigen::MatrixXd A_val = spd_matrix(state.range(0));
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(A_val.rows(), A_val.cols());
+  for (auto _ : state) {
+    stan::math::var_value<Eigen::MatrixXd> A = A_val;
+    auto L = stan::math::cholesky_decompose(A);
+    stan::math::sum(stan::math::elt_multiply(W, L)).grad();
+    benchmark::DoNotOptimize(A.adj().data());
+    stan::math::recover_memory();
+  }
+}
+
+static void cholesky_args(benchmark::internal::Benchmark* b) {
+  for (int N : {500, 1000, 2000, 4000, 8000}) {
+    for (int tile_size : {0, 128, 256, 512}) {
+      b->Args({N, tile_size});
+    }
+  }
+}
+
+BENCHMARK(cholesky_forward)
+    ->Apply(cholesky_args)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(cholesky_gradient)
+    ->Apply(cholesky_args)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+#include <stan/math/rev.hpp>
+
+// Compares gradient() with a gradient_evaluator session reused across
+// calls. dot_self is cheap, so the setup of the inputs dominates.
+
+struct dot_self_functor {
+  template <typename T>
+  inline T operator()(const Eigen::Matrix<T, Eigen::Dynamic, 1>& x) const {
+    return stan::math::dot_self(x);
+  }
+};
+
+static void gradient_function(benchmark::State& state) {
+  Eigen::VectorXd x = Eigen::VectorXd::Random(state.range(0));
+  double fx;
+  Eigen::VectorXd grad;
+  for (auto _ : state) {
+    stan::math::gradient(dot_self_functor(), x, fx, grad);
+    benchmark::DoNotOptimize(grad.data());
+  }
+}
+
+static void gradient_session(benchmark::State& state) {
+  Eigen::VectorXd x = Eigen::VectorXd::Random(state.range(0));
+  double fx;
+  Eigen::VectorXd grad;
+  auto evaluator = stan::math::make_gradient_evaluator(dot_self_functor());
+  for (auto _ : state) {
+    evaluator(x, fx, grad);
+    benchmark::DoNotOptimize(grad.data());
+  }
+}
+
+BENCHMARK(gradient_function)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK(gradient_session)->RangeMultiplier(10)->Range(10, 100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <stan/math/mix.hpp>
+#include <cmath>
+
+// Compares the column-by-column hessian() with the batched hessian<K>().
+// chain_functor is cheap to evaluate, so the reverse sweeps dominate.
+// data_functor spends most of its time on doubles, which the batched
+// version evaluates K times less often.
+
+struct chain_functor {
+  template <typename T>
+  inline T operator()(const Eigen::Matrix<T, Eigen::Dynamic, 1>& x) const {
+    using std::exp;
+    T y = 0.0;
+    for (int i = 0; i + 1 < x.size(); ++i) {
+      T d = x(i + 1) - x(i);
+      y += 0.5 * d * d + exp(x(i));
+    }
+    return y;
+  }
+};
+
+struct data_functor {
+  template <typename T>
+  inline T operator()(const Eigen::Matrix<T, Eigen::Dynamic, 1>& x) const {
+    double scale = 0;
+    for (int i = 0; i < 100 * x.size(); ++i) {
+      scale += std::cos(0.001 * i);
+    }
+    T y = 0.0;
+    for (int i = 0; i < x.size(); ++i) {
+      y += scale * x(i) * x(i) * x((i + 1) % x.size());
+    }
+    return y;
+  }
+};
+
+template <typename F>
+static void hessian_columns(benchmark::State& state) {
+  Eigen::VectorXd x = Eigen::VectorXd::Random(state.range(0));
+  double fx;
+  Eigen::VectorXd grad;
+  Eigen::MatrixXd H;
+  for (auto _ : state) {
+    stan::math::hessian(F(), x, fx, grad, H);
+    benchmark::DoNotOptimize(H.data());
+    stan::math::recover_memory();
+  }
+}
+
+template <typename F, int K>
+static void hessian_batched(benchmark::State& state) {
+  Eigen::VectorXd x = Eigen::VectorXd::Random(state.range(0));
+  double fx;
+  Eigen::VectorXd grad;
+  Eigen::MatrixXd H;
+  for (auto _ : state) {
+    stan::math::hessian<K>(F(), x, fx, grad, H);
+    benchmark::DoNotOptimize(H.data());
+    stan::math::recover_memory();
+  }
+}
+
+BENCHMARK_TEMPLATE(hessian_columns, chain_functor)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_batched, chain_functor, 4)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_batched, chain_functor, 8)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_batched, chain_functor, 16)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_columns, data_functor)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_batched, data_functor, 4)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_batched, data_functor, 8)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(hessian_batched, data_functor, 16)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <stan/math/prim.hpp>
+#include <vector>
+
+// Evaluates distributions with double arguments only, as generated
+// quantities and posterior predictive checks do. The vector benchmarks
+// use a vector for every argument, the broadcast ones a vector for the
+// variate and scalars for the parameters.
+
+static void normal_vector(benchmark::State& state) {
+  Eigen::VectorXd y = Eigen::VectorXd::Random(state.range(0));
+  Eigen::VectorXd mu = Eigen::VectorXd::Random(state.range(0));
+  Eigen::VectorXd sigma = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::normal_lpdf(y, mu, sigma));
+  }
+}
+
+static void normal_broadcast(benchmark::State& state) {
+  Eigen::VectorXd y = Eigen::VectorXd::Random(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::normal_lpdf(y, 0.3, 1.7));
+  }
+}
+
+static void lognormal_vector(benchmark::State& state) {
+  Eigen::VectorXd y = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  Eigen::VectorXd mu = Eigen::VectorXd::Random(state.range(0));
+  Eigen::VectorXd sigma = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::lognormal_lpdf(y, mu, sigma));
+  }
+}
+
+static void lognormal_broadcast(benchmark::State& state) {
+  Eigen::VectorXd y = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::lognormal_lpdf(y, 0.3, 1.7));
+  }
+}
+
+static void exponential_vector(benchmark::State& state) {
+  Eigen::VectorXd y = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  Eigen::VectorXd beta = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::exponential_lpdf(y, beta));
+  }
+}
+
+static void exponential_broadcast(benchmark::State& state) {
+  Eigen::VectorXd y = Eigen::VectorXd::Random(state.range(0)).array() + 2;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::exponential_lpdf(y, 1.7));
+  }
+}
+
+static void poisson_vector(benchmark::State& state) {
+  std::vector<int> n(state.range(0));
+  for (size_t i = 0; i < n.size(); ++i) {
+    n[i] = i % 7;
+  }
+  Eigen::VectorXd lambda = Eigen::VectorXd::Random(state.range(0)).array() + 4;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::poisson_lpmf(n, lambda));
+  }
+}
+
+static void poisson_broadcast(benchmark::State& state) {
+  std::vector<int> n(state.range(0));
+  for (size_t i = 0; i < n.size(); ++i) {
+    n[i] = i % 7;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stan::math::poisson_lpmf(n, 3.2));
+  }
+}
+
+BENCHMARK(normal_vector)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(normal_broadcast)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(lognormal_vector)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(lognormal_broadcast)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(exponential_vector)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(exponential_broadcast)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(poisson_vector)->RangeMultiplier(8)->Range(8, 32768);
+BENCHMARK(poisson_broadcast)->RangeMultiplier(8)->Range(8, 32768);
+
+BENCHMARK_MAIN();
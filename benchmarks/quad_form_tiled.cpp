@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+#include <stan/math/rev.hpp>
+
+// Time and arena memory of the gradients of quad_form, quad_form_sym,
+// trace_quad_form and trace_gen_quad_form, whose products are computed
+// in cache sized tiles (for trace_gen_quad_form only once B has more
+// than 2^22 elements). The argument is the matrix size. The counter
+// arena_MB reports the size of the autodiff arena blocks in use after
+// the forward pass, arguments and result included.
+
+using stan::math::var;
+using var_matrix = stan::math::var_value<Eigen::MatrixXd>;
+
+static Eigen::MatrixXd sym_matrix(int N) {
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(N, N);
+  return X + X.transpose();
+}
+
+static double arena_megabytes() {
+  return stan::math::ChainableStack::instance_->memalloc_.bytes_allocated()
+         / 1e6;
+}
+
+static void quad_form_gradient(benchmark::State& state) {
+  const int N = state.range(0);
+  Eigen::MatrixXd A_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd B_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(N, N);
+  for (auto _ : state) {
+    var_matrix A = A_val;
+    var_matrix B = B_val;
+    var lp = stan::math::sum(
+        stan::math::elt_multiply(W, stan::math::quad_form(A, B)));
+    state.counters["arena_MB"] = arena_megabytes();
+    lp.grad();
+    benchmark::DoNotOptimize(B.adj().data());
+    stan::math::recover_memory();
+  }
+}
+
+static void quad_form_sym_gradient(benchmark::State& state) {
+  const int N = state.range(0);
+  Eigen::MatrixXd A_val = sym_matrix(N);
+  Eigen::MatrixXd B_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(N, N);
+  for (auto _ : state) {
+    var_matrix A = A_val;
+    var_matrix B = B_val;
+    var lp = stan::math::sum(
+        stan::math::elt_multiply(W, stan::math::quad_form_sym(A, B)));
+    state.counters["arena_MB"] = arena_megabytes();
+    lp.grad();
+    benchmark::DoNotOptimize(B.adj().data());
+    stan::math::recover_memory();
+  }
+}
+
+static void trace_quad_form_gradient(benchmark::State& state) {
+  const int N = state.range(0);
+  Eigen::MatrixXd A_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd B_val = Eigen::MatrixXd::Random(N, N);
+  for (auto _ : state) {
+    var_matrix A = A_val;
+    var_matrix B = B_val;
+    var lp = stan::math::trace_quad_form(A, B);
+    state.counters["arena_MB"] = arena_megabytes();
+    lp.grad();
+    benchmark::DoNotOptimize(B.adj().data());
+    stan::math::recover_memory();
+  }
+}
+
+static void trace_gen_quad_form_gradient(benchmark::State& state) {
+  const int N = state.range(0);
+  Eigen::MatrixXd D_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd A_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd B_val = Eigen::MatrixXd::Random(N, N);
+  for (auto _ : state) {
+    var_matrix D = D_val;
+    var_matrix A = A_val;
+    var_matrix B = B_val;
+    var lp = stan::math::trace_gen_quad_form(D, A, B);
+    state.counters["arena_MB"] = arena_megabytes();
+    lp.grad();
+    benchmark::DoNotOptimize(B.adj().data());
+    stan::math::recover_memory();
+  }
+}
+
+static void quad_form_args(benchmark::internal::Benchmark* b) {
+  for (int N : {250, 500, 1000, 2000}) {
+    b->Arg(N);
+  }
+}
+
+BENCHMARK(quad_form_gradient)
+    ->Apply(quad_form_args)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(quad_form_sym_gradient)
+    ->Apply(quad_form_args)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(trace_quad_form_gradient)
+    ->Apply(quad_form_args)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(trace_gen_quad_form_gradient)
+    ->Apply(quad_form_args)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
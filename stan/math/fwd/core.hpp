@@ -2,6 +2,8 @@
 #define STAN_MATH_FWD_CORE_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_n.hpp>
+#include <stan/math/fwd/core/taylor.hpp>
 #include <stan/math/fwd/core/operator_addition.hpp>
 #include <stan/math/fwd/core/operator_division.hpp>
 #include <stan/math/fwd/core/operator_equal.hpp>
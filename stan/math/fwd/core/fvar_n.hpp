@@ -0,0 +1,704 @@
+#ifndef STAN_MATH_FWD_CORE_FVAR_N_HPP
+#define STAN_MATH_FWD_CORE_FVAR_N_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <ostream>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+
+/**
+ * This template class represents scalars used in forward-mode
+ * automatic differentiation that carry `N` directional derivatives
+ * at once. It behaves like `fvar<T>`, except that the tangent is a
+ * fixed-size `Eigen` vector, so one evaluation of a function
+ * propagates `N` directions and the tangent arithmetic is vectorized.
+ *
+ * Only the core arithmetic, comparisons and the most common
+ * functions in `fwd/fun` are defined for `fvar_n`. It is an `is_fvar`
+ * type, so `scalar_type_t`, `partials_type_t` and `return_type_t`
+ * resolve for it and prim functions written against those traits
+ * accept it. The functionals
+ * `gradient<N>()` and `jacobian<N>()` use it to compute derivatives
+ * with respect to `n` inputs in `ceil(n / N)` evaluations.
+ *
+ * @tparam T type of value and tangents
+ * @tparam N number of tangents
+ */
+template <typename T, int N>
+struct fvar_n {
+  static_assert(N > 0, "fvar_n needs at least one tangent");
+
+  /**
+   * The type of the tangent vector.
+   */
+  using tangent_t = Eigen::Matrix<T, N, 1>;
+
+  /**
+   * The value of this variable.
+   */
+  T val_;
+
+  /**
+   * The tangents (directional derivatives) of this variable.
+   */
+  tangent_t d_;
+
+  /**
+   * The type of values and tangents.
+   */
+  using Scalar = T;
+
+  /**
+   * Return the value of this variable.
+   *
+   * @return value of this variable
+   */
+  T val() const { return val_; }
+
+  /**
+   * Return the tangents of this variable.
+   *
+   * @return tangents of this variable
+   */
+  const tangent_t& tangent() const { return d_; }
+
+  /**
+   * Construct a forward variable with zero value and tangents.
+   */
+  fvar_n() : val_(0), d_(tangent_t::Zero()) {}
+
+  /**
+   * Construct a forward variable with the specified value and
+   * zero tangents.
+   *
+   * @tparam V type of value (must be assignable to T)
+   * @param[in] v value
+   */
+  template <typename V, typename = std::enable_if_t<ad_promotable<V, T>::value>>
+  fvar_n(const V& v)  // NOLINT(runtime/explicit)
+      : val_(v), d_(tangent_t::Zero()) {}
+
+  /**
+   * Construct a forward variable with the specified value and
+   * tangents.
+   *
+   * @tparam V type of value (must be assignable to T)
+   * @tparam D type of tangents (an `Eigen` expression of size `N`)
+   * @param[in] v value
+   * @param[in] d tangents
+   */
+  template <typename V, typename D, require_eigen_t<D>* = nullptr>
+  fvar_n(const V& v, const D& d) : val_(v), d_(d) {}
+
+  /**
+   * Add the specified variable to this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 variable to add
+   * @return reference to this variable after addition
+   */
+  inline fvar_n& operator+=(const fvar_n& x2) {
+    val_ += x2.val_;
+    d_ += x2.d_;
+    return *this;
+  }
+
+  /**
+   * Add the specified value to this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 value to add
+   * @return reference to this variable after addition
+   */
+  inline fvar_n& operator+=(double x2) {
+    val_ += x2;
+    return *this;
+  }
+
+  /**
+   * Subtract the specified variable from this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 variable to subtract
+   * @return reference to this variable after subtraction
+   */
+  inline fvar_n& operator-=(const fvar_n& x2) {
+    val_ -= x2.val_;
+    d_ -= x2.d_;
+    return *this;
+  }
+
+  /**
+   * Subtract the specified value from this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 value to subtract
+   * @return reference to this variable after subtraction
+   */
+  inline fvar_n& operator-=(double x2) {
+    val_ -= x2;
+    return *this;
+  }
+
+  /**
+   * Multiply this variable by the the specified variable and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 variable to multiply
+   * @return reference to this variable after multiplication
+   */
+  inline fvar_n& operator*=(const fvar_n& x2) {
+    d_ = d_ * x2.val_ + val_ * x2.d_;
+    val_ *= x2.val_;
+    return *this;
+  }
+
+  /**
+   * Multiply this variable by the the specified value and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 value to multiply
+   * @return reference to this variable after multiplication
+   */
+  inline fvar_n& operator*=(double x2) {
+    val_ *= x2;
+    d_ *= x2;
+    return *this;
+  }
+
+  /**
+   * Divide this variable by the the specified variable and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 variable to divide this variable by
+   * @return reference to this variable after division
+   */
+  inline fvar_n& operator/=(const fvar_n& x2) {
+    d_ = (d_ * x2.val_ - val_ * x2.d_) / (x2.val_ * x2.val_);
+    val_ /= x2.val_;
+    return *this;
+  }
+
+  /**
+   * Divide this variable by the the specified value and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 value to divide this variable by
+   * @return reference to this variable after division
+   */
+  inline fvar_n& operator/=(double x2) {
+    val_ /= x2;
+    d_ /= x2;
+    return *this;
+  }
+
+  /**
+   * Write the value of the specified variable to the specified
+   * output stream, returning a reference to the output stream.
+   *
+   * @param[in,out] os stream for writing value
+   * @param[in] v variable whose value is written
+   * @return reference to the specified output stream
+   */
+  friend std::ostream& operator<<(std::ostream& os, const fvar_n& v) {
+    return os << v.val_;
+  }
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/**
+ * Return the sum of the specified forward mode arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return sum of arguments
+ */
+template <typename T, int N>
+inline fvar_n<T, N> operator+(const fvar_n<T, N>& x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1.val_ + x2.val_, x1.d_ + x2.d_);
+}
+
+/**
+ * Return the sum of the specified forward mode and arithmetic arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return sum of arguments
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator+(const fvar_n<T, N>& x1, U x2) {
+  return fvar_n<T, N>(x1.val_ + x2, x1.d_);
+}
+
+/**
+ * Return the sum of the specified arithmetic and forward mode arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return sum of arguments
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator+(U x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1 + x2.val_, x2.d_);
+}
+
+/**
+ * Return the difference of the specified forward mode arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int N>
+inline fvar_n<T, N> operator-(const fvar_n<T, N>& x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1.val_ - x2.val_, x1.d_ - x2.d_);
+}
+
+/**
+ * Return the difference of the specified forward mode and arithmetic
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator-(const fvar_n<T, N>& x1, U x2) {
+  return fvar_n<T, N>(x1.val_ - x2, x1.d_);
+}
+
+/**
+ * Return the difference of the specified arithmetic and forward mode
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator-(U x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1 - x2.val_, -x2.d_);
+}
+
+/**
+ * Return the product of the specified forward mode arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return product of arguments
+ */
+template <typename T, int N>
+inline fvar_n<T, N> operator*(const fvar_n<T, N>& x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1.val_ * x2.val_, x1.d_ * x2.val_ + x1.val_ * x2.d_);
+}
+
+/**
+ * Return the product of the specified forward mode and arithmetic
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return product of arguments
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator*(const fvar_n<T, N>& x1, U x2) {
+  return fvar_n<T, N>(x1.val_ * x2, x1.d_ * x2);
+}
+
+/**
+ * Return the product of the specified arithmetic and forward mode
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return product of arguments
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator*(U x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1 * x2.val_, x1 * x2.d_);
+}
+
+/**
+ * Return the quotient of the specified forward mode arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by the second
+ */
+template <typename T, int N>
+inline fvar_n<T, N> operator/(const fvar_n<T, N>& x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1.val_ / x2.val_, (x1.d_ * x2.val_ - x1.val_ * x2.d_)
+                                             / (x2.val_ * x2.val_));
+}
+
+/**
+ * Return the quotient of the specified forward mode and arithmetic
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator/(const fvar_n<T, N>& x1, U x2) {
+  return fvar_n<T, N>(x1.val_ / x2, x1.d_ / x2);
+}
+
+/**
+ * Return the quotient of the specified arithmetic and forward mode
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> operator/(U x1, const fvar_n<T, N>& x2) {
+  return fvar_n<T, N>(x1 / x2.val_, -x1 * x2.d_ / (x2.val_ * x2.val_));
+}
+
+/**
+ * Return the negation of the specified argument.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return negation of argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> operator-(const fvar_n<T, N>& x) {
+  return fvar_n<T, N>(-x.val_, -x.d_);
+}
+
+/**
+ * Returns the argument. It is included for completeness.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> operator+(const fvar_n<T, N>& x) {
+  return x;
+}
+
+/**
+ * Return true if the arguments are equal. Only the values are compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are equal
+ */
+template <typename T, int N>
+inline bool operator==(const fvar_n<T, N>& x, const fvar_n<T, N>& y) {
+  return x.val_ == y.val_;
+}
+
+/**
+ * Return true if the arguments are equal. Only the value of the forward mode
+ * argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are equal
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator==(const fvar_n<T, N>& x, U y) {
+  return x.val_ == y;
+}
+
+/**
+ * Return true if the arguments are equal. Only the value of the forward mode
+ * argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are equal
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator==(U x, const fvar_n<T, N>& y) {
+  return x == y.val_;
+}
+
+/**
+ * Return true if the arguments are not equal. Only the values are compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are not equal
+ */
+template <typename T, int N>
+inline bool operator!=(const fvar_n<T, N>& x, const fvar_n<T, N>& y) {
+  return x.val_ != y.val_;
+}
+
+/**
+ * Return true if the arguments are not equal. Only the value of the forward
+ * mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are not equal
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator!=(const fvar_n<T, N>& x, U y) {
+  return x.val_ != y;
+}
+
+/**
+ * Return true if the arguments are not equal. Only the value of the forward
+ * mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are not equal
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator!=(U x, const fvar_n<T, N>& y) {
+  return x != y.val_;
+}
+
+/**
+ * Return true if the first argument is less than the second. Only the values
+ * are compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than the second
+ */
+template <typename T, int N>
+inline bool operator<(const fvar_n<T, N>& x, const fvar_n<T, N>& y) {
+  return x.val_ < y.val_;
+}
+
+/**
+ * Return true if the first argument is less than the second. Only the value of
+ * the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<(const fvar_n<T, N>& x, U y) {
+  return x.val_ < y;
+}
+
+/**
+ * Return true if the first argument is less than the second. Only the value of
+ * the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<(U x, const fvar_n<T, N>& y) {
+  return x < y.val_;
+}
+
+/**
+ * Return true if the first argument is less than or equal to the second. Only
+ * the values are compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than or equal to the second
+ */
+template <typename T, int N>
+inline bool operator<=(const fvar_n<T, N>& x, const fvar_n<T, N>& y) {
+  return x.val_ <= y.val_;
+}
+
+/**
+ * Return true if the first argument is less than or equal to the second. Only
+ * the value of the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than or equal to the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<=(const fvar_n<T, N>& x, U y) {
+  return x.val_ <= y;
+}
+
+/**
+ * Return true if the first argument is less than or equal to the second. Only
+ * the value of the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than or equal to the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<=(U x, const fvar_n<T, N>& y) {
+  return x <= y.val_;
+}
+
+/**
+ * Return true if the first argument is greater than the second. Only the values
+ * are compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than the second
+ */
+template <typename T, int N>
+inline bool operator>(const fvar_n<T, N>& x, const fvar_n<T, N>& y) {
+  return x.val_ > y.val_;
+}
+
+/**
+ * Return true if the first argument is greater than the second. Only the value
+ * of the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>(const fvar_n<T, N>& x, U y) {
+  return x.val_ > y;
+}
+
+/**
+ * Return true if the first argument is greater than the second. Only the value
+ * of the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>(U x, const fvar_n<T, N>& y) {
+  return x > y.val_;
+}
+
+/**
+ * Return true if the first argument is greater than or equal to the second.
+ * Only the values are compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than or equal to the second
+ */
+template <typename T, int N>
+inline bool operator>=(const fvar_n<T, N>& x, const fvar_n<T, N>& y) {
+  return x.val_ >= y.val_;
+}
+
+/**
+ * Return true if the first argument is greater than or equal to the second.
+ * Only the value of the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than or equal to the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>=(const fvar_n<T, N>& x, U y) {
+  return x.val_ >= y;
+}
+
+/**
+ * Return true if the first argument is greater than or equal to the second.
+ * Only the value of the forward mode argument is compared.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than or equal to the second
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>=(U x, const fvar_n<T, N>& y) {
+  return x >= y.val_;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,802 @@
+#ifndef STAN_MATH_FWD_CORE_TAYLOR_HPP
+#define STAN_MATH_FWD_CORE_TAYLOR_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <ostream>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+
+/**
+ * This template class represents scalars used in univariate Taylor
+ * propagation. It holds the coefficients of the truncated Taylor
+ * polynomial of a quantity along one direction, `c_[k]` being its
+ * `k`-th derivative along the direction divided by `k!`.
+ *
+ * Unlike nested `fvar`s, which carry `2^D` components of which many
+ * are equal, this carries only the `D + 1` distinct coefficients, and
+ * multiplication computes each cross term once. Functions propagate
+ * the coefficients with the chain rule of Faa di Bruno, specialized
+ * for each order, so only second and third order are supported.
+ * `grad_hessian_taylor()` uses it to compute third derivatives
+ * without an autodiff tape.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the highest coefficient, 1, 2 or 3
+ */
+template <typename T, int D>
+struct taylor {
+  static_assert(D >= 1 && D <= 3, "taylor supports orders 1 to 3");
+
+  /**
+   * The Taylor coefficients of this variable.
+   */
+  T c_[D + 1];
+
+  /**
+   * The type of the coefficients.
+   */
+  using Scalar = T;
+
+  /**
+   * Return the value of this variable.
+   *
+   * @return value of this variable
+   */
+  T val() const { return c_[0]; }
+
+  /**
+   * Construct a variable with zero coefficients.
+   */
+  taylor() {
+    for (int k = 0; k <= D; ++k) {
+      c_[k] = 0;
+    }
+  }
+
+  /**
+   * Construct a constant with the specified value.
+   *
+   * @tparam V type of value (must be assignable to T)
+   * @param[in] v value
+   */
+  template <typename V, typename = std::enable_if_t<ad_promotable<V, T>::value>>
+  taylor(const V& v) {  // NOLINT(runtime/explicit)
+    c_[0] = v;
+    for (int k = 1; k <= D; ++k) {
+      c_[k] = 0;
+    }
+  }
+
+  /**
+   * Construct a variable with the specified value and first
+   * coefficient, which is its derivative along the direction. Higher
+   * coefficients are zero, as for an independent variable.
+   *
+   * @tparam V type of value (must be assignable to T)
+   * @tparam W type of derivative (must be assignable to T)
+   * @param[in] v value
+   * @param[in] w derivative along the direction
+   */
+  template <typename V, typename W,
+            typename = std::enable_if_t<ad_promotable<V, T>::value
+                                        && ad_promotable<W, T>::value>>
+  taylor(const V& v, const W& w) {
+    c_[0] = v;
+    c_[1] = w;
+    for (int k = 2; k <= D; ++k) {
+      c_[k] = 0;
+    }
+  }
+
+  /**
+   * Add the specified variable to this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 variable to add
+   * @return reference to this variable after addition
+   */
+  inline taylor& operator+=(const taylor& x2) {
+    for (int k = 0; k <= D; ++k) {
+      c_[k] += x2.c_[k];
+    }
+    return *this;
+  }
+
+  /**
+   * Add the specified value to this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 value to add
+   * @return reference to this variable after addition
+   */
+  inline taylor& operator+=(double x2) {
+    c_[0] += x2;
+    return *this;
+  }
+
+  /**
+   * Subtract the specified variable from this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 variable to subtract
+   * @return reference to this variable after subtraction
+   */
+  inline taylor& operator-=(const taylor& x2) {
+    for (int k = 0; k <= D; ++k) {
+      c_[k] -= x2.c_[k];
+    }
+    return *this;
+  }
+
+  /**
+   * Subtract the specified value from this variable and return a
+   * reference to this variable.
+   *
+   * @param[in] x2 value to subtract
+   * @return reference to this variable after subtraction
+   */
+  inline taylor& operator-=(double x2) {
+    c_[0] -= x2;
+    return *this;
+  }
+
+  /**
+   * Multiply this variable by the the specified variable and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 variable to multiply
+   * @return reference to this variable after multiplication
+   */
+  inline taylor& operator*=(const taylor& x2) {
+    // from the highest coefficient down, so lower ones are still unchanged
+    for (int k = D; k >= 0; --k) {
+      T sum = c_[k] * x2.c_[0];
+      for (int j = 0; j < k; ++j) {
+        sum += c_[j] * x2.c_[k - j];
+      }
+      c_[k] = sum;
+    }
+    return *this;
+  }
+
+  /**
+   * Multiply this variable by the the specified value and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 value to multiply
+   * @return reference to this variable after multiplication
+   */
+  inline taylor& operator*=(double x2) {
+    for (int k = 0; k <= D; ++k) {
+      c_[k] *= x2;
+    }
+    return *this;
+  }
+
+  /**
+   * Divide this variable by the the specified variable and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 variable to divide this variable by
+   * @return reference to this variable after division
+   */
+  inline taylor& operator/=(const taylor& x2) {
+    const taylor b(x2);
+    for (int k = 0; k <= D; ++k) {
+      for (int j = 1; j <= k; ++j) {
+        c_[k] -= b.c_[j] * c_[k - j];
+      }
+      c_[k] /= b.c_[0];
+    }
+    return *this;
+  }
+
+  /**
+   * Divide this variable by the the specified value and
+   * return a reference to this variable.
+   *
+   * @param[in] x2 value to divide this variable by
+   * @return reference to this variable after division
+   */
+  inline taylor& operator/=(double x2) {
+    for (int k = 0; k <= D; ++k) {
+      c_[k] /= x2;
+    }
+    return *this;
+  }
+
+  /**
+   * Write the value of the specified variable to the specified
+   * output stream, returning a reference to the output stream.
+   *
+   * @param[in,out] os stream for writing value
+   * @param[in] v variable whose value is written
+   * @return reference to the specified output stream
+   */
+  friend std::ostream& operator<<(std::ostream& os, const taylor& v) {
+    return os << v.c_[0];
+  }
+};
+
+namespace internal {
+
+/**
+ * Applies the chain rule of Faa di Bruno to Taylor coefficients, one
+ * specialization per order.
+ *
+ * @tparam D order of the Taylor coefficients
+ */
+template <int D>
+struct taylor_chain;
+
+template <>
+struct taylor_chain<1> {
+  template <typename T>
+  static inline void apply(const T* x, const T* f, T* y) {
+    y[0] = f[0];
+    y[1] = f[1] * x[1];
+  }
+};
+
+template <>
+struct taylor_chain<2> {
+  template <typename T>
+  static inline void apply(const T* x, const T* f, T* y) {
+    y[0] = f[0];
+    y[1] = f[1] * x[1];
+    y[2] = f[1] * x[2] + 0.5 * f[2] * x[1] * x[1];
+  }
+};
+
+template <>
+struct taylor_chain<3> {
+  template <typename T>
+  static inline void apply(const T* x, const T* f, T* y) {
+    const T x1_sq = x[1] * x[1];
+    y[0] = f[0];
+    y[1] = f[1] * x[1];
+    y[2] = f[1] * x[2] + 0.5 * f[2] * x1_sq;
+    y[3] = f[1] * x[3] + f[2] * x[1] * x[2] + f[3] * x1_sq * x[1] / 6.0;
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Return the Taylor coefficients of a univariate function applied to
+ * the specified argument, given the derivatives of the function at
+ * the value of the argument.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @param f values of the function and its first `D` derivatives at
+ * the value of the argument; entries past `D` are not read
+ * @return Taylor coefficients of the function applied to the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> taylor_chain(const taylor<T, D>& x, const T (&f)[4]) {
+  taylor<T, D> y;
+  internal::taylor_chain<D>::apply(x.c_, f, y.c_);
+  return y;
+}
+
+/**
+ * Return the sum of the specified arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return sum of arguments
+ */
+template <typename T, int D>
+inline taylor<T, D> operator+(const taylor<T, D>& x1, const taylor<T, D>& x2) {
+  taylor<T, D> y(x1);
+  y += x2;
+  return y;
+}
+
+/**
+ * Return the sum of the specified Taylor and arithmetic arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return sum of arguments
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator+(const taylor<T, D>& x1, U x2) {
+  taylor<T, D> y(x1);
+  y += x2;
+  return y;
+}
+
+/**
+ * Return the sum of the specified arithmetic and Taylor arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return sum of arguments
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator+(U x1, const taylor<T, D>& x2) {
+  taylor<T, D> y(x2);
+  y += x1;
+  return y;
+}
+
+/**
+ * Return the difference of the specified arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int D>
+inline taylor<T, D> operator-(const taylor<T, D>& x1, const taylor<T, D>& x2) {
+  taylor<T, D> y(x1);
+  y -= x2;
+  return y;
+}
+
+/**
+ * Return the difference of the specified Taylor and arithmetic arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator-(const taylor<T, D>& x1, U x2) {
+  taylor<T, D> y(x1);
+  y -= x2;
+  return y;
+}
+
+/**
+ * Return the difference of the specified arithmetic and Taylor arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator-(U x1, const taylor<T, D>& x2) {
+  taylor<T, D> y = -x2;
+  y += x1;
+  return y;
+}
+
+/**
+ * Return the product of the specified arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return product of arguments
+ */
+template <typename T, int D>
+inline taylor<T, D> operator*(const taylor<T, D>& x1, const taylor<T, D>& x2) {
+  taylor<T, D> y;
+  for (int k = 0; k <= D; ++k) {
+    for (int j = 0; j <= k; ++j) {
+      y.c_[k] += x1.c_[j] * x2.c_[k - j];
+    }
+  }
+  return y;
+}
+
+/**
+ * Return the product of the specified Taylor and arithmetic arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return product of arguments
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator*(const taylor<T, D>& x1, U x2) {
+  taylor<T, D> y(x1);
+  y *= x2;
+  return y;
+}
+
+/**
+ * Return the product of the specified arithmetic and Taylor arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return product of arguments
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator*(U x1, const taylor<T, D>& x2) {
+  taylor<T, D> y(x2);
+  y *= x1;
+  return y;
+}
+
+/**
+ * Return the quotient of the specified arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by the second
+ */
+template <typename T, int D>
+inline taylor<T, D> operator/(const taylor<T, D>& x1, const taylor<T, D>& x2) {
+  taylor<T, D> y(x1);
+  y /= x2;
+  return y;
+}
+
+/**
+ * Return the quotient of the specified Taylor and arithmetic arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator/(const taylor<T, D>& x1, U x2) {
+  taylor<T, D> y(x1);
+  y /= x2;
+  return y;
+}
+
+/**
+ * Return the quotient of the specified arithmetic and Taylor arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> operator/(U x1, const taylor<T, D>& x2) {
+  taylor<T, D> y(x1);
+  y /= x2;
+  return y;
+}
+
+/**
+ * Return the negation of the specified argument.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return negation of argument
+ */
+template <typename T, int D>
+inline taylor<T, D> operator-(const taylor<T, D>& x) {
+  taylor<T, D> y;
+  for (int k = 0; k <= D; ++k) {
+    y.c_[k] = -x.c_[k];
+  }
+  return y;
+}
+
+/**
+ * Returns the argument. It is included for completeness.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> operator+(const taylor<T, D>& x) {
+  return x;
+}
+
+/**
+ * Return true if the arguments are equal. Only the values are compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are equal
+ */
+template <typename T, int D>
+inline bool operator==(const taylor<T, D>& x, const taylor<T, D>& y) {
+  return x.c_[0] == y.c_[0];
+}
+
+/**
+ * Return true if the arguments are equal. Only the value of the Taylor
+ * argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are equal
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator==(const taylor<T, D>& x, U y) {
+  return x.c_[0] == y;
+}
+
+/**
+ * Return true if the arguments are equal. Only the value of the Taylor
+ * argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are equal
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator==(U x, const taylor<T, D>& y) {
+  return x == y.c_[0];
+}
+
+/**
+ * Return true if the arguments are not equal. Only the values are compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are not equal
+ */
+template <typename T, int D>
+inline bool operator!=(const taylor<T, D>& x, const taylor<T, D>& y) {
+  return x.c_[0] != y.c_[0];
+}
+
+/**
+ * Return true if the arguments are not equal. Only the value of the Taylor
+ * argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are not equal
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator!=(const taylor<T, D>& x, U y) {
+  return x.c_[0] != y;
+}
+
+/**
+ * Return true if the arguments are not equal. Only the value of the Taylor
+ * argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the arguments are not equal
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator!=(U x, const taylor<T, D>& y) {
+  return x != y.c_[0];
+}
+
+/**
+ * Return true if the first argument is less than the second. Only the values
+ * are compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than the second
+ */
+template <typename T, int D>
+inline bool operator<(const taylor<T, D>& x, const taylor<T, D>& y) {
+  return x.c_[0] < y.c_[0];
+}
+
+/**
+ * Return true if the first argument is less than the second. Only the value of
+ * the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<(const taylor<T, D>& x, U y) {
+  return x.c_[0] < y;
+}
+
+/**
+ * Return true if the first argument is less than the second. Only the value of
+ * the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<(U x, const taylor<T, D>& y) {
+  return x < y.c_[0];
+}
+
+/**
+ * Return true if the first argument is less than or equal to the second. Only
+ * the values are compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than or equal to the second
+ */
+template <typename T, int D>
+inline bool operator<=(const taylor<T, D>& x, const taylor<T, D>& y) {
+  return x.c_[0] <= y.c_[0];
+}
+
+/**
+ * Return true if the first argument is less than or equal to the second. Only
+ * the value of the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than or equal to the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<=(const taylor<T, D>& x, U y) {
+  return x.c_[0] <= y;
+}
+
+/**
+ * Return true if the first argument is less than or equal to the second. Only
+ * the value of the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is less than or equal to the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator<=(U x, const taylor<T, D>& y) {
+  return x <= y.c_[0];
+}
+
+/**
+ * Return true if the first argument is greater than the second. Only the
+ * values are compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than the second
+ */
+template <typename T, int D>
+inline bool operator>(const taylor<T, D>& x, const taylor<T, D>& y) {
+  return x.c_[0] > y.c_[0];
+}
+
+/**
+ * Return true if the first argument is greater than the second. Only the value
+ * of the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>(const taylor<T, D>& x, U y) {
+  return x.c_[0] > y;
+}
+
+/**
+ * Return true if the first argument is greater than the second. Only the value
+ * of the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>(U x, const taylor<T, D>& y) {
+  return x > y.c_[0];
+}
+
+/**
+ * Return true if the first argument is greater than or equal to the second.
+ * Only the values are compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than or equal to the second
+ */
+template <typename T, int D>
+inline bool operator>=(const taylor<T, D>& x, const taylor<T, D>& y) {
+  return x.c_[0] >= y.c_[0];
+}
+
+/**
+ * Return true if the first argument is greater than or equal to the second.
+ * Only the value of the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than or equal to the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>=(const taylor<T, D>& x, U y) {
+  return x.c_[0] >= y;
+}
+
+/**
+ * Return true if the first argument is greater than or equal to the second.
+ * Only the value of the Taylor argument is compared.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U type of arithmetic argument
+ * @param x first argument
+ * @param y second argument
+ * @return true if the first argument is greater than or equal to the second
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline bool operator>=(U x, const taylor<T, D>& y) {
+  return x >= y.c_[0];
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -216,6 +216,137 @@ struct ScalarBinaryOpTraits<std::complex<stan::math::fvar<T>>,
   using ReturnType = std::complex<stan::math::fvar<T>>;
 };
 
+/**
+ * Numerical traits template override for Eigen for forward mode
+ * variables with several tangents.
+ */
+template <typename T, int N>
+struct NumTraits<stan::math::fvar_n<T, N>>
+    : GenericNumTraits<stan::math::fvar_n<T, N>> {
+  enum {
+    /**
+     * stan::math::fvar_n requires initialization
+     */
+    RequireInitialization = 1,
+
+    /**
+     * N + 1 times the cost to copy a double
+     */
+    ReadCost = (N + 1) * NumTraits<double>::ReadCost,
+
+    /**
+     * (N + 1) * AddCost
+     */
+    AddCost = (N + 1) * NumTraits<T>::AddCost,
+
+    /**
+     * (2N + 1) * MulCost + N * AddCost
+     */
+    MulCost = (2 * N + 1) * NumTraits<T>::MulCost + N * NumTraits<T>::AddCost
+  };
+
+  /**
+   * Return the number of decimal digits that can be represented
+   * without change.  Delegates to
+   * <code>std::numeric_limits<double>::digits10()</code>.
+   */
+  static int digits10() { return std::numeric_limits<double>::digits10; }
+};
+
+/**
+ * Traits specialization for Eigen binary operations for forward mode
+ * variables with several tangents and `double` arguments.
+ *
+ * @tparam T value and tangent type of autodiff variable
+ * @tparam N number of tangents
+ * @tparam BinaryOp type of binary operation for which traits are
+ * defined
+ */
+template <typename T, int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<stan::math::fvar_n<T, N>, double, BinaryOp> {
+  using ReturnType = stan::math::fvar_n<T, N>;
+};
+
+/**
+ * Traits specialization for Eigen binary operations for `double` and
+ * forward mode variables with several tangents.
+ *
+ * @tparam T value and tangent type of autodiff variable
+ * @tparam N number of tangents
+ * @tparam BinaryOp type of binary operation for which traits are
+ * defined
+ */
+template <typename T, int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, stan::math::fvar_n<T, N>, BinaryOp> {
+  using ReturnType = stan::math::fvar_n<T, N>;
+};
+
+/**
+ * Numerical traits template override for Eigen for truncated Taylor
+ * polynomials.
+ */
+template <typename T, int D>
+struct NumTraits<stan::math::taylor<T, D>>
+    : GenericNumTraits<stan::math::taylor<T, D>> {
+  enum {
+    /**
+     * stan::math::taylor requires initialization
+     */
+    RequireInitialization = 1,
+
+    /**
+     * D + 1 times the cost to copy a double
+     */
+    ReadCost = (D + 1) * NumTraits<double>::ReadCost,
+
+    /**
+     * (D + 1) * AddCost
+     */
+    AddCost = (D + 1) * NumTraits<T>::AddCost,
+
+    /**
+     * (D + 1)(D + 2) / 2 times MulCost and D(D + 1) / 2 times AddCost
+     */
+    MulCost = (D + 1) * (D + 2) / 2 * NumTraits<T>::MulCost
+              + D * (D + 1) / 2 * NumTraits<T>::AddCost
+  };
+
+  /**
+   * Return the number of decimal digits that can be represented
+   * without change.  Delegates to
+   * <code>std::numeric_limits<double>::digits10()</code>.
+   */
+  static int digits10() { return std::numeric_limits<double>::digits10; }
+};
+
+/**
+ * Traits specialization for Eigen binary operations for truncated
+ * Taylor polynomials and `double` arguments.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam BinaryOp type of binary operation for which traits are
+ * defined
+ */
+template <typename T, int D, typename BinaryOp>
+struct ScalarBinaryOpTraits<stan::math::taylor<T, D>, double, BinaryOp> {
+  using ReturnType = stan::math::taylor<T, D>;
+};
+
+/**
+ * Traits specialization for Eigen binary operations for `double` and
+ * truncated Taylor polynomials.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam BinaryOp type of binary operation for which traits are
+ * defined
+ */
+template <typename T, int D, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, stan::math::taylor<T, D>, BinaryOp> {
+  using ReturnType = stan::math::taylor<T, D>;
+};
+
 namespace internal {
 
 /**
@@ -29,6 +29,39 @@ inline std::complex<fvar<T>> cos(const std::complex<fvar<T>>& z) {
   return internal::complex_cos(z);
 }
 
+/**
+ * Return the cosine of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return cosine of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> cos(const fvar_n<T, N>& x) {
+  using std::cos;
+  using std::sin;
+  return fvar_n<T, N>(cos(x.val_), x.d_ * -sin(x.val_));
+}
+
+/**
+ * Return the cosine of the argument, propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return cosine of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> cos(const taylor<T, D>& x) {
+  using std::cos;
+  using std::sin;
+  const T s = sin(x.c_[0]);
+  const T c = cos(x.c_[0]);
+  const T f[4] = {c, -s, -c, s};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -27,6 +27,39 @@ inline std::complex<fvar<T>> exp(const std::complex<fvar<T>>& z) {
   return internal::complex_exp(z);
 }
 
+/**
+ * Return the natural exponentiation (base e) of the argument, propagating all
+ * tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return natural exponentiation (base e) of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> exp(const fvar_n<T, N>& x) {
+  using std::exp;
+  T u = exp(x.val_);
+  return fvar_n<T, N>(u, x.d_ * u);
+}
+
+/**
+ * Return the natural exponentiation (base e) of the argument, propagating the
+ * Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return natural exponentiation (base e) of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> exp(const taylor<T, D>& x) {
+  using std::exp;
+  const T u = exp(x.c_[0]);
+  const T f[4] = {u, u, u, u};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
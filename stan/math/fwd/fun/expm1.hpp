@@ -15,6 +15,38 @@ inline fvar<T> expm1(const fvar<T>& x) {
   return fvar<T>(expm1(x.val_), x.d_ * exp(x.val_));
 }
 
+/**
+ * Return the natural exponentiation of the argument minus one, propagating all
+ * tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return natural exponentiation of the argument minus one
+ */
+template <typename T, int N>
+inline fvar_n<T, N> expm1(const fvar_n<T, N>& x) {
+  using std::exp;
+  return fvar_n<T, N>(expm1(x.val_), x.d_ * exp(x.val_));
+}
+
+/**
+ * Return the natural exponentiation of the argument minus one, propagating the
+ * Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return natural exponentiation of the argument minus one
+ */
+template <typename T, int D>
+inline taylor<T, D> expm1(const taylor<T, D>& x) {
+  using std::exp;
+  const T u = exp(x.c_[0]);
+  const T f[4] = {expm1(x.c_[0]), u, u, u};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -26,6 +26,56 @@ inline fvar<T> fabs(const fvar<T>& x) {
   }
 }
 
+/**
+ * Return the absolute value of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return absolute value of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> fabs(const fvar_n<T, N>& x) {
+  using std::fabs;
+  if (unlikely(is_nan(value_of(x.val_)))) {
+    using tangent_t = typename fvar_n<T, N>::tangent_t;
+    return fvar_n<T, N>(fabs(x.val_), tangent_t::Constant(NOT_A_NUMBER));
+  } else if (x.val_ > 0.0) {
+    return x;
+  } else if (x.val_ < 0.0) {
+    return -x;
+  } else {
+    return fvar_n<T, N>(0);
+  }
+}
+
+/**
+ * Return the absolute value of the argument, propagating the Taylor
+ * coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return absolute value of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> fabs(const taylor<T, D>& x) {
+  using std::fabs;
+  if (unlikely(is_nan(value_of(x.c_[0])))) {
+    taylor<T, D> y;
+    for (int k = 0; k <= D; ++k) {
+      y.c_[k] = NOT_A_NUMBER;
+    }
+    return y;
+  } else if (x.c_[0] > 0.0) {
+    return x;
+  } else if (x.c_[0] < 0.0) {
+    return -x;
+  } else {
+    return taylor<T, D>(0);
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
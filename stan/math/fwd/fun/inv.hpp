@@ -12,6 +12,36 @@ template <typename T>
 inline fvar<T> inv(const fvar<T>& x) {
   return fvar<T>(1 / x.val_, -x.d_ / square(x.val_));
 }
+
+/**
+ * Return the inverse of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return inverse of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> inv(const fvar_n<T, N>& x) {
+  return fvar_n<T, N>(1 / x.val_, x.d_ * (-1 / square(x.val_)));
+}
+
+/**
+ * Return the inverse of the argument, propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return inverse of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> inv(const taylor<T, D>& x) {
+  const T u = 1 / x.c_[0];
+  const T u_sq = u * u;
+  const T f[4] = {u, -u_sq, 2 * u_sq * u, -6 * u_sq * u_sq};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -24,6 +24,38 @@ inline fvar<T> inv_logit(const fvar<T>& x) {
                  x.d_ * inv_logit(x.val_) * (1 - inv_logit(x.val_)));
 }
 
+/**
+ * Return the inverse logit function applied to the argument, propagating all
+ * tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return inverse logit function applied to the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> inv_logit(const fvar_n<T, N>& x) {
+  T u = inv_logit(x.val_);
+  return fvar_n<T, N>(u, x.d_ * (u * (1 - u)));
+}
+
+/**
+ * Return the inverse logit of the argument, propagating the Taylor
+ * coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return inverse logit of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> inv_logit(const taylor<T, D>& x) {
+  const T s = inv_logit(x.c_[0]);
+  const T f1 = s * (1 - s);
+  const T f[4] = {s, f1, f1 * (1 - 2 * s), f1 * (1 - 6 * s * (1 - s))};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
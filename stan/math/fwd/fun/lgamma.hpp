@@ -3,8 +3,11 @@
 
 #include <stan/math/fwd/meta.hpp>
 #include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/fun/boost_policy.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/trigamma.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
 
 namespace stan {
 namespace math {
@@ -22,6 +25,26 @@ inline fvar<T> lgamma(const fvar<T>& x) {
   return fvar<T>(lgamma(x.val_), x.d_ * digamma(x.val_));
 }
 
+/**
+ * Return the natural logarithm of the gamma function applied to the
+ * specified argument, propagating the Taylor coefficients.
+ *
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return natural logarithm of the gamma function of argument
+ */
+template <int D>
+inline taylor<double, D> lgamma(const taylor<double, D>& x) {
+  double f[4] = {lgamma(x.c_[0]), digamma(x.c_[0]), 0, 0};
+  if (D >= 2) {
+    f[2] = trigamma(x.c_[0]);
+  }
+  if (D >= 3) {
+    f[3] = boost::math::polygamma(2, x.c_[0], boost_policy_t<>());
+  }
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
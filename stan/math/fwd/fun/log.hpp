@@ -33,6 +33,43 @@ inline std::complex<fvar<T>> log(const std::complex<fvar<T>>& z) {
   return internal::complex_log(z);
 }
 
+/**
+ * Return the natural logarithm (base e) of the argument, propagating all
+ * tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return natural logarithm (base e) of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> log(const fvar_n<T, N>& x) {
+  using std::log;
+  if (x.val_ < 0.0) {
+    using tangent_t = typename fvar_n<T, N>::tangent_t;
+    return fvar_n<T, N>(NOT_A_NUMBER, tangent_t::Constant(NOT_A_NUMBER));
+  }
+  return fvar_n<T, N>(log(x.val_), x.d_ / x.val_);
+}
+
+/**
+ * Return the natural logarithm of the argument, propagating the Taylor
+ * coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return natural logarithm of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> log(const taylor<T, D>& x) {
+  using std::log;
+  const T inv_x = 1 / x.c_[0];
+  const T f[4] = {log(x.c_[0]), inv_x, -inv_x * inv_x,
+                  2 * inv_x * inv_x * inv_x};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -13,6 +13,36 @@ inline fvar<T> log1p(const fvar<T>& x) {
   return fvar<T>(log1p(x.val_), x.d_ / (1 + x.val_));
 }
 
+/**
+ * Return the natural logarithm of one plus the argument, propagating all
+ * tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return natural logarithm of one plus the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> log1p(const fvar_n<T, N>& x) {
+  return fvar_n<T, N>(log1p(x.val_), x.d_ / (1 + x.val_));
+}
+
+/**
+ * Return the natural logarithm of one plus the argument, propagating the Taylor
+ * coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return natural logarithm of one plus the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> log1p(const taylor<T, D>& x) {
+  const T u = 1 / (1 + x.c_[0]);
+  const T f[4] = {log1p(x.c_[0]), u, -u * u, 2 * u * u * u};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
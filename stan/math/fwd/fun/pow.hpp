@@ -57,6 +57,130 @@ inline fvar<T> pow(const fvar<T>& x1, U x2) {
   return fvar<T>(pow(x1.val_, x2), x1.d_ * x2 * pow(x1.val_, x2 - 1));
 }
 
+/**
+ * Return the first argument raised to the power of the second argument,
+ * propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x1 base
+ * @param x2 exponent
+ * @return base raised to the power of the exponent
+ */
+template <typename T, int N>
+inline fvar_n<T, N> pow(const fvar_n<T, N>& x1, const fvar_n<T, N>& x2) {
+  using std::log;
+  using std::pow;
+  T pow_x1_x2(pow(x1.val_, x2.val_));
+  return fvar_n<T, N>(
+      pow_x1_x2,
+      (x2.d_ * log(x1.val_) + x1.d_ * (x2.val_ / x1.val_)) * pow_x1_x2);
+}
+
+/**
+ * Return the first argument raised to the power of the second argument,
+ * propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U arithmetic type of the base
+ * @param x1 base
+ * @param x2 exponent
+ * @return base raised to the power of the exponent
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> pow(U x1, const fvar_n<T, N>& x2) {
+  using std::log;
+  using std::pow;
+  T u = pow(x1, x2.val_);
+  return fvar_n<T, N>(u, x2.d_ * (log(x1) * u));
+}
+
+/**
+ * Return the first argument raised to the power of the second argument,
+ * propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @tparam U arithmetic type of the exponent
+ * @param x1 base
+ * @param x2 exponent
+ * @return base raised to the power of the exponent
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_n<T, N> pow(const fvar_n<T, N>& x1, U x2) {
+  using std::pow;
+  if (x2 == 1.0) {
+    return x1;
+  }
+  if (x2 == 2.0) {
+    return square(x1);
+  }
+  return fvar_n<T, N>(pow(x1.val_, x2), x1.d_ * (x2 * pow(x1.val_, x2 - 1)));
+}
+
+/**
+ * Return the first argument raised to the power of the second argument,
+ * propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x1 base
+ * @param x2 exponent
+ * @return base raised to the power of the exponent
+ */
+template <typename T, int D>
+inline taylor<T, D> pow(const taylor<T, D>& x1, const taylor<T, D>& x2) {
+  return exp(x2 * log(x1));
+}
+
+/**
+ * Return the first argument raised to the power of the second argument,
+ * propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U arithmetic type of the base
+ * @param x1 base
+ * @param x2 exponent
+ * @return base raised to the power of the exponent
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> pow(U x1, const taylor<T, D>& x2) {
+  using std::log;
+  return exp(x2 * log(x1));
+}
+
+/**
+ * Return the first argument raised to the power of the second argument,
+ * propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @tparam U arithmetic type of the exponent
+ * @param x1 base
+ * @param x2 exponent
+ * @return base raised to the power of the exponent
+ */
+template <typename T, int D, typename U, require_arithmetic_t<U>* = nullptr>
+inline taylor<T, D> pow(const taylor<T, D>& x1, U x2) {
+  using std::pow;
+  if (x2 == 1.0) {
+    return x1;
+  }
+  if (x2 == 2.0) {
+    return x1 * x1;
+  }
+  // derivatives with a zero factor are zero even where pow() is infinite
+  T f[4];
+  T factor = 1;
+  for (int k = 0; k <= D; ++k) {
+    f[k] = factor == 0 ? T(0) : factor * pow(x1.c_[0], x2 - k);
+    factor *= x2 - k;
+  }
+  return taylor_chain(x1, f);
+}
+
 // must uniquely match all pairs of:
 //    { complex<fvar<V>>, complex<T>, fvar<V>, T }
 // with at least one fvar<V> and at least one complex, where T is arithmetic:
@@ -29,6 +29,39 @@ inline std::complex<fvar<T>> sin(const std::complex<fvar<T>>& z) {
   return internal::complex_sin(z);
 }
 
+/**
+ * Return the sine of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return sine of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> sin(const fvar_n<T, N>& x) {
+  using std::cos;
+  using std::sin;
+  return fvar_n<T, N>(sin(x.val_), x.d_ * cos(x.val_));
+}
+
+/**
+ * Return the sine of the argument, propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return sine of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> sin(const taylor<T, D>& x) {
+  using std::cos;
+  using std::sin;
+  const T s = sin(x.c_[0]);
+  const T c = cos(x.c_[0]);
+  const T f[4] = {s, c, -s, -c};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -31,6 +31,40 @@ inline std::complex<fvar<T>> sqrt(const std::complex<fvar<T>>& z) {
   return internal::complex_sqrt(z);
 }
 
+/**
+ * Return the square root of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return square root of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> sqrt(const fvar_n<T, N>& x) {
+  using std::sqrt;
+  T u = sqrt(x.val_);
+  return fvar_n<T, N>(u, x.d_ * (0.5 / u));
+}
+
+/**
+ * Return the square root of the argument, propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return square root of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> sqrt(const taylor<T, D>& x) {
+  using std::sqrt;
+  const T s = sqrt(x.c_[0]);
+  const T inv_x = 1 / x.c_[0];
+  const T f1 = 0.5 / s;
+  const T f2 = -0.5 * f1 * inv_x;
+  const T f[4] = {s, f1, f2, -1.5 * f2 * inv_x};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
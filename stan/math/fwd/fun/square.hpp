@@ -12,6 +12,33 @@ template <typename T>
 inline fvar<T> square(const fvar<T>& x) {
   return fvar<T>(square(x.val_), x.d_ * 2 * x.val_);
 }
+
+/**
+ * Return the square of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return square of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> square(const fvar_n<T, N>& x) {
+  return fvar_n<T, N>(square(x.val_), x.d_ * (2 * x.val_));
+}
+
+/**
+ * Return the square of the argument, propagating the Taylor coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return square of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> square(const taylor<T, D>& x) {
+  return x * x;
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -30,6 +30,39 @@ inline std::complex<fvar<T>> tanh(const std::complex<fvar<T>>& z) {
   return stan::math::internal::complex_tanh(z);
 }
 
+/**
+ * Return the hyperbolic tangent of the argument, propagating all tangents.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangents
+ * @param x argument
+ * @return hyperbolic tangent of the argument
+ */
+template <typename T, int N>
+inline fvar_n<T, N> tanh(const fvar_n<T, N>& x) {
+  using std::tanh;
+  T u = tanh(x.val_);
+  return fvar_n<T, N>(u, x.d_ * (1 - u * u));
+}
+
+/**
+ * Return the hyperbolic tangent of the argument, propagating the Taylor
+ * coefficients.
+ *
+ * @tparam T type of the coefficients
+ * @tparam D order of the Taylor coefficients
+ * @param x argument
+ * @return hyperbolic tangent of the argument
+ */
+template <typename T, int D>
+inline taylor<T, D> tanh(const taylor<T, D>& x) {
+  using std::tanh;
+  const T t = tanh(x.c_[0]);
+  const T f1 = 1 - t * t;
+  const T f[4] = {t, f1, -2 * t * f1, -2 * f1 * (1 - 3 * t * t)};
+  return taylor_chain(x, f);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -3,6 +3,7 @@
 
 #include <stan/math/fwd/functor/apply_scalar_unary.hpp>
 #include <stan/math/fwd/functor/gradient.hpp>
+#include <stan/math/fwd/functor/grad_hessian_taylor.hpp>
 #include <stan/math/fwd/functor/hessian.hpp>
 #include <stan/math/fwd/functor/jacobian.hpp>
 #include <stan/math/fwd/functor/operands_and_partials.hpp>
@@ -0,0 +1,133 @@
+#ifndef STAN_MATH_FWD_FUNCTOR_GRAD_HESSIAN_TAYLOR_HPP
+#define STAN_MATH_FWD_FUNCTOR_GRAD_HESSIAN_TAYLOR_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Return the Taylor coefficients of the specified function along the
+ * sum of up to three unit directions.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] i first direction
+ * @param[in] j second direction or -1 for none
+ * @param[in] k third direction or -1 for none
+ * @param[in] sign_j sign of the second direction
+ * @return Taylor coefficients of the function along the direction
+ */
+template <typename F>
+inline taylor<double, 3> taylor_along(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x, int i,
+    int j, int k, double sign_j = 1) {
+  Eigen::Matrix<taylor<double, 3>, Eigen::Dynamic, 1> x_taylor(x.size());
+  for (int m = 0; m < x.size(); ++m) {
+    x_taylor(m) = taylor<double, 3>(
+        x(m), (m == i) + sign_j * (m == j) + (m == k));
+  }
+  return f(x_taylor);
+}
+
+}  // namespace internal
+
+/**
+ * Calculate the value, the Hessian, and the gradient of the Hessian
+ * of the specified function at the specified argument by univariate
+ * Taylor propagation.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * taylor\<double, 3\>
+ * operator()(const Eigen::Matrix\<taylor\<double, 3\>,
+ *            Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>taylor</code>.
+ *
+ * <p>Each evaluation propagates the third order Taylor polynomial of
+ * the function along one direction, without an autodiff tape. Pure
+ * derivatives come from the unit directions, mixed ones are
+ * interpolated from the sums and differences of two or three unit
+ * directions. That takes `d + d (d - 1) + d (d - 1) (d - 2) / 6`
+ * evaluations, each much cheaper than a nested `fvar<fvar<var>>`
+ * evaluation and its reverse sweep in `grad_hessian()`, so this is
+ * faster for functions of a few arguments. The interpolation loses a
+ * few digits in the mixed entries compared to `grad_hessian()`.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] H Hessian of function at argument
+ * @param[out] grad_H Gradient of the Hessian of function at argument
+ */
+template <typename F>
+void grad_hessian_taylor(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x, double& fx,
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& H,
+    std::vector<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> >&
+        grad_H) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using internal::taylor_along;
+  int d = x.size();
+  H.resize(d, d);
+  grad_H.assign(d, Matrix<double, Dynamic, Dynamic>(d, d));
+  if (d == 0) {
+    fx = f(x);
+    return;
+  }
+  // third derivatives along e_i, e_i + e_j and e_i + e_j + e_k
+  auto set_third = [&](int i, int j, int k, double t) {
+    grad_H[i](j, k) = t;
+    grad_H[i](k, j) = t;
+    grad_H[j](i, k) = t;
+    grad_H[j](k, i) = t;
+    grad_H[k](i, j) = t;
+    grad_H[k](j, i) = t;
+  };
+  for (int i = 0; i < d; ++i) {
+    taylor<double, 3> fx_taylor = taylor_along(f, x, i, -1, -1);
+    if (i == 0) {
+      fx = fx_taylor.c_[0];
+    }
+    H(i, i) = 2 * fx_taylor.c_[2];
+    grad_H[i](i, i) = 6 * fx_taylor.c_[3];
+  }
+  for (int i = 0; i < d; ++i) {
+    for (int j = i + 1; j < d; ++j) {
+      taylor<double, 3> plus = taylor_along(f, x, i, j, -1);
+      taylor<double, 3> minus = taylor_along(f, x, i, j, -1, -1);
+      H(i, j) = 0.5 * (plus.c_[2] - minus.c_[2]);
+      H(j, i) = H(i, j);
+      double sum = 6 * (plus.c_[3] + minus.c_[3]);
+      double diff = 6 * (plus.c_[3] - minus.c_[3]);
+      set_third(i, j, j, (sum - 2 * grad_H[i](i, i)) / 6);
+      set_third(i, i, j, (diff - 2 * grad_H[j](j, j)) / 6);
+    }
+  }
+  for (int i = 0; i < d; ++i) {
+    for (int j = i + 1; j < d; ++j) {
+      for (int k = j + 1; k < d; ++k) {
+        double t = 6 * taylor_along(f, x, i, j, k).c_[3];
+        t -= grad_H[i](i, i) + grad_H[j](j, j) + grad_H[k](k, k);
+        t -= 3
+             * (grad_H[i](i, j) + grad_H[i](i, k) + grad_H[i](j, j)
+                + grad_H[j](j, k) + grad_H[i](k, k) + grad_H[j](k, k));
+        set_third(i, j, k, t / 6);
+      }
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -3,6 +3,7 @@
 
 #include <stan/math/fwd/core.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
 
 namespace stan {
 namespace math {
@@ -53,6 +54,55 @@ void gradient(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x, T& fx,
   }
 }
 
+/**
+ * Calculate the value and the gradient of the specified function
+ * at the specified argument, propagating `N` directions per evaluation.
+ * The function is evaluated `ceil(x.size() / N)` times, instead of once
+ * per input as with `fvar`.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * fvar_n<T, N>
+ * operator()(const Eigen::Matrix<fvar_n<T, N>, Eigen::Dynamic, 1>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar_n</code>.
+ *
+ * @tparam N number of directions propagated per evaluation
+ * @tparam T type of the elements in the vector
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad_fx Gradient of function at argument
+ */
+template <int N, typename T, typename F>
+void gradient(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x, T& fx,
+              Eigen::Matrix<T, Eigen::Dynamic, 1>& grad_fx) {
+  Eigen::Matrix<fvar_n<T, N>, Eigen::Dynamic, 1> x_fvar(x.size());
+  grad_fx.resize(x.size());
+  for (int k = 0; k < x.size(); ++k) {
+    x_fvar(k) = fvar_n<T, N>(x(k));
+  }
+  int start = 0;
+  do {
+    const int n_directions = std::min<int>(N, x.size() - start);
+    for (int j = 0; j < n_directions; ++j) {
+      x_fvar(start + j).d_(j) = 1;
+    }
+    fvar_n<T, N> fx_fvar = f(x_fvar);
+    if (start == 0) {
+      fx = fx_fvar.val_;
+    }
+    grad_fx.segment(start, n_directions) = fx_fvar.d_.head(n_directions);
+    for (int j = 0; j < n_directions; ++j) {
+      x_fvar(start + j).d_(j) = 0;
+    }
+    start += N;
+  } while (start < x.size());
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -2,7 +2,9 @@
 #define STAN_MATH_FWD_FUNCTOR_JACOBIAN_HPP
 
 #include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
 
 namespace stan {
 namespace math {
@@ -14,13 +16,12 @@ void jacobian(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
   using Eigen::Dynamic;
   using Eigen::Matrix;
   Matrix<fvar<T>, Dynamic, 1> x_fvar(x.size());
-  J.resize(x_fvar.size(), x.size());
-  fx.resize(x_fvar.size());
   for (int k = 0; k < x.size(); ++k) {
     x_fvar(k) = fvar<T>(x(k), 0);
   }
   x_fvar(0) = fvar<T>(x(0), 1);
   Matrix<fvar<T>, Dynamic, 1> fx_fvar = f(x_fvar);
+  J.resize(fx_fvar.size(), x.size());
   fx = fx_fvar.val();
   J.col(0) = fx_fvar.d();
   const fvar<T> switch_fvar(0, 1);  // flips the tangents on and off
@@ -32,6 +33,167 @@ void jacobian(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
   }
 }
 
+/**
+ * Calculate the value and the Jacobian of the specified function at the
+ * specified argument, propagating `N` directions per evaluation. The
+ * function is evaluated `ceil(x.size() / N)` times, instead of once per
+ * input as with `fvar`.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix<fvar_n<T, N>, Eigen::Dynamic, 1>
+ * operator()(const Eigen::Matrix<fvar_n<T, N>, Eigen::Dynamic, 1>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar_n</code>.
+ *
+ * @tparam N number of directions propagated per evaluation
+ * @tparam T type of the elements in the vector
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[out] fx function applied to argument
+ * @param[out] J Jacobian of function at argument
+ */
+template <int N, typename T, typename F>
+void jacobian(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
+              Eigen::Matrix<T, Eigen::Dynamic, 1>& fx,
+              Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& J) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  Matrix<fvar_n<T, N>, Dynamic, 1> x_fvar(x.size());
+  for (int k = 0; k < x.size(); ++k) {
+    x_fvar(k) = fvar_n<T, N>(x(k));
+  }
+  int start = 0;
+  do {
+    const int n_directions = std::min<int>(N, x.size() - start);
+    for (int j = 0; j < n_directions; ++j) {
+      x_fvar(start + j).d_(j) = 1;
+    }
+    Matrix<fvar_n<T, N>, Dynamic, 1> fx_fvar = f(x_fvar);
+    if (start == 0) {
+      fx.resize(fx_fvar.size());
+      J.resize(fx_fvar.size(), x.size());
+      for (int i = 0; i < fx_fvar.size(); ++i) {
+        fx(i) = fx_fvar(i).val_;
+      }
+    }
+    for (int i = 0; i < fx_fvar.size(); ++i) {
+      J.row(i).segment(start, n_directions)
+          = fx_fvar(i).d_.head(n_directions).transpose();
+    }
+    for (int j = 0; j < n_directions; ++j) {
+      x_fvar(start + j).d_(j) = 0;
+    }
+    start += N;
+  } while (start < x.size());
+}
+
+/**
+ * Calculate the value of the specified function at the specified
+ * argument and the product of its Jacobian with a vector. The function
+ * is evaluated once, with the tangents of the argument set to the
+ * vector, instead of once per input as needed to form the Jacobian.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix<fvar<T>, Eigen::Dynamic, 1>
+ * operator()(const Eigen::Matrix<fvar<T>, Eigen::Dynamic, 1>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar</code>.
+ *
+ * @tparam T type of the elements in the vector
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] v vector multiplying the Jacobian from the right
+ * @param[out] fx function applied to argument
+ * @param[out] Jv product of the Jacobian of function at argument and `v`
+ * @throw std::invalid_argument if the sizes of `x` and `v` do not match
+ */
+template <typename T, typename F>
+void jvp(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
+         const Eigen::Matrix<T, Eigen::Dynamic, 1>& v,
+         Eigen::Matrix<T, Eigen::Dynamic, 1>& fx,
+         Eigen::Matrix<T, Eigen::Dynamic, 1>& Jv) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  check_size_match("jvp", "size of x", x.size(), "size of v", v.size());
+  Matrix<fvar<T>, Dynamic, 1> x_fvar(x.size());
+  for (int k = 0; k < x.size(); ++k) {
+    x_fvar(k) = fvar<T>(x(k), v(k));
+  }
+  Matrix<fvar<T>, Dynamic, 1> fx_fvar = f(x_fvar);
+  fx = fx_fvar.val();
+  Jv = fx_fvar.d();
+}
+
+/**
+ * Calculate the value of the specified function at the specified
+ * argument and the product of its Jacobian with several vectors,
+ * propagating `N` vectors per evaluation. The function is evaluated
+ * `ceil(V.cols() / N)` times.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix<fvar_n<T, N>, Eigen::Dynamic, 1>
+ * operator()(const Eigen::Matrix<fvar_n<T, N>, Eigen::Dynamic, 1>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar_n</code>.
+ *
+ * @tparam N number of vectors propagated per evaluation
+ * @tparam T type of the elements in the vector
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] V matrix with the vectors multiplying the Jacobian as columns
+ * @param[out] fx function applied to argument
+ * @param[out] JV product of the Jacobian of function at argument and `V`
+ * @throw std::invalid_argument if the size of `x` does not match the
+ * number of rows of `V`
+ */
+template <int N, typename T, typename F>
+void jvp(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
+         const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& V,
+         Eigen::Matrix<T, Eigen::Dynamic, 1>& fx,
+         Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& JV) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  check_size_match("jvp", "size of x", x.size(), "rows of V", V.rows());
+  Matrix<fvar_n<T, N>, Dynamic, 1> x_fvar(x.size());
+  for (int k = 0; k < x.size(); ++k) {
+    x_fvar(k) = fvar_n<T, N>(x(k));
+  }
+  int start = 0;
+  do {
+    const int n_directions = std::min<int>(N, V.cols() - start);
+    for (int k = 0; k < x.size(); ++k) {
+      x_fvar(k).d_.head(n_directions)
+          = V.row(k).segment(start, n_directions).transpose();
+      x_fvar(k).d_.tail(N - n_directions).setZero();
+    }
+    Matrix<fvar_n<T, N>, Dynamic, 1> fx_fvar = f(x_fvar);
+    if (start == 0) {
+      fx.resize(fx_fvar.size());
+      JV.resize(fx_fvar.size(), V.cols());
+      for (int i = 0; i < fx_fvar.size(); ++i) {
+        fx(i) = fx_fvar(i).val_;
+      }
+    }
+    for (int i = 0; i < fx_fvar.size(); ++i) {
+      JV.row(i).segment(start, n_directions)
+          = fx_fvar(i).d_.head(n_directions).transpose();
+    }
+    start += N;
+  } while (start < V.cols());
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
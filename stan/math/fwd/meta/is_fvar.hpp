@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_META_IS_FVAR_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_n.hpp>
 #include <stan/math/prim/meta/is_fvar.hpp>
 #include <type_traits>
 
@@ -14,6 +15,9 @@ struct is_fvar_impl : std::false_type {};
 template <typename T>
 struct is_fvar_impl<math::fvar<T>> : std::true_type {};
 
+template <typename T, int N>
+struct is_fvar_impl<math::fvar_n<T, N>> : std::true_type {};
+
 }  // namespace internal
 
 template <typename T>
@@ -284,6 +284,27 @@ class stack_alloc {
     }
     return false;
   }
+
+  /**
+   * Return the end of the memory in use in the block holding the
+   * pointer. For blocks before the current one that is the end of the
+   * block.
+   *
+   * @param[in] ptr memory location
+   * @return end of the memory in use in the block holding the pointer,
+   *    or nullptr if the pointer is not in the stack
+   */
+  inline const char* used_end(const void* ptr) const {
+    for (size_t i = 0; i < cur_block_; ++i) {
+      if (ptr >= blocks_[i] && ptr < blocks_[i] + sizes_[i]) {
+        return blocks_[i] + sizes_[i];
+      }
+    }
+    if (ptr >= blocks_[cur_block_] && ptr < next_loc_) {
+      return next_loc_;
+    }
+    return nullptr;
+  }
 };
 
 }  // namespace math
@@ -5,11 +5,60 @@
 #include <stan/math/prim/functor/finite_diff_gradient_auto.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stan/math/mix/functor/hessian.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 #include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Return the fourth-order finite difference approximation of the
+ * partial derivative of the Hessian of the specified function along
+ * one dimension.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] i dimension of the partial derivative
+ * @return partial derivative of the Hessian along dimension `i`
+ */
+template <typename F>
+Eigen::MatrixXd finite_diff_hessian_partial(const F& f,
+                                            const Eigen::VectorXd& x, int i) {
+  int d = x.size();
+  Eigen::VectorXd x_temp(x);
+  Eigen::VectorXd grad_auto(d);
+  Eigen::MatrixXd hess_auto(d, d);
+  Eigen::MatrixXd hess_diff(d, d);
+  double dummy_fx_eval;
+  double epsilon = finite_diff_stepsize(x(i));
+  hess_diff.setZero();
+
+  x_temp(i) = x(i) + 2 * epsilon;
+  hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
+  hess_diff = -hess_auto;
+
+  x_temp(i) = x(i) + -2 * epsilon;
+  hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
+  hess_diff += hess_auto;
+
+  x_temp(i) = x(i) + epsilon;
+  hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
+  hess_diff += 8 * hess_auto;
+
+  x_temp(i) = x(i) + -epsilon;
+  hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
+  hess_diff -= 8 * hess_auto;
+
+  hess_diff /= 12 * epsilon;
+  return hess_diff;
+}
+
+}  // namespace internal
+
 /**
  * Calculate the value, Hessian, and the gradient of the Hessian of
  * the specified function at the specified argument using second-order
@@ -49,39 +98,57 @@ void finite_diff_grad_hessian_auto(const F& f, const Eigen::VectorXd& x,
   grad_hess_fx.clear();
   grad_hess_fx.reserve(d);
 
-  Eigen::VectorXd x_temp(x);
   Eigen::VectorXd grad_auto(d);
-  Eigen::MatrixXd hess_auto(d, d);
-  Eigen::MatrixXd hess_diff(d, d);
 
   hessian(f, x, fx, grad_auto, hess);
 
   for (int i = 0; i < d; ++i) {
-    double dummy_fx_eval;
-    double epsilon = finite_diff_stepsize(x(i));
-    hess_diff.setZero();
-
-    x_temp(i) = x(i) + 2 * epsilon;
-    hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
-    hess_diff = -hess_auto;
-
-    x_temp(i) = x(i) + -2 * epsilon;
-    hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
-    hess_diff += hess_auto;
-
-    x_temp(i) = x(i) + epsilon;
-    hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
-    hess_diff += 8 * hess_auto;
-
-    x_temp(i) = x(i) + -epsilon;
-    hessian(f, x_temp, dummy_fx_eval, grad_auto, hess_auto);
-    hess_diff -= 8 * hess_auto;
+    grad_hess_fx.push_back(internal::finite_diff_hessian_partial(f, x, i));
+  }
+  fx = f(x);
+}
 
-    x_temp(i) = x(i);
-    hess_diff /= 12 * epsilon;
+/**
+ * Calculate the value, Hessian, and the gradient of the Hessian of
+ * the specified function at the specified argument, like
+ * <code>finite_diff_grad_hessian_auto()</code>, computing the partial
+ * derivatives of the Hessian concurrently with the TBB if
+ * `STAN_THREADS` is defined.
+ *
+ * <p>Each partial derivative is computed exactly as in the serial
+ * version, so the results are bitwise identical. The functor must be
+ * safe to call concurrently from several threads.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] hess Hessian matrix
+ * @param[out] grad_hess_fx gradient of Hessian of function at argument
+ */
+template <typename F>
+void finite_diff_grad_hessian_auto_parallel(
+    const F& f, const Eigen::VectorXd& x, double& fx, Eigen::MatrixXd& hess,
+    std::vector<Eigen::MatrixXd>& grad_hess_fx) {
+  int d = x.size();
+  Eigen::VectorXd grad_auto(d);
+  hessian(f, x, fx, grad_auto, hess);
 
-    grad_hess_fx.push_back(hess_diff);
-  }
+  grad_hess_fx.clear();
+  grad_hess_fx.resize(d);
+  auto execute_chunk = [&](std::size_t start, std::size_t end) {
+    for (std::size_t i = start; i != end; ++i) {
+      grad_hess_fx[i] = internal::finite_diff_hessian_partial(f, x, i);
+    }
+  };
+#ifdef STAN_THREADS
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, d),
+                    [&](const tbb::blocked_range<size_t>& r) {
+                      execute_chunk(r.begin(), r.end());
+                    });
+#else
+  execute_chunk(0, d);
+#endif
   fx = f(x);
 }
 
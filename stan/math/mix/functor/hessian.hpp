@@ -4,6 +4,7 @@
 #include <stan/math/fwd/core.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/rev/core.hpp>
+#include <algorithm>
 #include <stdexcept>
 
 namespace stan {
@@ -31,6 +32,10 @@ namespace math {
  * general namespace imports that eventually depend on functions
  * defined in Stan.
  *
+ * <p>The function is evaluated once per input. If evaluating it
+ * dominates, <code>hessian\<K\>()</code> below evaluates it `K`
+ * times less often.
+ *
  * @tparam F Type of function
  * @param[in] f Function
  * @param[in] x Argument to function
@@ -70,6 +75,94 @@ void hessian(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
   }
 }
 
+/**
+ * Calculate the value, the gradient, and the Hessian,
+ * of the specified function at the specified argument, seeding
+ * `K` directions per evaluation of the function.
+ *
+ * <p>Instead of one evaluation with <code>fvar\<var\></code>
+ * arguments per input, the function is evaluated
+ * `ceil(x.size() / K)` times with
+ * <code>fvar_n\<var, K\></code> arguments, each evaluation
+ * followed by one reverse sweep per seeded direction over the
+ * same expression graph. Only the lower triangle of the Hessian
+ * is read from the sweeps and the upper triangle is filled in by
+ * symmetry, so the result is exactly symmetric.
+ *
+ * <p>Because <code>var</code> carries a scalar adjoint, each
+ * direction still needs its own reverse sweep, over a graph that
+ * holds all `K` directions, so the reverse work per evaluation
+ * grows as `K^2`. Use this overload when evaluating the function
+ * costs more than sweeping its graph, for example when it does a
+ * lot of work on <code>double</code>s or rebuilds an expensive
+ * expression graph. Otherwise the column-by-column
+ * <code>hessian()</code> is faster. Small `K`, such as 4, is
+ * usually best; `benchmarks/hessian_batched.cpp` compares both
+ * cases.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * fvar_n\<var, K\>
+ * operator()(const
+ * Eigen::Matrix\<fvar_n\<var, K\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for
+ * <code>fvar_n</code> and <code>var</code>.
+ *
+ * @tparam K number of directions seeded per evaluation
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument
+ */
+template <int K, typename F>
+void hessian(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+             double& fx, Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+             Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& H) {
+  H.resize(x.size(), x.size());
+  grad.resize(x.size());
+
+  // need to compute fx even with size = 0
+  if (x.size() == 0) {
+    fx = f(x);
+    return;
+  }
+  for (int start = 0; start < x.size(); start += K) {
+    // Run nested autodiff in this scope
+    nested_rev_autodiff nested;
+
+    const int n_directions = std::min<int>(K, x.size() - start);
+    Eigen::Matrix<fvar_n<var, K>, Eigen::Dynamic, 1> x_fvar(x.size());
+    for (int j = 0; j < x.size(); ++j) {
+      x_fvar(j) = fvar_n<var, K>(x(j));
+    }
+    for (int j = 0; j < n_directions; ++j) {
+      x_fvar(start + j).d_(j) = 1;
+    }
+    fvar_n<var, K> fx_fvar = f(x_fvar);
+    if (start == 0) {
+      fx = fx_fvar.val_.val();
+    }
+    for (int j = 0; j < n_directions; ++j) {
+      const int i = start + j;
+      grad(i) = fx_fvar.d_(j).val();
+      if (j > 0) {
+        nested.set_zero_all_adjoints();
+      }
+      stan::math::grad(fx_fvar.d_(j).vi_);
+      H(i, i) = x_fvar(i).val_.adj();
+      for (int k = i + 1; k < x.size(); ++k) {
+        H(k, i) = x_fvar(k).val_.adj();
+        H(i, k) = H(k, i);
+      }
+    }
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_MIX_FUNCTOR_HESSIAN_TIMES_VECTOR_HPP
 
 #include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stdexcept>
@@ -10,41 +11,143 @@
 namespace stan {
 namespace math {
 
+/**
+ * Calculate the value of the specified function and the product of its
+ * Hessian at the specified argument with the specified vector.
+ *
+ * <p>The product is computed forward-over-reverse: the function is
+ * evaluated once with <code>fvar\<var\></code> arguments whose tangents
+ * are `v`, and one reverse sweep from the resulting directional
+ * derivative yields the product. The Hessian is never formed.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * fvar\<var\>
+ * operator()(const
+ * Eigen::Matrix\<fvar\<var\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] v Vector to multiply the Hessian with
+ * @param[out] fx Function applied to argument
+ * @param[out] Hv Product of the Hessian of function at argument and `v`
+ * @throw std::invalid_argument if the sizes of `x` and `v` do not match
+ */
 template <typename F>
 void hessian_times_vector(const F& f,
                           const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
                           const Eigen::Matrix<double, Eigen::Dynamic, 1>& v,
                           double& fx,
                           Eigen::Matrix<double, Eigen::Dynamic, 1>& Hv) {
-  using Eigen::Matrix;
+  check_size_match("hessian_times_vector", "size of x", x.size(),
+                   "size of v", v.size());
 
   // Run nested autodiff in this scope
   nested_rev_autodiff nested;
 
-  Matrix<var, Eigen::Dynamic, 1> x_var(x.size());
-  for (int i = 0; i < x_var.size(); ++i) {
-    x_var(i) = x(i);
+  Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(x.size());
+  for (int i = 0; i < x.size(); ++i) {
+    x_fvar(i) = fvar<var>(x(i), v(i));
   }
-  var fx_var;
-  var grad_fx_var_dot_v;
-  gradient_dot_vector(f, x_var, v, fx_var, grad_fx_var_dot_v);
-  fx = fx_var.val();
-  grad(grad_fx_var_dot_v.vi_);
+  fvar<var> fx_fvar = f(x_fvar);
+  fx = fx_fvar.val_.val();
+  grad(fx_fvar.d_.vi_);
   Hv.resize(x.size());
   for (int i = 0; i < x.size(); ++i) {
-    Hv(i) = x_var(i).adj();
+    Hv(i) = x_fvar(i).val_.adj();
+  }
+}
+
+/**
+ * Calculate the value of the specified function and the products of its
+ * Hessian at the specified argument with each column of the specified
+ * matrix.
+ *
+ * <p>Each product takes one forward-over-reverse pass, as in the vector
+ * version, so the cost grows with the number of columns of `V` rather
+ * than with the size of `x`.
+ *
+ * <p>The functor must implement the same signature as for the vector
+ * version.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] V Matrix with the vectors to multiply the Hessian with as
+ * columns
+ * @param[out] fx Function applied to argument
+ * @param[out] HV Product of the Hessian of function at argument and `V`
+ * @throw std::invalid_argument if the size of `x` does not match the
+ * number of rows of `V`
+ */
+template <typename F>
+void hessian_times_vector(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+    const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& V,
+    double& fx, Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& HV) {
+  check_size_match("hessian_times_vector", "size of x", x.size(),
+                   "rows of V", V.rows());
+  HV.resize(x.size(), V.cols());
+  if (V.cols() == 0) {
+    fx = f(x);
+    return;
+  }
+  Eigen::Matrix<double, Eigen::Dynamic, 1> v;
+  Eigen::Matrix<double, Eigen::Dynamic, 1> Hv;
+  for (int j = 0; j < V.cols(); ++j) {
+    v = V.col(j);
+    hessian_times_vector(f, x, v, fx, Hv);
+    HV.col(j) = Hv;
   }
 }
+
+/**
+ * Calculate the value of the specified function and the product of its
+ * Hessian at the specified argument with the specified vector, using
+ * nested forward mode.
+ *
+ * <p>The function is evaluated with <code>fvar\<fvar\<T\>\></code>
+ * arguments whose inner tangents are `v`. With the outer tangent seeded
+ * by the `i`-th unit vector, the outer tangent of the directional
+ * derivative is the `i`-th element of the product, so `x.size()`
+ * evaluations are needed, but the Hessian is never formed.
+ *
+ * @tparam T Type of the elements of the argument
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] v Vector to multiply the Hessian with
+ * @param[out] fx Function applied to argument
+ * @param[out] Hv Product of the Hessian of function at argument and `v`
+ * @throw std::invalid_argument if the sizes of `x` and `v` do not match
+ */
 template <typename T, typename F>
 void hessian_times_vector(const F& f,
                           const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
                           const Eigen::Matrix<T, Eigen::Dynamic, 1>& v, T& fx,
                           Eigen::Matrix<T, Eigen::Dynamic, 1>& Hv) {
-  using Eigen::Matrix;
-  Matrix<T, Eigen::Dynamic, 1> grad;
-  Matrix<T, Eigen::Dynamic, Eigen::Dynamic> H;
-  hessian(f, x, fx, grad, H);
-  Hv = H * v;
+  check_size_match("hessian_times_vector", "size of x", x.size(),
+                   "size of v", v.size());
+  Hv.resize(x.size());
+  // size 0 separate because nothing to loop over in main body
+  if (x.size() == 0) {
+    fx = f(x);
+    return;
+  }
+  Eigen::Matrix<fvar<fvar<T>>, Eigen::Dynamic, 1> x_fvar(x.size());
+  for (int i = 0; i < x.size(); ++i) {
+    for (int k = 0; k < x.size(); ++k) {
+      x_fvar(k) = fvar<fvar<T>>(fvar<T>(x(k), v(k)), fvar<T>(i == k, 0));
+    }
+    fvar<fvar<T>> fx_fvar = f(x_fvar);
+    if (i == 0) {
+      fx = fx_fvar.val_.val_;
+    }
+    Hv(i) = fx_fvar.d_.d_;
+  }
 }
 
 }  // namespace math
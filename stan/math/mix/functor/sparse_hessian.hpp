@@ -0,0 +1,134 @@
+#ifndef STAN_MATH_MIX_FUNCTOR_SPARSE_HESSIAN_HPP
+#define STAN_MATH_MIX_FUNCTOR_SPARSE_HESSIAN_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/mix/functor/hessian.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/column_coloring.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Detects the sparsity pattern of the Hessian of the specified function at
+ * the specified argument. The Hessian is computed densely, so the pattern
+ * should be detected once, at a generic argument, and then reused with
+ * `sparse_hessian()`. Entries that happen to vanish at `x` are not
+ * detected.
+ *
+ * <p>The functor must implement the same signature as for
+ * <code>hessian()</code>.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @return symmetric pattern with an entry of 1 for each pair of inputs
+ * with a nonzero or non-finite second derivative
+ */
+template <typename F>
+Eigen::SparseMatrix<double> hessian_sparsity(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x) {
+  double fx;
+  Eigen::Matrix<double, Eigen::Dynamic, 1> grad;
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> H;
+  hessian(f, x, fx, grad, H);
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int j = 0; j < H.cols(); ++j) {
+    for (int i = 0; i < H.rows(); ++i) {
+      if (H(i, j) != 0 || H(j, i) != 0 || !std::isfinite(H(i, j))
+          || !std::isfinite(H(j, i))) {
+        entries.emplace_back(i, j, 1.0);
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(x.size(), x.size());
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  return pattern;
+}
+
+/**
+ * Calculate the value, the gradient, and the sparse Hessian of the
+ * specified function at the specified argument, given the sparsity
+ * pattern of the Hessian.
+ *
+ * <p>The columns of the pattern are colored so that columns of one color
+ * share no row. For each color the function is evaluated with
+ * <code>fvar\<var\></code> arguments whose tangents are the sum of the
+ * unit vectors of the columns of that color, and one reverse sweep of the
+ * tangent yields the Hessian-vector product holding all entries of these
+ * columns. That takes as many passes as there are colors instead of one
+ * per input.
+ *
+ * <p>The functor must implement the same signature as for
+ * <code>hessian()</code>.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] pattern sparsity pattern of the Hessian, every nonzero of the
+ * Hessian must be stored in it
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument, with the pattern of
+ * `pattern`
+ * @throw std::invalid_argument if the pattern is not square or its size
+ * does not match the size of the argument
+ */
+template <typename F>
+void sparse_hessian(const F& f,
+                    const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                    const Eigen::SparseMatrix<double>& pattern, double& fx,
+                    Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+                    Eigen::SparseMatrix<double>& H) {
+  check_size_match("sparse_hessian", "rows of pattern", pattern.rows(),
+                   "size of argument", x.size());
+  check_size_match("sparse_hessian", "columns of pattern", pattern.cols(),
+                   "size of argument", x.size());
+  grad.resize(x.size());
+  H = pattern;
+
+  // need to compute fx even with size = 0
+  if (x.size() == 0) {
+    fx = f(x);
+    return;
+  }
+
+  const std::vector<int> colors = column_coloring(pattern);
+  const int n_colors = *std::max_element(colors.begin(), colors.end()) + 1;
+  for (int c = 0; c < n_colors; ++c) {
+    // Run nested autodiff in this scope
+    nested_rev_autodiff nested;
+
+    Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(x.size());
+    for (int j = 0; j < x.size(); ++j) {
+      x_fvar(j) = fvar<var>(x(j), colors[j] == c);
+    }
+    fvar<var> fx_fvar = f(x_fvar);
+    stan::math::grad(fx_fvar.d_.vi_);
+    for (int j = 0; j < x.size(); ++j) {
+      if (colors[j] != c) {
+        continue;
+      }
+      for (Eigen::SparseMatrix<double>::InnerIterator it(H, j); it; ++it) {
+        it.valueRef() = x_fvar(it.row()).val_.adj();
+      }
+    }
+    if (c == 0) {
+      fx = fx_fvar.val_.val();
+      nested.set_zero_all_adjoints();
+      stan::math::grad(fx_fvar.val_.vi_);
+      for (int j = 0; j < x.size(); ++j) {
+        grad(j) = x_fvar(j).val_.adj();
+      }
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,232 @@
+#ifndef STAN_MATH_OPENCL_BUFFER_POOL_HPP
+#define STAN_MATH_OPENCL_BUFFER_POOL_HPP
+#ifdef STAN_OPENCL
+
+#include <CL/cl2.hpp>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/** \ingroup opencl_context_group
+ * Statistics of an `opencl_buffer_pool`.
+ */
+struct opencl_buffer_pool_statistics {
+  /** Number of requests served from the pool. */
+  std::size_t hits = 0;
+  /** Number of requests that allocated a new buffer. */
+  std::size_t misses = 0;
+  /** Number of unused buffers currently held by the pool. */
+  std::size_t buffers_held = 0;
+  /** Total size in bytes of unused buffers currently held by the pool. */
+  std::size_t bytes_held = 0;
+
+  /**
+   * Fraction of requests that were served from the pool.
+   * @return hit rate or 0 if there were no requests
+   */
+  inline double hit_rate() const {
+    const std::size_t requests = hits + misses;
+    return requests == 0 ? 0.0 : static_cast<double>(hits) / requests;
+  }
+};
+
+/** \ingroup opencl_context_group
+ * Pool of OpenCL device buffers, grouped into size classes.
+ *
+ * Allocating device memory through the driver is slow. `matrix_cl` requests
+ * its buffers from the pool owned by `opencl_context` and returns them on
+ * destruction, so repeated computations with matrices of the same sizes (for
+ * example gradient evaluations, where `arena_matrix_cl`s are released on
+ * `recover_memory()`) reuse buffers instead of allocating new ones.
+ *
+ * Requested sizes are rounded up to one of four size classes per power of
+ * two, so a buffer may be up to 25% larger than requested. The pool keeps
+ * track of the buffers it issued and of how many `matrix_cl`s own each of
+ * them. A buffer is taken back once its last owner returns it; buffers the
+ * pool did not issue are left alone. Operations using a buffer must be
+ * complete before it is returned.
+ *
+ * The pool belongs to the OpenCL context and is destroyed with it, releasing
+ * all buffers it holds.
+ */
+class opencl_buffer_pool {
+  using key_t = std::pair<cl_mem_flags, std::size_t>;
+
+  /**
+   * A buffer issued by the pool.
+   */
+  struct issued_buffer {
+    /** Memory flags and size of the buffer. */
+    key_t key;
+    /** Number of `matrix_cl`s the buffer was issued or shared to. */
+    int owners;
+  };
+
+  std::map<key_t, std::vector<cl::Buffer>> free_;
+  std::unordered_map<cl_mem, issued_buffer> issued_;
+  std::size_t max_bytes_held_ = std::numeric_limits<std::size_t>::max();
+  opencl_buffer_pool_statistics stats_;
+  std::mutex mutex_;
+
+ public:
+  opencl_buffer_pool() = default;
+  opencl_buffer_pool(const opencl_buffer_pool&) = delete;
+  opencl_buffer_pool& operator=(const opencl_buffer_pool&) = delete;
+
+  /**
+   * Rounds the size of a buffer up to its size class.
+   * @param bytes requested size in bytes
+   * @return size of the buffer that will be allocated
+   */
+  static inline std::size_t size_class(std::size_t bytes) {
+    constexpr std::size_t min_size = 256;
+    if (bytes <= min_size) {
+      return min_size;
+    }
+    std::size_t power = min_size;
+    while (power * 2 < bytes) {
+      power *= 2;
+    }
+    const std::size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+  }
+
+  /**
+   * Returns a buffer of at least given size.
+   * @param context context to allocate the buffer in
+   * @param flags memory flags of the buffer
+   * @param bytes requested size in bytes
+   * @return buffer
+   * @throw cl::Error if the buffer can not be allocated
+   */
+  inline cl::Buffer acquire(const cl::Context& context, cl_mem_flags flags,
+                            std::size_t bytes) {
+    const std::size_t rounded = size_class(bytes);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_.find(key_t(flags, rounded));
+      if (it != free_.end() && !it->second.empty()) {
+        cl::Buffer res = std::move(it->second.back());
+        it->second.pop_back();
+        stats_.hits++;
+        stats_.buffers_held--;
+        stats_.bytes_held -= rounded;
+        issued_[res()] = {key_t(flags, rounded), 1};
+        return res;
+      }
+      stats_.misses++;
+    }
+    cl::Buffer res;
+    try {
+      res = cl::Buffer(context, flags, rounded);
+    } catch (const cl::Error& e) {
+      if (e.err() != CL_MEM_OBJECT_ALLOCATION_FAILURE
+          && e.err() != CL_OUT_OF_RESOURCES) {
+        throw;
+      }
+      // the device might be out of memory because of buffers held by the pool
+      clear();
+      res = cl::Buffer(context, flags, rounded);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    issued_[res()] = {key_t(flags, rounded), 1};
+    return res;
+  }
+
+  /**
+   * Records that a buffer is shared by one more `matrix_cl`, so it is only
+   * taken back once all of them returned it.
+   * @param buffer buffer that is shared
+   * @return whether the buffer was issued by this pool and must be returned
+   * to it
+   */
+  inline bool share(const cl::Buffer& buffer) {
+    if (buffer() == nullptr) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = issued_.find(buffer());
+    if (it == issued_.end()) {
+      return false;
+    }
+    it->second.owners++;
+    return true;
+  }
+
+  /**
+   * Returns a buffer to the pool. A buffer is taken back once all of its
+   * owners returned it. Buffers that were not issued by this pool, are
+   * still owned elsewhere or do not fit in the pool are left in `buffer` and
+   * get released once their last reference is gone.
+   * @param buffer buffer to return
+   */
+  inline void release(cl::Buffer&& buffer) {
+    if (buffer() == nullptr) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = issued_.find(buffer());
+    if (it == issued_.end() || --it->second.owners > 0) {
+      return;
+    }
+    const key_t key = it->second.key;
+    issued_.erase(it);
+    if (stats_.bytes_held + key.second > max_bytes_held_) {
+      return;
+    }
+    free_[key].push_back(std::move(buffer));
+    stats_.buffers_held++;
+    stats_.bytes_held += key.second;
+  }
+
+  /**
+   * Releases all buffers held by the pool back to the OpenCL driver.
+   */
+  inline void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.clear();
+    stats_.buffers_held = 0;
+    stats_.bytes_held = 0;
+  }
+
+  /**
+   * Sets the maximal total size of unused buffers held by the pool. Buffers
+   * returned while the pool is full are released to the OpenCL driver.
+   * @param bytes maximal size in bytes
+   */
+  inline void set_max_bytes_held(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_bytes_held_ = bytes;
+  }
+
+  /**
+   * Returns the statistics of the pool.
+   * @return statistics
+   */
+  inline opencl_buffer_pool_statistics statistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  /**
+   * Resets the hit and miss counters of the pool.
+   */
+  inline void reset_statistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.hits = 0;
+    stats_.misses = 0;
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
@@ -0,0 +1,190 @@
+#ifndef STAN_MATH_OPENCL_CALIBRATE_OFFLOAD_HPP
+#define STAN_MATH_OPENCL_CALIBRATE_OFFLOAD_HPP
+#ifdef STAN_OPENCL
+
+#include <stan/math/opencl/opencl_context.hpp>
+#include <stan/math/opencl/offload.hpp>
+#include <stan/math/opencl/matrix_cl.hpp>
+#include <stan/math/opencl/copy.hpp>
+#include <stan/math/opencl/prim/cholesky_decompose.hpp>
+#include <stan/math/opencl/prim/mdivide_left_tri_low.hpp>
+#include <stan/math/opencl/prim/multiply.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Returns the shortest time of repeated executions of a function.
+ * @tparam F type of the function
+ * @param f function to time
+ * @param repeats number of executions
+ * @return shortest time in seconds
+ */
+template <typename F>
+inline double offload_min_time(const F& f, int repeats) {
+  double best = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < repeats; i++) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    best = std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+/**
+ * Finds the smallest matrix size for which the OpenCL device, including the
+ * transfers, is faster than the host. Sizes are doubled until the device is
+ * faster and the crossover is then refined by bisection.
+ * @tparam F_host type of the host benchmark
+ * @tparam F_device type of the device benchmark
+ * @param host returns time of the host computation for given size
+ * @param device returns time of the device computation for given size
+ * @param min_size smallest size to try
+ * @param max_size largest size to try
+ * @return crossover size or `std::numeric_limits<int>::max()` if the device
+ * is not faster for any size up to `max_size`
+ */
+template <typename F_host, typename F_device>
+inline int offload_crossover(const F_host& host, const F_device& device,
+                             int min_size, int max_size) {
+  auto device_faster = [&](int n) { return device(n) < host(n); };
+  int slower = min_size / 2;
+  int faster = -1;
+  for (int n = min_size; n <= max_size; n *= 2) {
+    if (device_faster(n)) {
+      faster = n;
+      break;
+    }
+    slower = n;
+  }
+  if (faster == -1) {
+    return std::numeric_limits<int>::max();
+  }
+  while (faster - slower > std::max(1, faster / 16)) {
+    const int mid = slower + (faster - slower) / 2;
+    if (device_faster(mid)) {
+      faster = mid;
+    } else {
+      slower = mid;
+    }
+  }
+  return slower;
+}
+
+}  // namespace internal
+
+/** \ingroup opencl_offload
+ * Measures the sizes above which `multiply()`, `cholesky_decompose()` and
+ * `mdivide_left_tri_low()` on `Eigen` matrices of doubles are faster on the
+ * OpenCL device than on the host, including the time needed for transfers,
+ * and stores them in `opencl_context.tuning_opts()`.
+ *
+ * The calibration runs each operation at a number of sizes, so it can take a
+ * while for large `max_size`. Its results only depend on the hardware, so
+ * they can be saved and restored by setting the tuning options directly.
+ *
+ * @param max_size largest matrix size to try
+ * @param repeats number of timed repetitions per size, the fastest is used
+ * @throw std::domain_error if `max_size` or `repeats` is not positive
+ */
+inline void opencl_calibrate_offload(int max_size = 4096, int repeats = 3) {
+  check_positive("opencl_calibrate_offload", "max_size", max_size);
+  check_positive("opencl_calibrate_offload", "repeats", repeats);
+  using Eigen::MatrixXd;
+  using internal::offload_min_time;
+  constexpr int min_size = 16;
+  auto& opts = opencl_context.tuning_opts();
+
+  // compile the kernels before timing anything
+  {
+    MatrixXd A = MatrixXd::Identity(min_size, min_size);
+    matrix_cl<double> A_cl(A);
+    matrix_cl<double> tmp = cholesky_decompose(A_cl);
+    tmp = mdivide_left_tri_low(tmp, A_cl);
+    tmp = A_cl * tmp;
+    A = from_matrix_cl(tmp);
+  }
+
+  auto spd = [](int n) {
+    MatrixXd R = MatrixXd::Random(n, n);
+    MatrixXd A = 0.5 * (R + R.transpose());
+    A.diagonal().array() += 2.0 * n;
+    return A;
+  };
+
+  const int multiply_n = internal::offload_crossover(
+      [&](int n) {
+        MatrixXd A = MatrixXd::Random(n, n);
+        MatrixXd B = MatrixXd::Random(n, n);
+        return offload_min_time([&] { MatrixXd C = A * B; }, repeats);
+      },
+      [&](int n) {
+        MatrixXd A = MatrixXd::Random(n, n);
+        MatrixXd B = MatrixXd::Random(n, n);
+        return offload_min_time(
+            [&] {
+              matrix_cl<double> C_cl = to_matrix_cl(A) * to_matrix_cl(B);
+              MatrixXd C = from_matrix_cl(C_cl);
+            },
+            repeats);
+      },
+      min_size, max_size);
+  opts.multiply_dim_prod_worth_transfer = static_cast<int>(
+      std::min(static_cast<double>(multiply_n) * multiply_n * multiply_n,
+               static_cast<double>(std::numeric_limits<int>::max())));
+
+  opts.cholesky_size_worth_transfer = internal::offload_crossover(
+      [&](int n) {
+        MatrixXd A = spd(n);
+        return offload_min_time([&] { MatrixXd L = A.llt().matrixL(); },
+                                repeats);
+      },
+      [&](int n) {
+        MatrixXd A = spd(n);
+        return offload_min_time(
+            [&] {
+              matrix_cl<double> L_cl = cholesky_decompose(to_matrix_cl(A));
+              MatrixXd L = from_matrix_cl(L_cl);
+            },
+            repeats);
+      },
+      min_size, max_size);
+
+  opts.tri_inverse_size_worth_transfer = internal::offload_crossover(
+      [&](int n) {
+        MatrixXd A = spd(n).triangularView<Eigen::Lower>();
+        MatrixXd b = MatrixXd::Random(n, n);
+        return offload_min_time(
+            [&] {
+              MatrixXd x = A.triangularView<Eigen::Lower>().solve(b);
+            },
+            repeats);
+      },
+      [&](int n) {
+        MatrixXd A = spd(n).triangularView<Eigen::Lower>();
+        MatrixXd b = MatrixXd::Random(n, n);
+        return offload_min_time(
+            [&] {
+              matrix_cl<double> A_cl(A, matrix_cl_view::Lower);
+              matrix_cl<double> x_cl
+                  = mdivide_left_tri_low(A_cl, to_matrix_cl(b));
+              MatrixXd x = from_matrix_cl(x_cl);
+            },
+            repeats);
+      },
+      min_size, max_size);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
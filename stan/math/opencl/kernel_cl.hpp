@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <mutex>
 
 namespace stan {
 namespace math {
@@ -198,15 +199,19 @@ inline const std::vector<cl::Event> select_events(const K& m) {
 }  // namespace internal
 
 /** \ingroup kernel_executor_opencl
- * Compile an OpenCL kernel.
+ * Compile an OpenCL kernel for all devices in the context.
+ *
+ * Arguments of a kernel object must not be set from several threads at once,
+ * so each device gets its own kernel object.
  *
  * @param name The name for the kernel
  * @param sources A std::vector of strings containing the code for the kernel.
  * @param options The values of macros to be passed at compile time.
+ * @return kernel objects, one for each device in `opencl_context.devices()`
  */
-inline auto compile_kernel(const char* name,
-                           const std::vector<std::string>& sources,
-                           const std::map<std::string, int>& options) {
+inline std::vector<cl::Kernel> compile_kernel(
+    const char* name, const std::vector<std::string>& sources,
+    const std::map<std::string, int>& options) {
   auto base_opts = opencl_context.base_opts();
   for (auto& it : options) {
     if (base_opts[it.first] > it.second) {
@@ -220,9 +225,13 @@ inline auto compile_kernel(const char* name,
   }
   cl::Program program(opencl_context.context(), sources);
   try {
-    program.build({opencl_context.device()}, kernel_opts.c_str());
+    program.build(opencl_context.devices(), kernel_opts.c_str());
 
-    return cl::Kernel(program, name);
+    std::vector<cl::Kernel> kernels;
+    for (int i = 0; i < opencl_context.num_devices(); i++) {
+      kernels.emplace_back(program, name);
+    }
+    return kernels;
   } catch (const cl::Error& e) {
     // in case of CL_BUILD_PROGRAM_FAILURE, print the build error
     if (e.err() == -11) {
@@ -233,7 +242,7 @@ inline auto compile_kernel(const char* name,
       check_opencl_error(name, e);
     }
   }
-  return cl::Kernel();  // never reached because check_opencl_error throws
+  return {};  // never reached because check_opencl_error throws
 }
 
 /** \ingroup kernel_executor_opencl
@@ -247,7 +256,20 @@ struct kernel_cl {
   const char* name_;
   std::vector<std::string> sources_;
   std::map<std::string, int> opts_;
-  mutable cl::Kernel kernel_;
+  mutable std::vector<cl::Kernel> kernels_;
+
+  /** \ingroup kernel_executor_opencl
+   * Returns the kernel object for the active device, compiling the kernel
+   * on first use.
+   */
+  cl::Kernel& device_kernel() const {
+    std::unique_lock<std::mutex> lock = opencl_context.kernel_cache_lock();
+    if (kernels_.empty()) {
+      kernels_ = compile_kernel(name_, sources_, opts_);
+      opencl_context.register_kernel_cache(&kernels_);
+    }
+    return kernels_[opencl_context.active_device()];
+  }
 
  public:
   /** \ingroup kernel_executor_opencl
@@ -272,15 +294,13 @@ struct kernel_cl {
   template <typename... CallArgs>
   auto operator()(cl::NDRange global_thread_size,
                   const CallArgs&... args) const {
-    if (kernel_() == NULL) {
-      kernel_ = compile_kernel(name_, sources_, opts_);
-      opencl_context.register_kernel_cache(&kernel_);
-    }
+    cl::Kernel& kernel = device_kernel();
+    std::unique_lock<std::mutex> lock = opencl_context.device_lock();
     cl::EnqueueArgs eargs(opencl_context.queue(),
                           vec_concat(internal::select_events<Args>(args)...),
                           global_thread_size);
     cl::KernelFunctor<internal::to_const_buffer_t<Args>&...> kernel_functor(
-        kernel_);
+        kernel);
     cl::Event kern_event
         = kernel_functor(eargs, internal::get_kernel_args(args)...);
     internal::assign_events<Args...>(kern_event, args...);
@@ -299,15 +319,13 @@ struct kernel_cl {
   template <typename... CallArgs>
   auto operator()(cl::NDRange global_thread_size, cl::NDRange thread_block_size,
                   const CallArgs&... args) const {
-    if (kernel_() == NULL) {
-      kernel_ = compile_kernel(name_, sources_, opts_);
-      opencl_context.register_kernel_cache(&kernel_);
-    }
+    cl::Kernel& kernel = device_kernel();
+    std::unique_lock<std::mutex> lock = opencl_context.device_lock();
     cl::EnqueueArgs eargs(opencl_context.queue(),
                           vec_concat(internal::select_events<Args>(args)...),
                           global_thread_size, thread_block_size);
     cl::KernelFunctor<internal::to_const_buffer_t<Args>&...> kernel_functor(
-        kernel_);
+        kernel);
     cl::Event kern_event
         = kernel_functor(eargs, internal::get_kernel_args(args)...);
     internal::assign_events<Args...>(kern_event, args...);
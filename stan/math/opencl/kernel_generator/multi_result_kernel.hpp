@@ -16,6 +16,7 @@
 #include <tuple>
 #include <utility>
 #include <map>
+#include <mutex>
 #include <vector>
 
 namespace stan {
@@ -32,7 +33,7 @@ template <int N, typename... T_results>
 struct multi_result_kernel_internal {
   template <typename... T_expressions>
   struct inner {
-    static std::map<std::vector<int>, cl::Kernel> kernel_cache_;
+    static std::map<std::vector<int>, std::vector<cl::Kernel>> kernel_cache_;
     using next = typename multi_result_kernel_internal<
         N - 1, T_results...>::template inner<T_expressions...>;
     using T_current_result = std::remove_reference_t<
@@ -238,8 +239,9 @@ struct multi_result_kernel_internal<-1, T_results...> {
 
 template <int N, typename... T_results>
 template <typename... T_expressions>
-std::map<std::vector<int>, cl::Kernel> multi_result_kernel_internal<
-    N, T_results...>::inner<T_expressions...>::kernel_cache_;
+std::map<std::vector<int>, std::vector<cl::Kernel>>
+    multi_result_kernel_internal<N, T_results...>::inner<
+        T_expressions...>::kernel_cache_;
 
 }  // namespace internal
 
@@ -463,14 +465,21 @@ class results_cl {
     impl::get_unique_matrix_accesses(uids, id_map, next_id, assignment_pairs);
 
     try {
-      if (impl::kernel_cache_[uids]() == NULL) {
-        std::string src = get_kernel_source_impl(assignment_pairs);
-        auto opts = opencl_context.base_opts();
-        impl::kernel_cache_[uids] = opencl_kernels::compile_kernel(
-            "calculate", {view_kernel_helpers, src}, opts);
-        opencl_context.register_kernel_cache(&impl::kernel_cache_[uids]);
+      std::vector<cl::Kernel>* kernels;
+      {
+        std::unique_lock<std::mutex> cache_lock
+            = opencl_context.kernel_cache_lock();
+        kernels = &impl::kernel_cache_[uids];
+        if (kernels->empty()) {
+          std::string src = get_kernel_source_impl(assignment_pairs);
+          auto opts = opencl_context.base_opts();
+          *kernels = opencl_kernels::compile_kernel(
+              "calculate", {view_kernel_helpers, src}, opts);
+          opencl_context.register_kernel_cache(kernels);
+        }
       }
-      cl::Kernel& kernel = impl::kernel_cache_[uids];
+      cl::Kernel& kernel = (*kernels)[opencl_context.active_device()];
+      std::unique_lock<std::mutex> lock = opencl_context.device_lock();
       int arg_num = 0;
 
       std::map<const void*, const char*> generated;
@@ -14,6 +14,7 @@
 #include <CL/cl2.hpp>
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -42,6 +43,8 @@ template <typename T>
 class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
  private:
   cl::Buffer buffer_cl_;  // Holds the allocated memory on the device
+  // Pool the buffer is returned to, empty if it was not issued by a pool
+  std::weak_ptr<opencl_buffer_pool> buffer_pool_;
   int rows_{0};           // Number of rows.
   int cols_{0};           // Number of columns.
   // Holds info on if matrix is a special type
@@ -184,7 +187,11 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
    */
   matrix_cl(const cl::Buffer& A, const int R, const int C,
             matrix_cl_view partial_view = matrix_cl_view::Entire)
-      : buffer_cl_(A), rows_(R), cols_(C), view_(partial_view) {}
+      : buffer_cl_(A), rows_(R), cols_(C), view_(partial_view) {
+    if (opencl_context.buffer_pool().share(buffer_cl_)) {
+      buffer_pool_ = opencl_context.buffer_pool_ref();
+    }
+  }
 
   /**
    * Copy constructor.
@@ -195,8 +202,7 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
     if (A.size() == 0) {
       return;
     }
-    buffer_cl_ = cl::Buffer(opencl_context.context(), CL_MEM_READ_WRITE,
-                            sizeof(T) * this->size());
+    allocate_buffer();
     initialize_buffer_cl(A);
   }
 
@@ -206,6 +212,7 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
    */
   matrix_cl(matrix_cl<T>&& A)
       : buffer_cl_(std::move(A.buffer_cl_)),
+        buffer_pool_(std::move(A.buffer_pool_)),
         rows_(A.rows_),
         cols_(A.cols_),
         view_(A.view_),
@@ -238,9 +245,8 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
     if (this->size() == 0) {
       return;
     }
-    cl::Context& ctx = opencl_context.context();
     cl::CommandQueue& queue = opencl_context.queue();
-    buffer_cl_ = cl::Buffer(ctx, CL_MEM_READ_WRITE, sizeof(T) * size());
+    allocate_buffer();
     for (int i = 0, offset_size = 0; i < cols_; i++, offset_size += rows_) {
       check_size_match("matrix constructor", "input rows", A[i].size(),
                        "matrix_cl rows", rows_);
@@ -275,13 +281,12 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
     if (size() == 0) {
       return;
     }
-    cl::Context& ctx = opencl_context.context();
     try {
-      int flags = CL_MEM_READ_WRITE;
+      cl_mem_flags flags = CL_MEM_READ_WRITE;
       if (opencl_context.device()[0].getInfo<CL_DEVICE_HOST_UNIFIED_MEMORY>()) {
         flags |= CL_MEM_ALLOC_HOST_PTR;
       }
-      buffer_cl_ = cl::Buffer(ctx, flags, sizeof(T) * rows_ * cols_);
+      allocate_buffer(flags);
     } catch (const cl::Error& e) {
       check_opencl_error("matrix constructor", e);
     }
@@ -427,7 +432,9 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
     rows_ = a.rows();
     cols_ = a.cols();
     this->wait_for_read_write_events();
+    release_buffer();
     buffer_cl_ = std::move(a.buffer_cl_);
+    buffer_pool_ = std::move(a.buffer_pool_);
     write_events_ = std::move(a.write_events_);
     read_events_ = std::move(a.read_events_);
     return *this;
@@ -444,12 +451,13 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
       return *this;
     }
     this->wait_for_read_write_events();
-    if (size() != a.size()) {
-      buffer_cl_ = cl::Buffer(opencl_context.context(), CL_MEM_READ_WRITE,
-                              sizeof(T) * a.size());
-    }
+    const bool reallocate = size() != a.size();
     this->rows_ = a.rows();
     this->cols_ = a.cols();
+    if (reallocate) {
+      release_buffer();
+      allocate_buffer();
+    }
     initialize_buffer_cl(a);
     return *this;
   }
@@ -473,9 +481,13 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
 
   /**
    * Destructor waits for write events to prevent any kernels from writing
-   * memory that has already been reused.
+   * memory that has already been reused and returns the buffer to the buffer
+   * pool of the OpenCL context.
    */
-  ~matrix_cl() { wait_for_read_write_events(); }
+  ~matrix_cl() {
+    wait_for_read_write_events();
+    release_buffer();
+  }
 
  private:
   /**
@@ -498,10 +510,9 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
     if (size() == 0) {
       return transfer_event;
     }
-    cl::Context& ctx = opencl_context.context();
     cl::CommandQueue& queue = opencl_context.queue();
     try {
-      buffer_cl_ = cl::Buffer(ctx, CL_MEM_READ_WRITE, sizeof(T) * size());
+      allocate_buffer();
       queue.enqueueWriteBuffer(buffer_cl_,
                                opencl_context.in_order() || in_order, 0,
                                sizeof(T) * size(), A, nullptr, &transfer_event);
@@ -526,7 +537,7 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
             = cl::Buffer(ctx, CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR,
                          sizeof(T) * size(), A);  // this is always synchronous
       } else {
-        buffer_cl_ = cl::Buffer(ctx, CL_MEM_READ_WRITE, sizeof(T) * size());
+        allocate_buffer();
         queue.enqueueWriteBuffer(
             buffer_cl_, opencl_context.in_order() || in_order, 0,
             sizeof(T) * size(), A, nullptr, &transfer_event);
@@ -601,6 +612,30 @@ class matrix_cl<T, require_arithmetic_t<T>> : public matrix_cl_base {
     }
   }
 
+  /**
+   * Allocates a buffer of size of this matrix from the buffer pool of the
+   * OpenCL context.
+   * @param flags memory flags of the buffer
+   */
+  void allocate_buffer(cl_mem_flags flags = CL_MEM_READ_WRITE) {
+    buffer_cl_ = opencl_context.buffer_pool().acquire(
+        opencl_context.context(), flags, sizeof(T) * size());
+    buffer_pool_ = opencl_context.buffer_pool_ref();
+  }
+
+  /**
+   * Returns the buffer of this matrix to the buffer pool it was issued by,
+   * unless that pool was destroyed with its OpenCL context. All operations
+   * using the buffer must be complete.
+   */
+  void release_buffer() {
+    std::shared_ptr<opencl_buffer_pool> pool = buffer_pool_.lock();
+    if (pool) {
+      pool->release(std::move(buffer_cl_));
+    }
+    buffer_pool_.reset();
+  }
+
   /**
    * Deletes the container. Used as a callback for OpenCL event.
    * @tparam U type of container
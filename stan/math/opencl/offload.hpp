@@ -0,0 +1,121 @@
+#ifndef STAN_MATH_OPENCL_OFFLOAD_HPP
+#define STAN_MATH_OPENCL_OFFLOAD_HPP
+#ifdef STAN_OPENCL
+
+#include <stan/math/opencl/opencl_context.hpp>
+#include <stan/math/opencl/matrix_cl.hpp>
+#include <stan/math/opencl/copy.hpp>
+#include <stan/math/opencl/shard.hpp>
+#include <stan/math/opencl/prim/cholesky_decompose.hpp>
+#include <stan/math/opencl/prim/mdivide_left_tri_low.hpp>
+#include <stan/math/opencl/prim/multiply.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/cholesky_decompose.hpp>
+#include <stan/math/prim/fun/mdivide_left_tri.hpp>
+#include <stan/math/prim/fun/multiply.hpp>
+
+namespace stan {
+namespace math {
+
+/** \ingroup opencl
+ * \defgroup opencl_offload Automatic offloading to the OpenCL device
+ *
+ * Some functions on `Eigen` matrices of doubles move the computation to the
+ * OpenCL device when it is predicted to be faster, including the time needed
+ * to transfer the arguments to and the result from the device. The
+ * predictions compare the size of the problem with crossover sizes in
+ * `opencl_context.tuning_opts()`. The defaults are the crossover sizes these
+ * tuning options have always had and can be replaced with sizes measured on
+ * the local device by `opencl_calibrate_offload()`.
+ *
+ * With OpenCL enabled, `multiply()` of matrices of doubles returns a plain
+ * matrix instead of a product expression, as whether the product is computed
+ * on the device is only decided at runtime.
+ * @{
+ */
+
+/**
+ * Whether a product of a `m x k` and a `k x n` matrix of doubles is expected
+ * to be faster on the OpenCL device, including the transfers.
+ * @param m number of rows of the first matrix
+ * @param k number of columns of the first matrix
+ * @param n number of columns of the second matrix
+ * @return whether to compute the product on the OpenCL device
+ */
+inline bool opencl_offload_multiply(int m, int k, int n) {
+  return static_cast<double>(m) * k * n
+         > opencl_context.tuning_opts().multiply_dim_prod_worth_transfer;
+}
+
+/**
+ * Whether the Cholesky decomposition of a `n x n` matrix of doubles is
+ * expected to be faster on the OpenCL device, including the transfers.
+ * @param n size of the matrix
+ * @return whether to decompose the matrix on the OpenCL device
+ */
+inline bool opencl_offload_cholesky_decompose(int n) {
+  return n > opencl_context.tuning_opts().cholesky_size_worth_transfer;
+}
+
+/**
+ * Whether solving a system with a lower triangular `n x n` matrix of doubles
+ * is expected to be faster on the OpenCL device, including the transfers.
+ * @param n size of the matrix
+ * @return whether to solve the system on the OpenCL device
+ */
+inline bool opencl_offload_tri_inverse(int n) {
+  return n > opencl_context.tuning_opts().tri_inverse_size_worth_transfer;
+}
+
+namespace internal {
+
+/*
+ * The following functions are declared by the prim functions that offload
+ * to the OpenCL device. They are defined here so that prim does not include
+ * the OpenCL backend.
+ */
+
+template <typename Mat1, typename Mat2, typename T_return,
+          require_all_vt_same<double, Mat1, Mat2>*>
+inline T_return multiply_offload(const Mat1& m1, const Mat2& m2) {
+  if (opencl_offload_multiply(m1.rows(), m1.cols(), m2.cols())) {
+    if (opencl_context.num_devices() > 1) {
+      return opencl_sharded_multiply<T_return>(m1, m2);
+    }
+    matrix_cl<double> res_cl = to_matrix_cl(m1) * to_matrix_cl(m2);
+    return from_matrix_cl<T_return>(res_cl);
+  }
+  return m1 * m2;
+}
+
+template <typename EigMat, typename T_L, require_vt_same<double, EigMat>*>
+inline bool cholesky_decompose_offload(const EigMat& m, T_L& L) {
+  if (!opencl_offload_cholesky_decompose(m.rows())) {
+    return false;
+  }
+  matrix_cl<double> L_cl = cholesky_decompose(to_matrix_cl(m));
+  L = from_matrix_cl<T_L>(L_cl);
+  return true;
+}
+
+template <Eigen::UpLoType TriView, typename T1, typename T2, typename T_res,
+          require_all_vt_same<double, T1, T2>*>
+inline bool mdivide_left_tri_offload(const T1& A, const T2& b, T_res& res) {
+  if (TriView != Eigen::Lower || !opencl_offload_tri_inverse(A.rows())) {
+    return false;
+  }
+  matrix_cl<double> A_cl(A, matrix_cl_view::Lower);
+  matrix_cl<double> res_cl = mdivide_left_tri_low(A_cl, to_matrix_cl(b));
+  res = from_matrix_cl<T_res>(res_cl);
+  return true;
+}
+
+}  // namespace internal
+
+/** @}*/
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
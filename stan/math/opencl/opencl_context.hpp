@@ -11,6 +11,7 @@
 #endif
 
 #include <stan/math/opencl/matrix_cl_view.hpp>
+#include <stan/math/opencl/buffer_pool.hpp>
 #include <stan/math/opencl/err/check_opencl.hpp>
 
 #include <CL/cl2.hpp>
@@ -19,8 +20,12 @@
 #include <fstream>
 #include <map>
 #include <vector>
+#include <algorithm>
 #include <cmath>
 #include <cerrno>
+#include <limits>
+#include <memory>
+#include <mutex>
 
 /** \ingroup opencl
  *  \defgroup opencl_context_group OpenCL Context
@@ -47,8 +52,10 @@ namespace math {
  * Some design decisions that may need to be addressed later:
  * - we are assuming a single OpenCL platform. We may want to run on multiple
  * platforms simultaneously
- * - we are assuming a single OpenCL device. We may want to run on multiple
- * devices simultaneously
+ * - several devices of the platform can share the context (see
+ * `opencl_context::select_devices()`). Kernels run on the active device of the
+ * calling thread, which is the first device unless changed with
+ * `opencl_device_scope`.
  */
 class opencl_context_base {
   friend class opencl_context;
@@ -72,9 +79,65 @@ class opencl_context_base {
    * @throw std::system_error if an OpenCL error occurs.
    */
   opencl_context_base(int platform_id = OPENCL_PLATFORM_ID,
-                      int device_id = OPENCL_DEVICE_ID) {
+                      int device_id = OPENCL_DEVICE_ID)
+      : opencl_context_base(platform_id, std::vector<int>{device_id}) {}
+
+  /** \ingroup opencl_context_group
+   * Construct the opencl_context with several devices of the same platform.
+   * All devices share one OpenCL context, so kernels and buffers can be used
+   * on any of them. Each device gets its own command queue. The first device
+   * is the one used by default.
+   *
+   * Kernel parameters are set so that the kernels can run on all devices.
+   *
+   * @param platform_id id of the OpenCL platform to use
+   * @param device_ids ids of the OpenCL devices to use
+   * @throw std::system_error if an OpenCL error occurs.
+   */
+  opencl_context_base(int platform_id, const std::vector<int>& device_ids) {
+    init_platform(platform_id);
+    if (device_ids.empty()) {
+      system_error("OpenCL Initialization", "[Device]", -1,
+                   "CL_INVALID_DEVICE");
+    }
+    for (int i = 0; i < device_ids.size(); i++) {
+      if (device_ids[i] < 0 || device_ids[i] >= devices_.size()
+          || std::count(device_ids.begin(), device_ids.begin() + i,
+                        device_ids[i])) {
+        system_error("OpenCL Initialization", "[Device]", -1,
+                     "CL_INVALID_DEVICE");
+      }
+      context_devices_.push_back(devices_[device_ids[i]]);
+    }
+    init_context();
+  }
+
+  /** \ingroup opencl_context_group
+   * Construct the opencl_context with given devices of a platform. These can
+   * be sub-devices created by `cl::Device::createSubDevices()`, so that
+   * several devices of the context share one physical device.
+   *
+   * @param platform_id id of the OpenCL platform the devices are part of
+   * @param devices the OpenCL devices to use
+   * @throw std::system_error if an OpenCL error occurs.
+   */
+  opencl_context_base(int platform_id, const std::vector<cl::Device>& devices) {
+    init_platform(platform_id);
+    if (devices.empty()) {
+      system_error("OpenCL Initialization", "[Device]", -1,
+                   "CL_INVALID_DEVICE");
+    }
+    context_devices_ = devices;
+    init_context();
+  }
+
+  /** \ingroup opencl_context_group
+   * Selects the platform with given id and gets its devices.
+   * @param platform_id id of the OpenCL platform to use
+   * @throw std::system_error if an OpenCL error occurs.
+   */
+  void init_platform(int platform_id) {
     try {
-      // platform
       cl::Platform::get(&platforms_);
       if (platform_id >= platforms_.size()) {
         system_error("OpenCL Initialization", "[Platform]", -1,
@@ -87,34 +150,55 @@ class opencl_context_base {
         system_error("OpenCL Initialization", "[Device]", -1,
                      "CL_DEVICE_NOT_FOUND");
       }
-      if (device_id >= devices_.size()) {
-        system_error("OpenCL Initialization", "[Device]", -1,
-                     "CL_INVALID_DEVICE");
-      }
-      device_.push_back(devices_[device_id]);
-      // context and queue
-      cl_command_queue_properties device_properties;
-      device_[0].getInfo<cl_command_queue_properties>(
-          CL_DEVICE_QUEUE_PROPERTIES, &device_properties);
-      device_[0].getInfo<size_t>(CL_DEVICE_MAX_WORK_GROUP_SIZE,
-                                 &max_thread_block_size_);
-      std::vector<size_t> max_wg_sizes
-          = device_[0].getInfo<CL_DEVICE_MAX_WORK_ITEM_SIZES>();
-      if (max_wg_sizes.size() < 3) {
-        system_error("OpenCL Initialization", "[Device]", -1,
-                     "The device does not support 3D work groups!");
+    } catch (const cl::Error& e) {
+      check_opencl_error("opencl_context", e);
+    }
+  }
+
+  /** \ingroup opencl_context_group
+   * Creates the OpenCL context and a command queue for each device in
+   * `context_devices_` and sets kernel parameters so that the kernels can run
+   * on all of them.
+   * @throw std::system_error if an OpenCL error occurs.
+   */
+  void init_context() {
+    try {
+      device_.push_back(context_devices_[0]);
+      // context and queues
+      bool out_of_order = true;
+      max_thread_block_size_ = std::numeric_limits<size_t>::max();
+      std::vector<size_t> max_wg_sizes(3, std::numeric_limits<size_t>::max());
+      for (cl::Device& device : context_devices_) {
+        cl_command_queue_properties device_properties;
+        device.getInfo<cl_command_queue_properties>(CL_DEVICE_QUEUE_PROPERTIES,
+                                                    &device_properties);
+        out_of_order = out_of_order
+                       && (device_properties
+                           & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+        max_thread_block_size_
+            = std::min(max_thread_block_size_,
+                       device.getInfo<CL_DEVICE_MAX_WORK_GROUP_SIZE>());
+        std::vector<size_t> device_wg_sizes
+            = device.getInfo<CL_DEVICE_MAX_WORK_ITEM_SIZES>();
+        if (device_wg_sizes.size() < 3) {
+          system_error("OpenCL Initialization", "[Device]", -1,
+                       "The device does not support 3D work groups!");
+        }
+        for (int i = 0; i < 3; i++) {
+          max_wg_sizes[i] = std::min(max_wg_sizes[i], device_wg_sizes[i]);
+        }
       }
 
-      context_ = cl::Context(device_[0]);
-      if (device_properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) {
-        command_queue_
-            = cl::CommandQueue(context_, device_[0],
-                               CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, nullptr);
-        in_order_ = CL_FALSE;
-      } else {
-        command_queue_ = cl::CommandQueue(context_, device_[0], 0, nullptr);
-        in_order_ = CL_TRUE;
+      context_ = cl::Context(context_devices_);
+      for (cl::Device& device : context_devices_) {
+        command_queues_.emplace_back(
+            context_, device,
+            out_of_order ? CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE : 0,
+            nullptr);
+        device_mutexes_.emplace_back(new std::mutex());
+        compute_units_.push_back(device.getInfo<CL_DEVICE_MAX_COMPUTE_UNITS>());
       }
+      in_order_ = out_of_order ? CL_FALSE : CL_TRUE;
       int max_square_block_size
           = std::min({max_wg_sizes[0], max_wg_sizes[1],
                       static_cast<size_t>(std::sqrt(max_thread_block_size_))});
@@ -149,11 +233,15 @@ class opencl_context_base {
 
  protected:
   cl::Context context_;  // Manages the the device, queue, platform, memory, etc
-  cl::CommandQueue command_queue_;       // job queue for device, one per device
+  std::vector<cl::CommandQueue> command_queues_;  // job queues, one per device
+  // Guard setting kernel arguments and enqueueing, one per device
+  std::vector<std::unique_ptr<std::mutex>> device_mutexes_;
   std::vector<cl::Platform> platforms_;  // Vector of available platforms
   std::vector<cl::Platform> platform_;   // The platform for compiling kernels
   std::string platform_name_;  // The platform such as NVIDIA OpenCL or AMD SDK
   std::vector<cl::Device> device_;   // The selected OpenCL device
+  std::vector<cl::Device> context_devices_;  // All devices in the context
+  std::vector<int> compute_units_;  // Compute units of each context device
   std::vector<cl::Device> devices_;  // All available OpenCL devices
   std::string device_name_;          // The name of OpenCL device
   size_t max_thread_block_size_;  // The maximum size of a block of workers on
@@ -170,11 +258,13 @@ class opencl_context_base {
          {"WORK_PER_THREAD", 8},
          {"REDUCTION_STEP_SIZE", 4},
          {"LOCAL_SIZE_", 64}};
-  // TODO(Steve): Make these tunable during warmup
+  // Crossover sizes used for offloading operations on Eigen matrices (see
+  // math/opencl/offload) can be measured with opencl_calibrate_offload()
   struct tuning_struct {
     // Used in math/opencl/cholesky_decompose
     int cholesky_min_L11_size = 256;
     int cholesky_partition = 4;
+    // used in math/prim/fun/cholesky_decompose
     int cholesky_size_worth_transfer = 1250;
     // Used in math/rev/fun/cholesky_decompose
     int cholesky_rev_min_block_size = 512;
@@ -185,12 +275,13 @@ class opencl_context_base {
     double gp_exp_quad_cov_complex = 1'000'000;
     double gp_exp_quad_cov_simple = 1'250;
     // used in math/prim/fun/multiply
-    // and math/rev/fun/multiply
     int multiply_dim_prod_worth_transfer = 2000000;
     // used in math/prim/fun/mdivide_left_tri
-    // and math/rev/fun/mdivide_left_tri
     int tri_inverse_size_worth_transfer = 100;
   } tuning_opts_;
+  // Unused device buffers for reuse, destroyed with the context
+  std::shared_ptr<opencl_buffer_pool> buffer_pool_
+      = std::make_shared<opencl_buffer_pool>();
 
  protected:
   static opencl_context_base& getInstance() {
@@ -198,8 +289,18 @@ class opencl_context_base {
     return instance_;
   }
 
-  static void select_device(int platform_id, int device_id) {
-    getInstance() = opencl_context_base(platform_id, device_id);
+  /**
+   * Index of the device the calling thread enqueues its work to.
+   */
+  static int& active_device() {
+    static thread_local int active_device_ = 0;
+    return active_device_;
+  }
+
+  template <typename T_devices>
+  static void select_devices(int platform_id, const T_devices& devices) {
+    getInstance() = opencl_context_base(platform_id, devices);
+    active_device() = 0;
   }
 };
 
@@ -207,7 +308,7 @@ class opencl_context_base {
  * The API to access the methods and values in opencl_context_base
  */
 class opencl_context {
-  std::vector<cl::Kernel*> kernel_caches_;
+  std::vector<std::vector<cl::Kernel>*> kernel_caches_;
 
  public:
   opencl_context() = default;
@@ -358,9 +459,12 @@ class opencl_context {
    * Returns the reference to the active OpenCL command queue for the device.
    * One command queue will exist per device where
    * kernels are placed on the command queue and by default executed in order.
+   * If the context has several devices, this is the queue of the active
+   * device of the calling thread.
    */
   inline cl::CommandQueue& queue() {
-    return opencl_context_base::getInstance().command_queue_;
+    return opencl_context_base::getInstance()
+        .command_queues_[opencl_context_base::active_device()];
   }
   /** \ingroup opencl_context_group
    * Returns a copy of the map of kernel defines
@@ -386,6 +490,22 @@ class opencl_context {
     return opencl_context_base::getInstance().tuning_opts_;
   }
 
+  /** \ingroup opencl_context_group
+   * Returns the pool of device buffers that `matrix_cl` allocates from.
+   */
+  inline opencl_buffer_pool& buffer_pool() {
+    return *opencl_context_base::getInstance().buffer_pool_;
+  }
+
+  /** \ingroup opencl_context_group
+   * Returns a weak reference to the pool of device buffers. It expires when
+   * the context is destroyed, at program exit or when another device is
+   * selected, possibly before some `matrix_cl` objects holding its buffers.
+   */
+  inline std::weak_ptr<opencl_buffer_pool> buffer_pool_ref() {
+    return opencl_context_base::getInstance().buffer_pool_;
+  }
+
   /** \ingroup opencl_context_group
    * Returns a vector containing the OpenCL device used to create the context
    */
@@ -393,6 +513,77 @@ class opencl_context {
     return opencl_context_base::getInstance().device_;
   }
 
+  /** \ingroup opencl_context_group
+   * Returns a vector containing all OpenCL devices in the context. The first
+   * one is the device returned by `device()`.
+   */
+  inline std::vector<cl::Device>& devices() {
+    return opencl_context_base::getInstance().context_devices_;
+  }
+
+  /** \ingroup opencl_context_group
+   * Returns the number of compute units of each device in `devices()`.
+   */
+  inline const std::vector<int>& compute_units() {
+    return opencl_context_base::getInstance().compute_units_;
+  }
+
+  /** \ingroup opencl_context_group
+   * Returns the number of OpenCL devices in the context.
+   */
+  inline int num_devices() {
+    return opencl_context_base::getInstance().context_devices_.size();
+  }
+
+  /** \ingroup opencl_context_group
+   * Returns the index (into `devices()`) of the device the calling thread
+   * enqueues its work to.
+   */
+  inline int active_device() const {
+    return opencl_context_base::active_device();
+  }
+
+  /** \ingroup opencl_context_group
+   * Sets the device the calling thread enqueues its work to. Prefer
+   * `opencl_device_scope`, which also restores the previous device.
+   *
+   * `matrix_cl` objects can be used on any device in the context, but all
+   * operations that use the same `matrix_cl` should be enqueued from one
+   * device.
+   * @param device_index index into `devices()`, must be smaller than
+   * `num_devices()`
+   */
+  inline void set_active_device(int device_index) {
+    opencl_context_base::active_device() = device_index;
+  }
+
+  /** \ingroup opencl_context_group
+   * Returns a lock for looking up and compiling cached kernels. If the
+   * context has a single device the lock does not lock anything.
+   */
+  inline std::unique_lock<std::mutex> kernel_cache_lock() {
+    static std::mutex kernel_cache_mutex;
+    if (num_devices() > 1) {
+      return std::unique_lock<std::mutex>(kernel_cache_mutex);
+    }
+    return std::unique_lock<std::mutex>();
+  }
+
+  /** \ingroup opencl_context_group
+   * Returns a lock for setting the arguments of and enqueueing a cached
+   * kernel on the active device. Threads enqueueing to different devices use
+   * different kernel objects and do not wait for each other. If the context
+   * has a single device the lock does not lock anything.
+   */
+  inline std::unique_lock<std::mutex> device_lock() {
+    if (num_devices() > 1) {
+      return std::unique_lock<std::mutex>(
+          *opencl_context_base::getInstance()
+               .device_mutexes_[opencl_context_base::active_device()]);
+    }
+    return std::unique_lock<std::mutex>();
+  }
+
   /** \ingroup opencl_context_group
    * Returns a vector containing the OpenCL platform used to create the context
    */
@@ -416,19 +607,58 @@ class opencl_context {
    * @param instance_id if of the device
    */
   inline void select_device(int platform_id, int instance_id) {
-    for (cl::Kernel* cache : kernel_caches_) {
-      *cache = cl::Kernel();
+    for (std::vector<cl::Kernel>* cache : kernel_caches_) {
+      cache->clear();
+    }
+    kernel_caches_.clear();
+    opencl_context_base::select_devices(platform_id,
+                                        std::vector<int>{instance_id});
+  }
+
+  /**
+   * Selects several OpenCL devices of one platform to use from now on. Large
+   * offloaded products of `Eigen` matrices are sharded across them (see
+   * `opencl_shard`), everything else runs on the first device.
+   *
+   * No `matrix_cl` objects or created before this call should be used after the
+   * call (including any that might be on the AD stack)!
+   * @param platform_id id of the platform the devices are part of
+   * @param device_ids ids of the devices
+   */
+  inline void select_devices(int platform_id,
+                             const std::vector<int>& device_ids) {
+    for (std::vector<cl::Kernel>* cache : kernel_caches_) {
+      cache->clear();
+    }
+    kernel_caches_.clear();
+    opencl_context_base::select_devices(platform_id, device_ids);
+  }
+
+  /**
+   * Selects given OpenCL devices of one platform to use from now on. These
+   * can be sub-devices created by `cl::Device::createSubDevices()`.
+   * Otherwise the same as `select_devices()` with device ids.
+   *
+   * No `matrix_cl` objects or created before this call should be used after the
+   * call (including any that might be on the AD stack)!
+   * @param platform_id id of the platform the devices are part of
+   * @param devices the devices
+   */
+  inline void select_devices(int platform_id,
+                             const std::vector<cl::Device>& devices) {
+    for (std::vector<cl::Kernel>* cache : kernel_caches_) {
+      cache->clear();
     }
     kernel_caches_.clear();
-    opencl_context_base::select_device(platform_id, instance_id);
+    opencl_context_base::select_devices(platform_id, devices);
   }
 
   /**
    * Registers a cached kernel. The cache will be invalidated if a new OpenCL
    * device is selected.
-   * @param cache pointer to a cached kernel.
+   * @param cache pointer to cached kernel objects, one for each device.
    */
-  inline void register_kernel_cache(cl::Kernel* cache) {
+  inline void register_kernel_cache(std::vector<cl::Kernel>* cache) {
     kernel_caches_.push_back(cache);
   }
 };
@@ -97,6 +97,9 @@
 #include <stan/math/opencl/to_ref_for_opencl.hpp>
 #include <stan/math/opencl/value_type.hpp>
 #include <stan/math/opencl/zeros_strict_tri.hpp>
+#include <stan/math/opencl/offload.hpp>
+#include <stan/math/opencl/calibrate_offload.hpp>
+#include <stan/math/opencl/shard.hpp>
 
 #include <stan/math/opencl/prim/add_diag.hpp>
 #include <stan/math/opencl/prim/append_array.hpp>
@@ -131,7 +134,9 @@
 #include <stan/math/opencl/prim/double_exponential_lpdf.hpp>
 #include <stan/math/opencl/prim/exp_mod_normal_lpdf.hpp>
 #include <stan/math/opencl/prim/exponential_lpdf.hpp>
+#include <stan/math/opencl/prim/fma.hpp>
 #include <stan/math/opencl/prim/frechet_lpdf.hpp>
+#include <stan/math/opencl/prim/fuse_elementwise.hpp>
 #include <stan/math/opencl/prim/gamma_lpdf.hpp>
 #include <stan/math/opencl/prim/gp_exp_quad_cov.hpp>
 #include <stan/math/opencl/prim/gumbel_lpdf.hpp>
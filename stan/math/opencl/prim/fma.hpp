@@ -0,0 +1,39 @@
+#ifndef STAN_MATH_OPENCL_PRIM_FMA_HPP
+#define STAN_MATH_OPENCL_PRIM_FMA_HPP
+#ifdef STAN_OPENCL
+#include <stan/math/opencl/matrix_cl.hpp>
+#include <stan/math/opencl/kernel_generator.hpp>
+#include <stan/math/prim/meta.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the elementwise product of the first two arguments plus the third
+ * argument. The result is a kernel generator expression, so it is evaluated
+ * in a single kernel together with any expression it is part of.
+ *
+ * @tparam T_x type of the first argument
+ * @tparam T_y type of the second argument
+ * @tparam T_z type of the third argument
+ * @param x First argument.
+ * @param y Second argument.
+ * @param z Third argument.
+ * @return The elementwise product of the first two arguments plus the third
+ * argument.
+ * @throw std::invalid_argument if the non-scalar arguments do not have
+ * matching dimensions
+ */
+template <typename T_x, typename T_y, typename T_z,
+          require_all_kernel_expressions_t<T_x, T_y, T_z>* = nullptr,
+          require_any_not_stan_scalar_t<T_x, T_y, T_z>* = nullptr>
+inline auto fma(T_x&& x, T_y&& y, T_z&& z) {
+  return elt_multiply(std::forward<T_x>(x), std::forward<T_y>(y))
+         + std::forward<T_z>(z);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
@@ -0,0 +1,35 @@
+#ifndef STAN_MATH_OPENCL_PRIM_FUSE_ELEMENTWISE_HPP
+#define STAN_MATH_OPENCL_PRIM_FUSE_ELEMENTWISE_HPP
+#ifdef STAN_OPENCL
+#include <stan/math/opencl/kernel_generator.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <utility>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the elementwise function `f` of the arguments. Without reverse
+ * mode arguments this is just `f(args...)`, a kernel generator expression
+ * that is evaluated in a single kernel together with any expression it is
+ * part of.
+ *
+ * @tparam F type of the function
+ * @tparam Args types of the arguments
+ * @param f generic function of kernel generator expressions, built from
+ * elementwise operations
+ * @param args arguments
+ * @return `f` applied to the arguments
+ */
+template <typename F, typename... Args,
+          require_all_kernel_expressions_t<Args...>* = nullptr,
+          require_any_not_stan_scalar_t<Args...>* = nullptr>
+inline auto fuse_elementwise(const F& f, Args&&... args) {
+  return f(std::forward<Args>(args)...);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
@@ -46,9 +46,11 @@
 #include <stan/math/opencl/rev/fabs.hpp>
 #include <stan/math/opencl/rev/fdim.hpp>
 #include <stan/math/opencl/rev/floor.hpp>
+#include <stan/math/opencl/rev/fma.hpp>
 #include <stan/math/opencl/rev/fmax.hpp>
 #include <stan/math/opencl/rev/fmin.hpp>
 #include <stan/math/opencl/rev/fmod.hpp>
+#include <stan/math/opencl/rev/fuse_elementwise.hpp>
 #include <stan/math/opencl/rev/hypot.hpp>
 #include <stan/math/opencl/rev/inv.hpp>
 #include <stan/math/opencl/rev/inv_cloglog.hpp>
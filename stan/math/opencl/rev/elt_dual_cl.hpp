@@ -0,0 +1,289 @@
+#ifndef STAN_MATH_OPENCL_REV_ELT_DUAL_CL_HPP
+#define STAN_MATH_OPENCL_REV_ELT_DUAL_CL_HPP
+#ifdef STAN_OPENCL
+
+#include <stan/math/opencl/kernel_generator.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace stan {
+namespace math {
+namespace internal {
+// kept apart from internal, where rev functions call exp() etc. unqualified
+namespace elt_dual {
+
+/**
+ * Tangent of an expression that does not depend on the seeded argument.
+ * Operations on it are dropped at compile time, so they do not end up in
+ * the generated kernel.
+ */
+struct zero_tangent_cl {};
+
+/**
+ * Pair of kernel generator expressions for the value of an elementwise
+ * function and for its derivative in the seeded direction.
+ *
+ * <p>Evaluating an elementwise function on `elt_dual_cl` arguments
+ * builds, at compile time, the expression for its derivative from the
+ * derivatives of the operations it is made of. Both expressions only
+ * depend on the values of the arguments and the seed, so they are
+ * evaluated in a single kernel.
+ *
+ * @tparam T_val type of the expression for the value
+ * @tparam T_tan type of the expression for the derivative
+ */
+template <typename T_val, typename T_tan>
+class elt_dual_cl {
+  T_val val_;
+  T_tan tan_;
+
+ public:
+  elt_dual_cl(T_val&& val, T_tan&& tan)
+      : val_(std::move(val)), tan_(std::move(tan)) {}
+
+  /**
+   * Return a copy of the expression for the value, so expressions built
+   * from it do not refer to this object.
+   */
+  inline auto val() const { return val_.deep_copy(); }
+
+  /**
+   * Return a copy of the expression for the derivative, so expressions
+   * built from it do not refer to this object.
+   */
+  inline auto tan() const { return copy_tangent(tan_); }
+
+ private:
+  static inline zero_tangent_cl copy_tangent(zero_tangent_cl) { return {}; }
+  template <typename T>
+  static inline auto copy_tangent(const T& tan) {
+    return tan.deep_copy();
+  }
+};
+
+/**
+ * Make an `elt_dual_cl` from the expressions for the value and the
+ * derivative.
+ */
+template <typename T_val, typename T_tan>
+inline auto make_elt_dual(T_val&& val, T_tan&& tan) {
+  return elt_dual_cl<std::decay_t<T_val>, std::decay_t<T_tan>>(
+      std::forward<T_val>(val), std::forward<T_tan>(tan));
+}
+
+/**
+ * Return the argument of an operation on duals as a dual. Kernel
+ * generator expressions and scalars do not depend on the seeded
+ * argument.
+ */
+template <typename T_val, typename T_tan>
+inline const elt_dual_cl<T_val, T_tan>& to_elt_dual(
+    const elt_dual_cl<T_val, T_tan>& a) {
+  return a;
+}
+template <typename T, require_all_kernel_expressions_t<T>* = nullptr>
+inline auto to_elt_dual(T&& a) {
+  return make_elt_dual(as_operation_cl(std::forward<T>(a)).deep_copy(),
+                       zero_tangent_cl{});
+}
+
+template <typename T_a, typename T_b>
+inline auto add_tangents(T_a&& a, T_b&& b) {
+  return std::forward<T_a>(a) + std::forward<T_b>(b);
+}
+template <typename T_b>
+inline T_b add_tangents(zero_tangent_cl, T_b&& b) {
+  return std::forward<T_b>(b);
+}
+template <typename T_a>
+inline T_a add_tangents(T_a&& a, zero_tangent_cl) {
+  return std::forward<T_a>(a);
+}
+inline zero_tangent_cl add_tangents(zero_tangent_cl, zero_tangent_cl) {
+  return {};
+}
+
+template <typename T>
+inline auto negate_tangent(T&& a) {
+  return -std::forward<T>(a);
+}
+inline zero_tangent_cl negate_tangent(zero_tangent_cl) { return {}; }
+
+template <typename T_a, typename T_b>
+inline auto subtract_tangents(T_a&& a, T_b&& b) {
+  return add_tangents(std::forward<T_a>(a),
+                      negate_tangent(std::forward<T_b>(b)));
+}
+
+template <typename T, typename T_factor>
+inline auto scale_tangent(T&& a, T_factor&& factor) {
+  return elt_multiply(std::forward<T>(a), std::forward<T_factor>(factor));
+}
+template <typename T_factor>
+inline zero_tangent_cl scale_tangent(zero_tangent_cl, T_factor&&) {
+  return {};
+}
+
+template <typename T, typename T_divisor>
+inline auto divide_tangent(T&& a, T_divisor&& divisor) {
+  return elt_divide(std::forward<T>(a), std::forward<T_divisor>(divisor));
+}
+template <typename T_divisor>
+inline zero_tangent_cl divide_tangent(zero_tangent_cl, T_divisor&&) {
+  return {};
+}
+
+template <typename T_a, typename T_b>
+inline auto add_impl(const T_a& a, const T_b& b) {
+  return make_elt_dual(a.val() + b.val(), add_tangents(a.tan(), b.tan()));
+}
+
+template <typename T_a, typename T_b>
+inline auto subtract_impl(const T_a& a, const T_b& b) {
+  return make_elt_dual(a.val() - b.val(),
+                       subtract_tangents(a.tan(), b.tan()));
+}
+
+template <typename T_a, typename T_b>
+inline auto elt_multiply_impl(const T_a& a, const T_b& b) {
+  return make_elt_dual(stan::math::elt_multiply(a.val(), b.val()),
+                       add_tangents(scale_tangent(a.tan(), b.val()),
+                                    scale_tangent(b.tan(), a.val())));
+}
+
+template <typename T_a, typename T_b>
+inline auto elt_divide_impl(const T_a& a, const T_b& b) {
+  return make_elt_dual(
+      stan::math::elt_divide(a.val(), b.val()),
+      divide_tangent(
+          subtract_tangents(
+              a.tan(), scale_tangent(b.tan(), stan::math::elt_divide(
+                                                  a.val(), b.val()))),
+          b.val()));
+}
+
+/**
+ * Defines the elementwise binary operation `fun` on `elt_dual_cl`, for
+ * two duals or a dual and a kernel generator expression.
+ * @param fun name of the operation
+ * @param impl function implementing the operation on two duals
+ */
+#define ADD_ELT_DUAL_BINARY_OPERATION(fun, impl)                            \
+  template <typename T_a_val, typename T_a_tan, typename T_b_val,           \
+            typename T_b_tan>                                               \
+  inline auto fun(const elt_dual_cl<T_a_val, T_a_tan>& a,                   \
+                  const elt_dual_cl<T_b_val, T_b_tan>& b) {                 \
+    return impl(a, b);                                                      \
+  }                                                                         \
+  template <typename T_a_val, typename T_a_tan, typename T_b,               \
+            require_all_kernel_expressions_t<T_b>* = nullptr>               \
+  inline auto fun(const elt_dual_cl<T_a_val, T_a_tan>& a, const T_b& b) {   \
+    return impl(a, to_elt_dual(b));                                         \
+  }                                                                         \
+  template <typename T_a, typename T_b_val, typename T_b_tan,               \
+            require_all_kernel_expressions_t<T_a>* = nullptr>               \
+  inline auto fun(const T_a& a, const elt_dual_cl<T_b_val, T_b_tan>& b) {   \
+    return impl(to_elt_dual(a), b);                                         \
+  }
+
+ADD_ELT_DUAL_BINARY_OPERATION(operator+, add_impl)
+ADD_ELT_DUAL_BINARY_OPERATION(add, add_impl)
+ADD_ELT_DUAL_BINARY_OPERATION(operator-, subtract_impl)
+ADD_ELT_DUAL_BINARY_OPERATION(subtract, subtract_impl)
+ADD_ELT_DUAL_BINARY_OPERATION(elt_multiply, elt_multiply_impl)
+ADD_ELT_DUAL_BINARY_OPERATION(elt_divide, elt_divide_impl)
+
+#undef ADD_ELT_DUAL_BINARY_OPERATION
+
+/**
+ * Whether the value of a dual is a scalar, as for scalar arguments of
+ * `fuse_elementwise()`.
+ */
+template <typename T>
+struct is_scalar_elt_dual : std::false_type {};
+template <typename T_val, typename T_tan>
+struct is_scalar_elt_dual<elt_dual_cl<scalar_<T_val>, T_tan>>
+    : std::true_type {};
+
+/*
+ * As in the kernel generator, `*` is only defined if one of the operands is
+ * a scalar. On `matrix_cl` it is the matrix product, so a product of two
+ * matrices must be written with `elt_multiply()`.
+ */
+template <typename T_a_val, typename T_a_tan, typename T_b_val,
+          typename T_b_tan,
+          std::enable_if_t<
+              is_scalar_elt_dual<elt_dual_cl<T_a_val, T_a_tan>>::value
+              || is_scalar_elt_dual<elt_dual_cl<T_b_val, T_b_tan>>::value>* =
+              nullptr>
+inline auto operator*(const elt_dual_cl<T_a_val, T_a_tan>& a,
+                      const elt_dual_cl<T_b_val, T_b_tan>& b) {
+  return elt_multiply_impl(a, b);
+}
+template <typename T_a_val, typename T_a_tan, typename T_b,
+          require_arithmetic_t<T_b>* = nullptr>
+inline auto operator*(const elt_dual_cl<T_a_val, T_a_tan>& a, T_b b) {
+  return elt_multiply_impl(a, to_elt_dual(b));
+}
+template <typename T_a, typename T_b_val, typename T_b_tan,
+          require_arithmetic_t<T_a>* = nullptr>
+inline auto operator*(T_a a, const elt_dual_cl<T_b_val, T_b_tan>& b) {
+  return elt_multiply_impl(to_elt_dual(a), b);
+}
+
+template <typename T_val, typename T_tan>
+inline auto operator-(const elt_dual_cl<T_val, T_tan>& a) {
+  return make_elt_dual(-a.val(), negate_tangent(a.tan()));
+}
+
+/**
+ * Defines the elementwise function `fun` on `elt_dual_cl`.
+ * @param fun name of the function
+ * @param tangent expression for the derivative, in terms of the argument
+ * `a` of the function
+ */
+#define ADD_ELT_DUAL_UNARY_FUNCTION(fun, tangent)              \
+  template <typename T_val, typename T_tan>                    \
+  inline auto fun(const elt_dual_cl<T_val, T_tan>& a) {        \
+    return make_elt_dual(stan::math::fun(a.val()), tangent);   \
+  }
+
+ADD_ELT_DUAL_UNARY_FUNCTION(exp,
+                            scale_tangent(a.tan(), stan::math::exp(a.val())))
+ADD_ELT_DUAL_UNARY_FUNCTION(expm1,
+                            scale_tangent(a.tan(), stan::math::exp(a.val())))
+ADD_ELT_DUAL_UNARY_FUNCTION(log, divide_tangent(a.tan(), a.val()))
+ADD_ELT_DUAL_UNARY_FUNCTION(log1p, divide_tangent(a.tan(), 1.0 + a.val()))
+ADD_ELT_DUAL_UNARY_FUNCTION(sqrt,
+                            divide_tangent(a.tan(),
+                                           2.0 * stan::math::sqrt(a.val())))
+ADD_ELT_DUAL_UNARY_FUNCTION(sin,
+                            scale_tangent(a.tan(), stan::math::cos(a.val())))
+ADD_ELT_DUAL_UNARY_FUNCTION(cos, negate_tangent(scale_tangent(
+                                     a.tan(), stan::math::sin(a.val()))))
+ADD_ELT_DUAL_UNARY_FUNCTION(
+    tanh, scale_tangent(a.tan(), 1.0 - stan::math::elt_multiply(
+                                           stan::math::tanh(a.val()),
+                                           stan::math::tanh(a.val()))))
+ADD_ELT_DUAL_UNARY_FUNCTION(
+    inv_logit,
+    scale_tangent(a.tan(), stan::math::elt_multiply(
+                               stan::math::inv_logit(a.val()),
+                               1.0 - stan::math::inv_logit(a.val()))))
+ADD_ELT_DUAL_UNARY_FUNCTION(
+    log1p_exp, scale_tangent(a.tan(), stan::math::inv_logit(a.val())))
+ADD_ELT_DUAL_UNARY_FUNCTION(
+    log_inv_logit, scale_tangent(a.tan(), stan::math::inv_logit(-a.val())))
+ADD_ELT_DUAL_UNARY_FUNCTION(lgamma, scale_tangent(a.tan(), stan::math::digamma(
+                                                               a.val())))
+
+#undef ADD_ELT_DUAL_UNARY_FUNCTION
+
+}  // namespace elt_dual
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
@@ -0,0 +1,60 @@
+#ifndef STAN_MATH_OPENCL_REV_FMA_HPP
+#define STAN_MATH_OPENCL_REV_FMA_HPP
+#ifdef STAN_OPENCL
+
+#include <stan/math/opencl/rev/adjoint_results.hpp>
+#include <stan/math/opencl/matrix_cl.hpp>
+#include <stan/math/opencl/kernel_generator.hpp>
+#include <stan/math/opencl/prim/fma.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/rev/core/reverse_pass_callback.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/meta/is_kernel_expression.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Elementwise product of the first two arguments plus the third argument,
+ * for reverse mode matrices and/or kernel generator expressions.
+ *
+ * Unlike composing `elt_multiply()` and `add()`, the values are computed in
+ * one kernel and the adjoints of all three arguments are updated by one
+ * kernel in the reverse pass, without an intermediate `var_value` for the
+ * product.
+ *
+ * @tparam T_x type of the first argument
+ * @tparam T_y type of the second argument
+ * @tparam T_z type of the third argument
+ * @param x First argument.
+ * @param y Second argument.
+ * @param z Third argument.
+ * @return The elementwise product of the first two arguments plus the third
+ * argument.
+ */
+template <typename T_x, typename T_y, typename T_z,
+          require_all_prim_or_rev_kernel_expression_t<T_x, T_y, T_z>* = nullptr,
+          require_any_var_t<T_x, T_y, T_z>* = nullptr,
+          require_any_not_stan_scalar_t<T_x, T_y, T_z>* = nullptr>
+inline var_value<matrix_cl<double>> fma(T_x&& x, T_y&& y, T_z&& z) {
+  arena_t<T_x> x_arena = std::forward<T_x>(x);
+  arena_t<T_y> y_arena = std::forward<T_y>(y);
+  arena_t<T_z> z_arena = std::forward<T_z>(z);
+
+  return make_callback_var(
+      fma(value_of(x_arena), value_of(y_arena), value_of(z_arena)),
+      [x_arena, y_arena,
+       z_arena](const vari_value<matrix_cl<double>>& res) mutable {
+        adjoint_results(x_arena, y_arena, z_arena)
+            += expressions(elt_multiply(res.adj(), value_of(y_arena)),
+                           elt_multiply(res.adj(), value_of(x_arena)),
+                           res.adj());
+      });
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
@@ -0,0 +1,122 @@
+#ifndef STAN_MATH_OPENCL_REV_FUSE_ELEMENTWISE_HPP
+#define STAN_MATH_OPENCL_REV_FUSE_ELEMENTWISE_HPP
+#ifdef STAN_OPENCL
+
+#include <stan/math/opencl/rev/adjoint_results.hpp>
+#include <stan/math/opencl/rev/arena_type.hpp>
+#include <stan/math/opencl/rev/elt_dual_cl.hpp>
+#include <stan/math/opencl/matrix_cl.hpp>
+#include <stan/math/opencl/kernel_generator.hpp>
+#include <stan/math/opencl/prim/fuse_elementwise.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace stan {
+namespace math {
+namespace internal {
+namespace elt_dual {
+
+/**
+ * Return the argument of `fuse_elementwise()` as an `elt_dual_cl` whose
+ * derivative is the adjoint of the result, if it is the seeded argument,
+ * or zero otherwise.
+ */
+template <bool Seeded, typename T, std::enable_if_t<Seeded>* = nullptr>
+inline auto seed_elt_dual(const T& arg, const matrix_cl<double>& adj) {
+  return make_elt_dual(as_operation_cl(value_of(arg)).deep_copy(),
+                       as_operation_cl(adj).deep_copy());
+}
+template <bool Seeded, typename T, std::enable_if_t<!Seeded>* = nullptr>
+inline auto seed_elt_dual(const T& arg, const matrix_cl<double>& adj) {
+  return make_elt_dual(as_operation_cl(value_of(arg)).deep_copy(),
+                       zero_tangent_cl{});
+}
+
+inline auto tangent_or_zero(zero_tangent_cl, const matrix_cl<double>& adj) {
+  return constant(0.0, adj.rows(), adj.cols());
+}
+template <typename T>
+inline T tangent_or_zero(T&& tan, const matrix_cl<double>& adj) {
+  return std::forward<T>(tan);
+}
+
+/**
+ * Return the expression for the contribution to the adjoint of the
+ * `I`-th argument of `fuse_elementwise()`. As the function is
+ * elementwise, its Jacobian is diagonal, so its derivative in the
+ * direction of the adjoint of the result is the adjoint contribution.
+ */
+template <std::size_t I, typename F, typename Args, std::size_t... Js>
+inline auto fuse_elementwise_adjoint(const F& f, const Args& args,
+                                     const matrix_cl<double>& adj,
+                                     std::index_sequence<Js...>) {
+  return tangent_or_zero(
+      f(seed_elt_dual<I == Js>(std::get<Js>(args), adj)...).tan(), adj);
+}
+
+}  // namespace elt_dual
+}  // namespace internal
+
+/**
+ * Return the elementwise function `f` of the arguments, some of which are
+ * reverse mode matrices or scalars.
+ *
+ * <p>Composing reverse mode operations, as in `exp(a .* b + c)`, runs one
+ * kernel and stores one intermediate `var_value` per operation, and runs
+ * one kernel per operation again in the reverse pass. Here the value is
+ * computed by a single kernel, and in the reverse pass the adjoints of
+ * all the arguments are updated by a single kernel. The expressions for
+ * the adjoints are built at compile time by evaluating `f` on
+ * `elt_dual_cl` arguments, each seeded with the adjoint of the result.
+ *
+ * <p>`f` must be a generic function that builds its result from the
+ * elementwise operations defined for `elt_dual_cl`: `+`, `-`,
+ * `elt_multiply()`, `elt_divide()`, `*` with a scalar operand, `exp()`,
+ * `expm1()`, `log()`, `log1p()`, `sqrt()`, `sin()`, `cos()`, `tanh()`,
+ * `inv_logit()`, `log1p_exp()`, `log_inv_logit()` and `lgamma()`. It is
+ * called again in the reverse pass, so it must not capture anything that
+ * does not outlive it, and it must not own memory, as it is stored in the
+ * arena.
+ *
+ * @tparam F type of the function
+ * @tparam Args types of the arguments
+ * @param f generic function of kernel generator expressions, built from
+ * elementwise operations
+ * @param args arguments
+ * @return `f` applied to the arguments
+ */
+template <typename F, typename... Args,
+          require_all_prim_or_rev_kernel_expression_t<Args...>* = nullptr,
+          require_any_var_t<Args...>* = nullptr,
+          require_any_not_stan_scalar_t<Args...>* = nullptr>
+inline var_value<matrix_cl<double>> fuse_elementwise(const F& f,
+                                                     Args&&... args) {
+  using args_arena_t = std::tuple<arena_t<Args>...>;
+  args_arena_t args_arena(std::forward<Args>(args)...);
+
+  matrix_cl<double> res_val = index_apply<sizeof...(Args)>([&](auto... Is) {
+    return f(value_of(std::get<Is>(args_arena))...);
+  });
+
+  return make_callback_var(
+      std::move(res_val),
+      [f, args_arena](const vari_value<matrix_cl<double>>& res) mutable {
+        index_apply<sizeof...(Args)>([&](auto... Is) {
+          adjoint_results(std::get<Is>(args_arena)...)
+              += expressions(internal::elt_dual::fuse_elementwise_adjoint<Is>(
+                  f, args_arena, res.adj(),
+                  std::index_sequence_for<Args...>{})...);
+        });
+      });
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
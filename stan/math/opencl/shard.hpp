@@ -0,0 +1,124 @@
+#ifndef STAN_MATH_OPENCL_SHARD_HPP
+#define STAN_MATH_OPENCL_SHARD_HPP
+#ifdef STAN_OPENCL
+
+#include <stan/math/opencl/opencl_context.hpp>
+#include <stan/math/opencl/matrix_cl.hpp>
+#include <stan/math/opencl/copy.hpp>
+#include <stan/math/opencl/prim/multiply.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/** \ingroup opencl_context_group
+ * Makes the calling thread enqueue its OpenCL work to given device of the
+ * context for the lifetime of the object. The previously active device is
+ * restored on destruction.
+ */
+class opencl_device_scope {
+  int previous_;
+
+ public:
+  /**
+   * Activates a device.
+   * @param device_index index of the device in `opencl_context.devices()`
+   * @throw std::domain_error if there is no device with given index
+   */
+  explicit opencl_device_scope(int device_index)
+      : previous_(opencl_context.active_device()) {
+    check_bounded("opencl_device_scope", "device_index", device_index, 0,
+                  opencl_context.num_devices() - 1);
+    opencl_context.set_active_device(device_index);
+  }
+  opencl_device_scope(const opencl_device_scope&) = delete;
+  opencl_device_scope& operator=(const opencl_device_scope&) = delete;
+  ~opencl_device_scope() { opencl_context.set_active_device(previous_); }
+};
+
+namespace internal {
+
+/**
+ * Part of a row-sharded computation assigned to one OpenCL device.
+ */
+struct opencl_shard {
+  /** Index of the device in `opencl_context.devices()`. */
+  int device;
+  /** First row of the shard. */
+  int start;
+  /** Number of rows in the shard. */
+  int rows;
+};
+
+/**
+ * Splits rows between the devices in the OpenCL context, proportionally to
+ * their numbers of compute units. Devices that would get no rows are skipped.
+ * @param rows number of rows to split
+ * @return shards in the order of rows
+ */
+inline std::vector<opencl_shard> opencl_row_shards(int rows) {
+  const std::vector<int>& weights = opencl_context.compute_units();
+  double total = 0;
+  for (int weight : weights) {
+    total += weight;
+  }
+  std::vector<opencl_shard> shards;
+  double cumulative = 0;
+  int start = 0;
+  for (int i = 0; i < weights.size(); i++) {
+    cumulative += weights[i];
+    const int end
+        = i == weights.size() - 1
+              ? rows
+              : static_cast<int>(std::lround(rows * cumulative / total));
+    if (end > start) {
+      shards.push_back({i, start, end - start});
+      start = end;
+    }
+  }
+  return shards;
+}
+
+/**
+ * Multiplies matrices of doubles with the rows of the first matrix sharded
+ * across the OpenCL devices. All shards are enqueued before any result is
+ * read, so the devices work concurrently.
+ * @tparam T_return type of the result
+ * @tparam Mat1 type of the first matrix or expression
+ * @tparam Mat2 type of the second matrix or expression
+ * @param m1 first matrix
+ * @param m2 second matrix
+ * @return product of the matrices
+ */
+template <typename T_return, typename Mat1, typename Mat2>
+inline T_return opencl_sharded_multiply(const Mat1& m1, const Mat2& m2) {
+  const auto& m1_ref = to_ref(m1);
+  const auto& m2_ref = to_ref(m2);
+  T_return res(m1.rows(), m2.cols());
+  const std::vector<opencl_shard> shards = opencl_row_shards(m1.rows());
+  std::vector<matrix_cl<double>> res_cl;
+  for (const opencl_shard& shard : shards) {
+    opencl_device_scope scope(shard.device);
+    res_cl.push_back(
+        to_matrix_cl(m1_ref.block(shard.start, 0, shard.rows, m1.cols()))
+        * to_matrix_cl(m2_ref));
+  }
+  for (std::size_t i = 0; i < shards.size(); i++) {
+    opencl_device_scope scope(shards[i].device);
+    res.block(shards[i].start, 0, shards[i].rows, res.cols())
+        = from_matrix_cl<Eigen::MatrixXd>(res_cl[i]);
+  }
+  return res;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
+#endif
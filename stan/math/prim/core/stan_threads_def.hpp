@@ -0,0 +1,23 @@
+#ifndef STAN_MATH_PRIM_CORE_STAN_THREADS_DEF_HPP
+#define STAN_MATH_PRIM_CORE_STAN_THREADS_DEF_HPP
+
+// Internal macro used to modify global pointer definition to the
+// global AD instance.
+#ifdef STAN_THREADS
+// Whenever STAN_THREADS is set a TLS keyword is used. For reasons
+// explained in autodiffstackstorage.hpp we use the GNU compiler
+// extension __thread if supported by the compiler while the generic
+// thread_local C++11 keyword is used otherwise. As __thread requires
+// constant initialization, only pointers and other trivial types
+// should be declared with it.
+#ifdef __GNUC__
+#define STAN_THREADS_DEF __thread
+#else
+#define STAN_THREADS_DEF thread_local
+#endif
+#else
+// In case STAN_THREADS is not set, then no modifier is needed.
+#define STAN_THREADS_DEF
+#endif
+
+#endif
@@ -88,6 +88,29 @@ inline void check_pos_definite(const char* function, const char* name,
   }
 }
 
+/**
+ * Check if the specified sparse LLT decomposition was successful.
+ *
+ * @tparam MatrixType type of the factored sparse matrix
+ * @tparam UpLo triangle of the matrix used by the decomposition
+ * @tparam Ordering fill-reducing ordering of the decomposition
+ * @param function function name (for error messages)
+ * @param name variable name (for error messages)
+ * @param cholesky Eigen::SimplicialLLT to test
+ * @throw std::domain_error if the decomposition failed or the
+ * diagonal of the L matrix is not positive
+ */
+template <typename MatrixType, int UpLo, typename Ordering>
+inline void check_pos_definite(
+    const char* function, const char* name,
+    const Eigen::SimplicialLLT<MatrixType, UpLo, Ordering>& cholesky) {
+  if (cholesky.info() != Eigen::Success
+      || !(cholesky.matrixL().nestedExpression().diagonal().array() > 0.0)
+              .all()) {
+    throw_domain_error(function, "Matrix", " is not positive definite", name);
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
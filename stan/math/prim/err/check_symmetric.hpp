@@ -28,7 +28,8 @@ namespace math {
  * @throw <code>std::domain_error</code> if any element not on the
  *   main diagonal is <code>NaN</code>
  */
-template <typename EigMat, require_matrix_t<EigMat>* = nullptr>
+template <typename EigMat, require_matrix_t<EigMat>* = nullptr,
+          require_not_eigen_sparse_base_t<EigMat>* = nullptr>
 inline void check_symmetric(const char* function, const char* name,
                             const EigMat& y) {
   check_square(function, name, y);
@@ -61,6 +62,48 @@ inline void check_symmetric(const char* function, const char* name,
   }
 }
 
+/**
+ * Check if the specified sparse matrix is symmetric.
+ * Only the stored entries are visited, each one is compared against its
+ * mirror, which is zero when it is not stored.
+ * The error message is either 0 or 1 indexed, specified by
+ * <code>stan::error_index::value</code>.
+ * @tparam SpMat Type of sparse matrix
+ * @param function Function name (for error messages)
+ * @param name Variable name (for error messages)
+ * @param y Sparse matrix to test
+ * @throw <code>std::invalid_argument</code> if the matrix is not square.
+ * @throw <code>std::domain_error</code> if the matrix is not symmetric
+ */
+template <typename SpMat, require_eigen_sparse_base_t<SpMat>* = nullptr>
+inline void check_symmetric(const char* function, const char* name,
+                            const SpMat& y) {
+  check_square(function, name, y);
+  using std::fabs;
+  for (Eigen::Index k = 0; k < y.outerSize(); ++k) {
+    for (typename SpMat::InnerIterator it(y, k); it; ++it) {
+      const Eigen::Index m = it.row();
+      const Eigen::Index n = it.col();
+      if (m != n
+          && !(fabs(it.value() - y.coeff(n, m)) <= CONSTRAINT_TOLERANCE)) {
+        [&]() STAN_COLD_PATH {
+          std::ostringstream msg1;
+          msg1 << "is not symmetric. " << name << "["
+               << stan::error_index::value + m << ","
+               << stan::error_index::value + n << "] = ";
+          std::string msg1_str(msg1.str());
+          std::ostringstream msg2;
+          msg2 << ", but " << name << "[" << stan::error_index::value + n << ","
+               << stan::error_index::value + m << "] = " << y.coeff(n, m);
+          std::string msg2_str(msg2.str());
+          throw_domain_error(function, name, it.value(), msg1_str.c_str(),
+                             msg2_str.c_str());
+        }();
+      }
+    }
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
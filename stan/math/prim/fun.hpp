@@ -38,11 +38,13 @@
 #include <stan/math/prim/fun/cholesky_corr_constrain.hpp>
 #include <stan/math/prim/fun/cholesky_corr_free.hpp>
 #include <stan/math/prim/fun/cholesky_decompose.hpp>
+#include <stan/math/prim/fun/cholesky_decompose_tiled.hpp>
 #include <stan/math/prim/fun/cholesky_factor_constrain.hpp>
 #include <stan/math/prim/fun/cholesky_factor_free.hpp>
 #include <stan/math/prim/fun/choose.hpp>
 #include <stan/math/prim/fun/col.hpp>
 #include <stan/math/prim/fun/cols.hpp>
+#include <stan/math/prim/fun/column_coloring.hpp>
 #include <stan/math/prim/fun/columns_dot_product.hpp>
 #include <stan/math/prim/fun/columns_dot_self.hpp>
 #include <stan/math/prim/fun/conj.hpp>
@@ -80,6 +82,7 @@
 #include <stan/math/prim/fun/dot_product.hpp>
 #include <stan/math/prim/fun/dot_self.hpp>
 #include <stan/math/prim/fun/eigen_comparisons.hpp>
+#include <stan/math/prim/fun/eigendecompose_sym.hpp>
 #include <stan/math/prim/fun/eigenvalues.hpp>
 #include <stan/math/prim/fun/eigenvalues_sym.hpp>
 #include <stan/math/prim/fun/eigenvectors.hpp>
@@ -198,6 +201,7 @@
 #include <stan/math/prim/fun/lub_constrain.hpp>
 #include <stan/math/prim/fun/lub_free.hpp>
 #include <stan/math/prim/fun/make_nu.hpp>
+#include <stan/math/prim/fun/matrix_batch.hpp>
 #include <stan/math/prim/fun/matrix_exp.hpp>
 #include <stan/math/prim/fun/matrix_exp_multiply.hpp>
 #include <stan/math/prim/fun/matrix_power.hpp>
@@ -334,6 +338,7 @@
 #include <stan/math/prim/fun/trace_inv_quad_form_ldlt.hpp>
 #include <stan/math/prim/fun/trace_quad_form.hpp>
 #include <stan/math/prim/fun/transpose.hpp>
+#include <stan/math/prim/fun/transpose_multiply.hpp>
 #include <stan/math/prim/fun/trigamma.hpp>
 #include <stan/math/prim/fun/trunc.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
@@ -343,6 +348,7 @@
 #include <stan/math/prim/fun/unitspaced_array.hpp>
 #include <stan/math/prim/fun/unit_vector_constrain.hpp>
 #include <stan/math/prim/fun/unit_vector_free.hpp>
+#include <stan/math/prim/fun/value_ldlt.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
 #include <stan/math/prim/fun/vec_concat.hpp>
@@ -4,12 +4,96 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/cholesky_decompose_tiled.hpp>
 
 #include <cmath>
+#include <utility>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+#ifdef STAN_OPENCL
+namespace internal {
+/**
+ * Computes the Cholesky factor of a matrix of doubles on the OpenCL device if
+ * that is predicted to be faster.
+ *
+ * Only declared here, so prim does not depend on the OpenCL backend. It is
+ * defined in `stan/math/opencl/offload.hpp`, which `stan/math/prim.hpp`
+ * includes if OpenCL is enabled.
+ *
+ * @tparam EigMat type of the matrix
+ * @tparam T_L type of the Cholesky factor
+ * @param m Symmetric matrix.
+ * @param[out] L Cholesky factor, set only if the return value is true.
+ * @return whether the factor was computed
+ */
+template <typename EigMat, typename T_L,
+          require_vt_same<double, EigMat>* = nullptr>
+inline bool cholesky_decompose_offload(const EigMat& m, T_L& L);
+
+/**
+ * Only matrices of doubles are offloaded to the OpenCL device.
+ *
+ * @tparam EigMat type of the matrix
+ * @tparam T_L type of the Cholesky factor
+ * @param m Symmetric matrix.
+ * @param[out] L Cholesky factor, not used.
+ * @return false
+ */
+template <typename EigMat, typename T_L,
+          require_not_vt_same<double, EigMat>* = nullptr>
+inline bool cholesky_decompose_offload(const EigMat& m, T_L& L) {
+  return false;
+}
+}  // namespace internal
+#endif
+
+namespace internal {
+/**
+ * Computes the Cholesky factor of a large matrix of doubles with the
+ * parallel tiled algorithm (see `cholesky_tuning_opts()`).
+ *
+ * @tparam EigMat type of the matrix
+ * @tparam T_L type of the Cholesky factor
+ * @param m Symmetric matrix.
+ * @param[out] L Cholesky factor, set only if the return value is true.
+ * @return whether the factor was computed
+ * @throw std::domain_error if m is not positive definite
+ */
+template <typename EigMat, typename T_L,
+          require_vt_same<double, EigMat>* = nullptr>
+inline bool cholesky_decompose_tiled(const EigMat& m, T_L& L) {
+  if (!use_tiled_cholesky(m.rows())) {
+    return false;
+  }
+  Eigen::MatrixXd L_m = m;
+  if (!cholesky_tiled_in_place(L_m, cholesky_tuning_opts().tile_size)) {
+    throw_domain_error("cholesky_decompose", "Matrix",
+                       " is not positive definite", "m");
+  }
+  L_m.template triangularView<Eigen::StrictlyUpper>().setZero();
+  L = std::move(L_m);
+  return true;
+}
+
+/**
+ * Only matrices of doubles are decomposed with the tiled algorithm.
+ *
+ * @tparam EigMat type of the matrix
+ * @tparam T_L type of the Cholesky factor
+ * @param m Symmetric matrix.
+ * @param[out] L Cholesky factor, not used.
+ * @return false
+ */
+template <typename EigMat, typename T_L,
+          require_not_vt_same<double, EigMat>* = nullptr>
+inline bool cholesky_decompose_tiled(const EigMat& m, T_L& L) {
+  return false;
+}
+}  // namespace internal
+
 /**
  * Return the lower-triangular Cholesky factor (i.e., matrix
  * square root) of the specified square, symmetric matrix.  The return
@@ -20,9 +104,10 @@ namespace math {
  * @tparam EigMat type of the matrix (must be derived from \c Eigen::MatrixBase)
  * @param m Symmetric matrix.
  * @return Square root of matrix.
- * @note Because OpenCL only works on doubles there are two
- * <code>cholesky_decompose</code> functions. One that works on doubles
- * and another that works on all other types (this one).
+ * @note With OpenCL enabled, large matrices of doubles are decomposed on the
+ * OpenCL device (see `opencl_offload_cholesky_decompose()`). Otherwise large
+ * matrices of doubles are decomposed with the parallel tiled algorithm (see
+ * `cholesky_tuning_opts()`).
  * @throw std::domain_error if m is not a symmetric matrix or
  *   if m is not positive definite (if m has more than 0 elements)
  */
@@ -34,6 +119,17 @@ cholesky_decompose(const EigMat& m) {
   const eval_return_type_t<EigMat>& m_eval = m.eval();
   check_symmetric("cholesky_decompose", "m", m_eval);
   check_not_nan("cholesky_decompose", "m", m_eval);
+  Eigen::Matrix<value_type_t<EigMat>, EigMat::RowsAtCompileTime,
+                EigMat::ColsAtCompileTime>
+      L;
+#ifdef STAN_OPENCL
+  if (internal::cholesky_decompose_offload(m_eval, L)) {
+    return L;
+  }
+#endif
+  if (internal::cholesky_decompose_tiled(m_eval, L)) {
+    return L;
+  }
   Eigen::LLT<Eigen::Matrix<value_type_t<EigMat>, EigMat::RowsAtCompileTime,
                            EigMat::ColsAtCompileTime>>
       llt = m_eval.llt();
@@ -41,6 +137,28 @@ cholesky_decompose(const EigMat& m) {
   return llt.matrixL();
 }
 
+/**
+ * Return the Cholesky factor of each matrix of a batch.
+ *
+ * The reverse mode overload stores the batch contiguously on the arena
+ * and registers a single callback for it.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices
+ * @param m batch of symmetric, positive-definite matrices
+ * @return Cholesky factors of the matrices
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
+inline std::vector<plain_type_t<value_type_t<T>>> cholesky_decompose(
+    const T& m) {
+  std::vector<plain_type_t<value_type_t<T>>> res;
+  res.reserve(m.size());
+  for (const auto& m_k : m) {
+    res.emplace_back(cholesky_decompose(m_k));
+  }
+  return res;
+}
+
 }  // namespace math
 }  // namespace stan
 
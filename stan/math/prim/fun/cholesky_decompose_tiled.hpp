@@ -0,0 +1,150 @@
+#ifndef STAN_MATH_PRIM_FUN_CHOLESKY_DECOMPOSE_TILED_HPP
+#define STAN_MATH_PRIM_FUN_CHOLESKY_DECOMPOSE_TILED_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Tuning parameters of the tiled Cholesky factorization and its
+ * reverse mode adjoint, which run independent tile updates in parallel
+ * on the TBB thread pool.
+ */
+struct cholesky_tuning_struct {
+  /**
+   * Rows and columns of the square tiles. Each step of the
+   * factorization and of the adjoint handles one column of tiles.
+   */
+  int tile_size = 256;
+  /**
+   * Matrices with fewer rows are factored and differentiated with the
+   * serial blocked algorithms.
+   */
+  int min_rows = 1024;
+};
+
+/**
+ * Return the tuning parameters of the tiled Cholesky factorization.
+ * They are shared by all threads and should be set before sampling.
+ *
+ * @return reference to the tuning parameters
+ */
+inline cholesky_tuning_struct& cholesky_tuning_opts() {
+  static cholesky_tuning_struct opts;
+  return opts;
+}
+
+namespace internal {
+
+/**
+ * Return whether a matrix with the given number of rows is factored
+ * and differentiated with the tiled algorithms.
+ *
+ * @param rows number of rows of the matrix
+ */
+inline bool use_tiled_cholesky(Eigen::Index rows) {
+  return rows >= cholesky_tuning_opts().min_rows
+         && rows > cholesky_tuning_opts().tile_size;
+}
+
+/**
+ * Call `f(start, size)` in parallel for each tile of `[begin, end)`.
+ *
+ * @tparam F type of the functor
+ * @param begin first index
+ * @param end one past the last index
+ * @param tile_size size of the tiles
+ * @param f functor applied to the start and size of each tile
+ */
+template <typename F>
+inline void parallel_for_tiles(Eigen::Index begin, Eigen::Index end,
+                               Eigen::Index tile_size, const F& f) {
+  const Eigen::Index num_tiles = (end - begin + tile_size - 1) / tile_size;
+  tbb::parallel_for(tbb::blocked_range<Eigen::Index>(0, num_tiles),
+                    [&](const tbb::blocked_range<Eigen::Index>& r) {
+                      for (Eigen::Index t = r.begin(); t < r.end(); ++t) {
+                        const Eigen::Index start = begin + t * tile_size;
+                        f(start, std::min(tile_size, end - start));
+                      }
+                    });
+}
+
+/**
+ * Overwrite the lower triangle of a symmetric matrix with its Cholesky
+ * factor using a right-looking tiled algorithm.
+ *
+ * Each step factors one diagonal tile, solves the tiles below it in
+ * parallel and then applies the symmetric update to every tile of the
+ * trailing lower triangle in parallel. The strictly upper triangle is
+ * not referenced.
+ *
+ * @param[in, out] A symmetric matrix, lower triangle overwritten with
+ * its Cholesky factor
+ * @param tile_size size of the tiles
+ * @return false if the matrix is not positive definite
+ */
+inline bool cholesky_tiled_in_place(Eigen::Ref<Eigen::MatrixXd> A,
+                                    Eigen::Index tile_size) {
+  const Eigen::Index n = A.rows();
+  std::vector<std::pair<Eigen::Index, Eigen::Index>> update_tiles;
+  for (Eigen::Index k = 0; k < n; k += tile_size) {
+    const Eigen::Index bs = std::min(tile_size, n - k);
+    const Eigen::Index rest = k + bs;
+    auto A_kk = A.block(k, k, bs, bs);
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> llt_kk(A_kk);
+    if (llt_kk.info() != Eigen::Success
+        || !(A_kk.diagonal().array() > 0.0).all()) {
+      return false;
+    }
+    if (rest == n) {
+      break;
+    }
+    parallel_for_tiles(rest, n, tile_size,
+                       [&](Eigen::Index i, Eigen::Index rows) {
+                         auto A_ik = A.block(i, k, rows, bs);
+                         A_kk.transpose()
+                             .template triangularView<Eigen::Upper>()
+                             .template solveInPlace<Eigen::OnTheRight>(A_ik);
+                       });
+
+    update_tiles.clear();
+    for (Eigen::Index j = rest; j < n; j += tile_size) {
+      for (Eigen::Index i = j; i < n; i += tile_size) {
+        update_tiles.emplace_back(i, j);
+      }
+    }
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, update_tiles.size()),
+        [&](const tbb::blocked_range<size_t>& r) {
+          for (size_t t = r.begin(); t < r.end(); ++t) {
+            const Eigen::Index i = update_tiles[t].first;
+            const Eigen::Index j = update_tiles[t].second;
+            const Eigen::Index rows = std::min(tile_size, n - i);
+            const Eigen::Index cols = std::min(tile_size, n - j);
+            if (i == j) {
+              A.block(i, i, rows, rows)
+                  .template selfadjointView<Eigen::Lower>()
+                  .rankUpdate(A.block(i, k, rows, bs), -1.0);
+            } else {
+              A.block(i, j, rows, cols).noalias()
+                  -= A.block(i, k, rows, bs)
+                     * A.block(j, k, cols, bs).transpose();
+            }
+          }
+        });
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
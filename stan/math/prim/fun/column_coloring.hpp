@@ -0,0 +1,56 @@
+#ifndef STAN_MATH_PRIM_FUN_COLUMN_COLORING_HPP
+#define STAN_MATH_PRIM_FUN_COLUMN_COLORING_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Colors the columns of a sparsity pattern so that no two columns of the
+ * same color have an entry in the same row. Columns of one color are
+ * structurally orthogonal, so the product of a matrix with that pattern and
+ * the sum of the unit vectors of the columns of one color holds all entries
+ * of these columns. This is used to compute sparse Jacobians and Hessians
+ * with one pass per color instead of one pass per column.
+ *
+ * Columns are colored greedily in order, each getting the smallest color
+ * not used by any column it shares a row with. Every entry stored in the
+ * pattern is treated as a nonzero, whatever its value.
+ *
+ * @tparam T type of elements in the pattern
+ * @param pattern sparsity pattern
+ * @return color of each column, colors are numbered from 0 without gaps
+ */
+template <typename T>
+inline std::vector<int> column_coloring(const Eigen::SparseMatrix<T>& pattern) {
+  const Eigen::SparseMatrix<T, Eigen::RowMajor> pattern_rows(pattern);
+  std::vector<int> colors(pattern.cols(), -1);
+  // forbidden[c] == j if color c is used by a column sharing a row with j
+  std::vector<int> forbidden(pattern.cols(), -1);
+  for (int j = 0; j < pattern.cols(); ++j) {
+    for (typename Eigen::SparseMatrix<T>::InnerIterator it(pattern, j); it;
+         ++it) {
+      for (typename Eigen::SparseMatrix<T, Eigen::RowMajor>::InnerIterator
+               row_it(pattern_rows, it.row());
+           row_it; ++row_it) {
+        const int color = colors[row_it.col()];
+        if (color >= 0) {
+          forbidden[color] = j;
+        }
+      }
+    }
+    int color = 0;
+    while (forbidden[color] == j) {
+      ++color;
+    }
+    colors[j] = color;
+  }
+  return colors;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
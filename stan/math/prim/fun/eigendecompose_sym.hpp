@@ -0,0 +1,38 @@
+#ifndef STAN_MATH_PRIM_FUN_EIGENDECOMPOSE_SYM_HPP
+#define STAN_MATH_PRIM_FUN_EIGENDECOMPOSE_SYM_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <tuple>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the eigenvalues and eigenvectors of the specified symmetric
+ * matrix from a single decomposition. The eigenvalues are in ascending
+ * order and column `i` of the eigenvectors belongs to eigenvalue `i`.
+ * <p>See <code>eigen_decompose()</code> for more information.
+ *
+ * @tparam EigMat type of the matrix
+ * @param m Specified matrix.
+ * @return A tuple of the eigenvalues and the eigenvectors of the matrix.
+ */
+template <typename EigMat, require_eigen_t<EigMat>* = nullptr,
+          require_not_st_var<EigMat>* = nullptr>
+std::tuple<Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic, 1>,
+           Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic, Eigen::Dynamic>>
+eigendecompose_sym(const EigMat& m) {
+  using PlainMat = plain_type_t<EigMat>;
+  const PlainMat& m_eval = m;
+  check_nonzero_size("eigendecompose_sym", "m", m_eval);
+  check_symmetric("eigendecompose_sym", "m", m_eval);
+
+  Eigen::SelfAdjointEigenSolver<PlainMat> solver(m_eval);
+  return std::make_tuple(solver.eigenvalues(), solver.eigenvectors());
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -19,7 +19,8 @@ namespace math {
  * @param m Specified matrix.
  * @return Eigenvalues of matrix.
  */
-template <typename EigMat, require_eigen_t<EigMat>* = nullptr>
+template <typename EigMat, require_eigen_t<EigMat>* = nullptr,
+          require_not_st_var<EigMat>* = nullptr>
 Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic, 1> eigenvalues_sym(
     const EigMat& m) {
   using PlainMat = plain_type_t<EigMat>;
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -32,6 +33,27 @@ inverse(const EigMat& m) {
   return m.inverse();
 }
 
+/**
+ * Return the inverse of each matrix of a batch.
+ *
+ * The reverse mode overload stores the batch contiguously on the arena
+ * and registers a single callback for it.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices
+ * @param m batch of square matrices
+ * @return inverses of the matrices
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
+inline std::vector<plain_type_t<value_type_t<T>>> inverse(const T& m) {
+  std::vector<plain_type_t<value_type_t<T>>> res;
+  res.reserve(m.size());
+  for (const auto& m_k : m) {
+    res.emplace_back(inverse(m_k));
+  }
+  return res;
+}
+
 }  // namespace math
 }  // namespace stan
 
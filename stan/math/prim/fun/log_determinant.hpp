@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -27,6 +28,27 @@ inline value_type_t<EigMat> log_determinant(const EigMat& m) {
   return m.colPivHouseholderQr().logAbsDeterminant();
 }
 
+/**
+ * Return the log absolute determinant of each matrix of a batch.
+ *
+ * The reverse mode overload stores the batch contiguously on the arena
+ * and registers a single callback for it.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices
+ * @param m batch of square matrices
+ * @return log absolute determinants of the matrices
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
+inline std::vector<scalar_type_t<T>> log_determinant(const T& m) {
+  std::vector<scalar_type_t<T>> res;
+  res.reserve(m.size());
+  for (const auto& m_k : m) {
+    res.emplace_back(log_determinant(m_k));
+  }
+  return res;
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -4,6 +4,7 @@
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/sparse_llt.hpp>
 #include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <cmath>
@@ -31,6 +32,33 @@ inline value_type_t<EigMat> log_determinant_spd(const EigMat& m) {
   return sum(log(m_ref.ldlt().vectorD().array()));
 }
 
+/**
+ * Returns the log determinant of the specified symmetric,
+ * positive-definite sparse matrix.
+ *
+ * The matrix is factored with a sparse Cholesky decomposition whose
+ * fill-reducing ordering is reused across calls with the same
+ * sparsity pattern.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @param m specified sparse matrix
+ * @return log determinant of the matrix
+ * @throw std::domain_error if matrix is not square, symmetric and
+ * positive definite
+ */
+template <int Options, typename StorageIndex>
+inline double log_determinant_spd(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& m) {
+  check_symmetric("log_determinant_spd", "m", m);
+  if (m.size() == 0) {
+    return 0;
+  }
+  internal::sparse_llt_factor llt
+      = internal::sparse_llt("log_determinant_spd", "m", m);
+  return 2.0 * sum(log(llt.L.diagonal().array()));
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -0,0 +1,84 @@
+#ifndef STAN_MATH_PRIM_FUN_MATRIX_BATCH_HPP
+#define STAN_MATH_PRIM_FUN_MATRIX_BATCH_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Call `f` with `std::integral_constant<int, N>`, where `N` is the
+ * matrix size `n` if it is between 2 and 8 and `Eigen::Dynamic`
+ * otherwise.
+ *
+ * Batched functions use `N` as the compile time size of their kernels
+ * so that the small matrices common in hierarchical models are
+ * processed with fixed-size Eigen types that live on the stack.
+ *
+ * @tparam F type of the functor
+ * @param n number of rows and columns of the matrices
+ * @param f functor
+ */
+template <typename F>
+inline void fixed_size_dispatch(Eigen::Index n, F&& f) {
+  switch (n) {
+    case 2:
+      f(std::integral_constant<int, 2>());
+      break;
+    case 3:
+      f(std::integral_constant<int, 3>());
+      break;
+    case 4:
+      f(std::integral_constant<int, 4>());
+      break;
+    case 5:
+      f(std::integral_constant<int, 5>());
+      break;
+    case 6:
+      f(std::integral_constant<int, 6>());
+      break;
+    case 7:
+      f(std::integral_constant<int, 7>());
+      break;
+    case 8:
+      f(std::integral_constant<int, 8>());
+      break;
+    default:
+      f(std::integral_constant<int, Eigen::Dynamic>());
+  }
+}
+
+/**
+ * Check that all matrices of a batch are square and of the same size
+ * and return that size.
+ *
+ * @tparam T type of the matrices
+ * @param function name of the calling function (for error messages)
+ * @param name name of the batch (for error messages)
+ * @param batch non-empty batch of matrices
+ * @return number of rows of the matrices
+ * @throw std::invalid_argument if a matrix is not square or the sizes
+ * of the matrices differ
+ */
+template <typename T>
+inline Eigen::Index check_square_batch(const char* function, const char* name,
+                                       const std::vector<T>& batch) {
+  const Eigen::Index n = batch[0].rows();
+  for (const auto& m : batch) {
+    check_square(function, name, m);
+    check_size_match(function, "Rows of first matrix", n, "rows of matrix",
+                     m.rows());
+  }
+  return n;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
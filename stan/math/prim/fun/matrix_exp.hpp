@@ -7,6 +7,7 @@
 #include <stan/math/prim/fun/matrix_exp_2x2.hpp>
 #include <stan/math/prim/fun/square.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -38,8 +39,29 @@ inline plain_type_t<T> matrix_exp(const T& A_in) {
           && square(value_of(A(0, 0)) - value_of(A(1, 1)))
                      + 4 * value_of(A(0, 1)) * value_of(A(1, 0))
                  > 0)
-             ? matrix_exp_2x2(A)
-             : matrix_exp_pade(A);
+             ? plain_type_t<T>(matrix_exp_2x2(A))
+             : plain_type_t<T>(matrix_exp_pade(A));
+}
+
+/**
+ * Return the matrix exponential of each matrix of a batch.
+ *
+ * The reverse mode overload stores the batch contiguously on the arena
+ * and registers a single callback for it.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices
+ * @param A batch of square matrices
+ * @return matrix exponentials of the matrices
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
+inline std::vector<plain_type_t<value_type_t<T>>> matrix_exp(const T& A) {
+  std::vector<plain_type_t<value_type_t<T>>> res;
+  res.reserve(A.size());
+  for (const auto& A_k : A) {
+    res.emplace_back(matrix_exp(A_k));
+  }
+  return res;
 }
 
 }  // namespace math
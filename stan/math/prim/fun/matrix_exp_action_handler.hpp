@@ -38,6 +38,10 @@ class matrix_exp_action_handler {
  public:
   /**
    * Perform the matrix exponential action exp(A*t)*B
+   *
+   * All columns of B are propagated together, so every Taylor term
+   * is a single matrix product.
+   *
    * @param [in] mat matrix A
    * @param [in] b matrix B
    * @param [in] t double t, e.g. time.
@@ -57,36 +61,24 @@ class matrix_exp_action_handler {
     int m{0}, s{0};
     set_approximation_parameter(A, t, m, s);
 
-    Eigen::MatrixXd res(A.rows(), b.cols());
-
-    for (int col = 0; col < b.cols(); ++col) {
-      bool conv = false;
-      Eigen::VectorXd B = b.col(col);
-      Eigen::VectorXd F = B;
-      const auto eta = std::exp(t * mu / s);
-      for (int i = 1; i < s + 1; ++i) {
-        auto c1 = B.template lpNorm<Eigen::Infinity>();
-        if (m > 0) {
-          for (int j = 1; j < m + 1; ++j) {
-            B = t * A * B / (s * j);
-            auto c2 = B.template lpNorm<Eigen::Infinity>();
-            F += B;
-            if (c1 + c2 < tol * F.template lpNorm<Eigen::Infinity>()) {
-              conv = true;
-              break;
-            }
-            c1 = c2;
-          }
-        }
-        F *= eta;
-        B = F;
-        if (conv) {
+    Eigen::MatrixXd B = b;
+    Eigen::MatrixXd F = B;
+    const auto eta = std::exp(t * mu / s);
+    for (int i = 1; i < s + 1; ++i) {
+      auto c1 = B.template lpNorm<Eigen::Infinity>();
+      for (int j = 1; j < m + 1; ++j) {
+        B = (t / (s * j)) * (A * B);
+        auto c2 = B.template lpNorm<Eigen::Infinity>();
+        F += B;
+        if (c1 + c2 < tol * F.template lpNorm<Eigen::Infinity>()) {
           break;
         }
+        c1 = c2;
       }
-      res.col(col) = F;
-    }  // loop b columns
-    return res;
+      F *= eta;
+      B = F;
+    }
+    return F;
   }
 
   /**
@@ -106,7 +98,7 @@ class matrix_exp_action_handler {
    */
   inline void set_approximation_parameter(const Eigen::MatrixXd& mat,
                                           const double& t, int& m, int& s) {
-    if (l1norm(mat) < tol || t < tol) {
+    if (l1norm(mat) < tol || std::abs(t) < tol) {
       m = 0;
       s = 1;
     } else {
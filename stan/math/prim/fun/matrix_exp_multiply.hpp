@@ -3,7 +3,9 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/matrix_exp.hpp>
 #include <stan/math/prim/fun/matrix_exp_action_handler.hpp>
+#include <stan/math/prim/fun/multiply.hpp>
 
 namespace stan {
 namespace math {
@@ -31,6 +33,32 @@ matrix_exp_multiply(const EigMat1& A, const EigMat2& B) {
   return matrix_exp_action_handler().action(A, B);
 }
 
+/**
+ * Return product of exp(A) and B, where A is a NxN matrix and B is a
+ * NxCb matrix, at least one of them holding forward mode autodiff
+ * variables.
+ *
+ * @tparam EigMat1 type of the first matrix
+ * @tparam EigMat2 type of the second matrix
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return exponential of A multiplies B
+ */
+template <typename EigMat1, typename EigMat2,
+          require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+          require_any_st_fvar<EigMat1, EigMat2>* = nullptr>
+inline Eigen::Matrix<return_type_t<EigMat1, EigMat2>, Eigen::Dynamic,
+                     EigMat2::ColsAtCompileTime>
+matrix_exp_multiply(const EigMat1& A, const EigMat2& B) {
+  check_square("matrix_exp_multiply", "input matrix", A);
+  check_multiplicable("matrix_exp_multiply", "A", A, "B", B);
+  if (A.size() == 0) {
+    return {0, B.cols()};
+  }
+
+  return multiply(matrix_exp(A), B);
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -38,6 +39,33 @@ mdivide_left(const T1& A, const T2& b) {
                            T2::ColsAtCompileTime>(b));
 }
 
+/**
+ * Return the solution of the system \f$A_k X_k = B_k\f$ for each pair
+ * of a batch of matrices and a batch of right-hand sides.
+ *
+ * The reverse mode overload stores the batches contiguously on the arena
+ * and registers a single callback for them.
+ *
+ * @tparam T1 type of the batch of matrices
+ * @tparam T2 type of the batch of right-hand sides
+ * @param A batch of square matrices
+ * @param B batch of right-hand sides
+ * @return solutions of the systems
+ * @throw std::invalid_argument if the batches differ in length
+ */
+template <typename T1, typename T2,
+          require_all_std_vector_vt<is_eigen, T1, T2>* = nullptr,
+          require_all_not_st_var<T1, T2>* = nullptr>
+inline auto mdivide_left(const T1& A, const T2& B) {
+  check_matching_sizes("mdivide_left", "A", A, "B", B);
+  std::vector<decltype(mdivide_left(A[0], B[0]))> res;
+  res.reserve(A.size());
+  for (size_t k = 0; k < A.size(); ++k) {
+    res.emplace_back(mdivide_left(A[k], B[k]));
+  }
+  return res;
+}
+
 }  // namespace math
 }  // namespace stan
 
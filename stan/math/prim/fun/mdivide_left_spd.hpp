@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/sparse_llt.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 
 namespace stan {
@@ -48,6 +49,34 @@ mdivide_left_spd(const EigMat1& A, const EigMat2& b) {
                     EigMat2::ColsAtCompileTime>(b));
 }
 
+/**
+ * Returns the solution of the system Ax=b where A is a symmetric
+ * positive-definite sparse matrix.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam EigMat type of the right-hand side matrix or vector
+ *
+ * @param A Sparse matrix.
+ * @param b Right hand side matrix or vector.
+ * @return x = A^-1 b, solution of the linear system.
+ * @throws std::domain_error if A is not square, symmetric and positive
+ * definite or the rows of b don't match the size of A.
+ */
+template <int Options, typename StorageIndex, typename EigMat,
+          require_eigen_vt<std::is_arithmetic, EigMat>* = nullptr>
+inline Eigen::Matrix<double, Eigen::Dynamic, EigMat::ColsAtCompileTime>
+mdivide_left_spd(const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+                 const EigMat& b) {
+  static const char* function = "mdivide_left_spd";
+  check_multiplicable(function, "A", A, "b", b);
+  check_symmetric(function, "A", A);
+  if (A.size() == 0) {
+    return {0, b.cols()};
+  }
+  return internal::sparse_llt(function, "A", A).solve(b);
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -9,6 +9,52 @@
 namespace stan {
 namespace math {
 
+#ifdef STAN_OPENCL
+namespace internal {
+/**
+ * Solves the system Ax=b with a lower triangular matrix of doubles on the
+ * OpenCL device if that is predicted to be faster.
+ *
+ * Only declared here, so prim does not depend on the OpenCL backend. It is
+ * defined in `stan/math/opencl/offload.hpp`, which `stan/math/prim.hpp`
+ * includes if OpenCL is enabled.
+ *
+ * @tparam TriView Specifies whether A is upper (Eigen::Upper)
+ * or lower triangular (Eigen::Lower). Only lower triangular systems are
+ * offloaded.
+ * @tparam T1 type of the triangular matrix
+ * @tparam T2 type of the right-hand side matrix or vector
+ * @tparam T_res type of the result
+ * @param A Triangular matrix.
+ * @param b Right hand side matrix or vector.
+ * @param[out] res x = A^-1 b, set only if the return value is true.
+ * @return whether the system was solved
+ */
+template <Eigen::UpLoType TriView, typename T1, typename T2, typename T_res,
+          require_all_vt_same<double, T1, T2>* = nullptr>
+inline bool mdivide_left_tri_offload(const T1 &A, const T2 &b, T_res &res);
+
+/**
+ * Only systems with matrices of doubles are offloaded to the OpenCL device.
+ *
+ * @tparam TriView Specifies whether A is upper (Eigen::Upper)
+ * or lower triangular (Eigen::Lower).
+ * @tparam T1 type of the triangular matrix
+ * @tparam T2 type of the right-hand side matrix or vector
+ * @tparam T_res type of the result
+ * @param A Triangular matrix.
+ * @param b Right hand side matrix or vector.
+ * @param[out] res x = A^-1 b, not used.
+ * @return false
+ */
+template <Eigen::UpLoType TriView, typename T1, typename T2, typename T_res,
+          require_any_not_vt_same<double, T1, T2>* = nullptr>
+inline bool mdivide_left_tri_offload(const T1 &A, const T2 &b, T_res &res) {
+  return false;
+}
+}  // namespace internal
+#endif
+
 /**
  * Returns the solution of the system Ax=b when A is triangular.
  *
@@ -35,6 +81,12 @@ mdivide_left_tri(const T1 &A, const T2 &b) {
   if (A.rows() == 0) {
     return {0, b.cols()};
   }
+#ifdef STAN_OPENCL
+  Eigen::Matrix<T_return, T1::RowsAtCompileTime, T2::ColsAtCompileTime> res;
+  if (internal::mdivide_left_tri_offload<TriView>(A, b, res)) {
+    return res;
+  }
+#endif
 
   return A.template cast<T_return>()
       .eval()
@@ -60,6 +112,11 @@ inline plain_type_t<T> mdivide_left_tri(const T &A) {
 
   int n = A.rows();
   plain_type_t<T> b = plain_type_t<T>::Identity(n, n);
+#ifdef STAN_OPENCL
+  if (internal::mdivide_left_tri_offload<TriView>(A, b, b)) {
+    return b;
+  }
+#endif
   A.template triangularView<TriView>().solveInPlace(b);
   return b;
 }
@@ -44,11 +44,61 @@ inline auto multiply(Scal c, const Mat& m) {
   return c * m;
 }
 
+#ifdef STAN_OPENCL
+namespace internal {
+/**
+ * Return the product of the specified matrices of doubles, computed on the
+ * OpenCL device if that is predicted to be faster. The result is a plain
+ * matrix rather than a product expression, as where it is computed is only
+ * decided at runtime.
+ *
+ * Only declared here, so prim does not depend on the OpenCL backend. It is
+ * defined in `stan/math/opencl/offload.hpp`, which `stan/math/prim.hpp`
+ * includes if OpenCL is enabled.
+ *
+ * @tparam Mat1 type of the first matrix or expression
+ * @tparam Mat2 type of the second matrix or expression
+ * @tparam T_return type of the result
+ *
+ * @param m1 first matrix or expression
+ * @param m2 second matrix or expression
+ * @return the product of the first and second matrices
+ */
+template <typename Mat1, typename Mat2,
+          typename T_return = plain_type_t<decltype(std::declval<Mat1>()
+                                                    * std::declval<Mat2>())>,
+          require_all_vt_same<double, Mat1, Mat2>* = nullptr>
+inline T_return multiply_offload(const Mat1& m1, const Mat2& m2);
+
+/**
+ * Return the product of the specified matrices. Only matrices of doubles are
+ * offloaded to the OpenCL device.
+ *
+ * @tparam Mat1 type of the first matrix or expression
+ * @tparam Mat2 type of the second matrix or expression
+ *
+ * @param m1 first matrix or expression
+ * @param m2 second matrix or expression
+ * @return the product of the first and second matrices
+ */
+template <typename Mat1, typename Mat2,
+          require_any_not_vt_same<double, Mat1, Mat2>* = nullptr>
+inline auto multiply_offload(const Mat1& m1, const Mat2& m2) {
+  return m1 * m2;
+}
+}  // namespace internal
+#endif
+
 /**
  * Return the product of the specified matrices. The number of
  * columns in the first matrix must be the same as the number of rows
  * in the second matrix.
  *
+ * With OpenCL enabled, large products of matrices of doubles are computed on
+ * the OpenCL device (see `opencl_offload_multiply()`). The product of
+ * matrices of doubles is then returned as a plain matrix rather than as a
+ * product expression.
+ *
  * @tparam Mat1 type of the first matrix or expression
  * @tparam Mat2 type of the second matrix or expression
  *
@@ -64,7 +114,11 @@ template <typename Mat1, typename Mat2,
 inline auto multiply(const Mat1& m1, const Mat2& m2) {
   check_size_match("multiply", "Columns of m1", m1.cols(), "Rows of m2",
                    m2.rows());
+#ifdef STAN_OPENCL
+  return internal::multiply_offload(m1, m2);
+#else
   return m1 * m2;
+#endif
 }
 
 /**
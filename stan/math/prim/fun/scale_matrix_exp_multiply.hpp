@@ -41,7 +41,7 @@ scale_matrix_exp_multiply(const double& t, const EigMat1& A, const EigMat2& B) {
  * Return product of exp(At) and B, where A is a NxN matrix,
  * B is a NxCb matrix and t is a scalar.
  *
- * Generic implementation when arguments are not all double.
+ * Generic implementation for forward mode autodiff arguments.
  *
  * @tparam Tt type of \c t
  * @tparam EigMat1 type of the first matrix
@@ -53,8 +53,8 @@ scale_matrix_exp_multiply(const double& t, const EigMat1& A, const EigMat2& B) {
  */
 template <typename Tt, typename EigMat1, typename EigMat2,
           require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
-          require_any_autodiff_t<Tt, value_type_t<EigMat1>,
-                                 value_type_t<EigMat2>>* = nullptr>
+          require_any_fvar_t<Tt, value_type_t<EigMat1>,
+                             value_type_t<EigMat2>>* = nullptr>
 inline Eigen::Matrix<return_type_t<Tt, EigMat1, EigMat2>, Eigen::Dynamic,
                      EigMat2::ColsAtCompileTime>
 scale_matrix_exp_multiply(const Tt& t, const EigMat1& A, const EigMat2& B) {
@@ -0,0 +1,215 @@
+#ifndef STAN_MATH_PRIM_FUN_SPARSE_LLT_HPP
+#define STAN_MATH_PRIM_FUN_SPARSE_LLT_HPP
+
+#include <stan/math/prim/core.hpp>
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+using sparse_llt_t
+    = Eigen::SimplicialLLT<Eigen::SparseMatrix<double>, Eigen::Lower,
+                           Eigen::AMDOrdering<int>>;
+
+/**
+ * Overwrite `X` with \f$ A^{-1} X \f$ given the factor and the
+ * fill-reducing permutation of \f$ P A P^T = L L^T \f$.
+ *
+ * This lets reverse passes solve with a factor copied to the arena.
+ *
+ * @tparam SpMat type of the sparse lower triangular factor
+ * @tparam VecI type of the permutation indices
+ * @tparam EigMat type of the right-hand side
+ * @param L lower triangular factor
+ * @param perm indices of the permutation \f$ P \f$
+ * @param[in, out] X right-hand side, overwritten with the solution
+ */
+template <typename SpMat, typename VecI, typename EigMat>
+inline void sparse_llt_solve_in_place(const SpMat& L, const VecI& perm,
+                                      EigMat& X) {
+  plain_type_t<EigMat> tmp(X.rows(), X.cols());
+  for (Eigen::Index i = 0; i < X.rows(); ++i) {
+    tmp.row(perm.coeff(i)) = X.row(i);
+  }
+  L.template triangularView<Eigen::Lower>().solveInPlace(tmp);
+  L.transpose().template triangularView<Eigen::Upper>().solveInPlace(tmp);
+  for (Eigen::Index i = 0; i < X.rows(); ++i) {
+    X.row(i) = tmp.row(perm.coeff(i));
+  }
+}
+
+/**
+ * Factor \f$ P A P^T = L L^T \f$ of a symmetric, positive-definite
+ * sparse matrix, owning copies of the factor and the permutation.
+ */
+struct sparse_llt_factor {
+  /**
+   * Lower triangular factor \f$ L \f$.
+   */
+  Eigen::SparseMatrix<double> L;
+  /**
+   * Indices of the fill-reducing permutation \f$ P \f$.
+   */
+  Eigen::VectorXi perm;
+
+  /**
+   * Return \f$ A^{-1} b \f$.
+   *
+   * @tparam EigMat type of the right-hand side
+   * @param b right-hand side
+   * @return solution of \f$ A x = b \f$
+   */
+  template <typename EigMat>
+  inline plain_type_t<EigMat> solve(const EigMat& b) const {
+    plain_type_t<EigMat> x = b;
+    sparse_llt_solve_in_place(L, perm, x);
+    return x;
+  }
+};
+
+/**
+ * Solver and sparsity pattern last analyzed on a thread.
+ */
+struct sparse_llt_analysis {
+  sparse_llt_t llt;
+  std::vector<int> outer;
+  std::vector<int> inner;
+};
+
+/**
+ * Return the per-thread solver state of `sparse_llt`.
+ *
+ * Held through a lazily allocated pointer so it can be declared with
+ * `STAN_THREADS_DEF`, which only allows trivial types.
+ *
+ * @return solver and pattern last analyzed on this thread
+ */
+inline sparse_llt_analysis& sparse_llt_state() {
+  static STAN_THREADS_DEF sparse_llt_analysis* state = nullptr;
+  if (state == nullptr) {
+    state = new sparse_llt_analysis();
+  }
+  return *state;
+}
+
+/**
+ * Return the sparse Cholesky factorization of a symmetric,
+ * positive-definite sparse matrix.
+ *
+ * The fill-reducing ordering and the symbolic factorization are kept
+ * per thread and reused as long as the sparsity pattern matches the
+ * one last analyzed, so repeated calls with the same pattern only run
+ * the numeric factorization. The factor and permutation are copied
+ * out, so the result stays valid across later calls.
+ *
+ * @param function name of the calling function (for error messages)
+ * @param name name of the matrix (for error messages)
+ * @param A symmetric, positive-definite sparse matrix
+ * @return factorization of `A`
+ * @throw std::domain_error if `A` is not positive definite
+ */
+inline sparse_llt_factor sparse_llt(const char* function, const char* name,
+                                    const Eigen::SparseMatrix<double>& A) {
+  if (!A.isCompressed()) {
+    Eigen::SparseMatrix<double> A_compressed = A;
+    A_compressed.makeCompressed();
+    return sparse_llt(function, name, A_compressed);
+  }
+  sparse_llt_analysis& state = sparse_llt_state();
+  std::vector<int>& outer = state.outer;
+  std::vector<int>& inner = state.inner;
+  const int* A_outer = A.outerIndexPtr();
+  const int* A_inner = A.innerIndexPtr();
+  const size_t nnz = A.nonZeros();
+  if (outer.size() != static_cast<size_t>(A.outerSize()) + 1
+      || inner.size() != nnz || !std::equal(outer.begin(), outer.end(), A_outer)
+      || !std::equal(inner.begin(), inner.end(), A_inner)) {
+    state.llt.analyzePattern(A);
+    outer.assign(A_outer, A_outer + A.outerSize() + 1);
+    inner.assign(A_inner, A_inner + nnz);
+  }
+  state.llt.factorize(A);
+  check_pos_definite(function, name, state.llt);
+  return {state.llt.matrixL().nestedExpression(),
+          state.llt.permutationP().indices()};
+}
+
+/**
+ * Return the entries of the inverse of a symmetric, positive-definite
+ * sparse matrix inside its sparsity pattern, given its factorization.
+ *
+ * With the permuted factorization \f$ P A P^T = L L^T \f$ the selected
+ * inverse \f$ Z = (L L^T)^{-1} \f$ is formed only on the pattern of
+ * \f$ L \f$ using the Takahashi recursion
+ * \f$ Z_{ji} = (\delta_{ij} / L_{ii} - \sum_{k > i} L_{ki} Z_{kj}) / L_{ii}
+ * \f$, which needs nothing outside of that pattern. The entries of
+ * \f$ A^{-1} \f$ on the pattern of `A` are then read off of \f$ Z \f$.
+ * The factorization only reads the lower triangle of `A`, so entries
+ * stored above the diagonal without a mirror below it get zero.
+ *
+ * @tparam SpMat type of the sparse matrix
+ * @param llt factorization of `A`
+ * @param A compressed sparse matrix that was factored
+ * @return entries of \f$ A^{-1} \f$ in the storage order of `A`
+ */
+template <typename SpMat>
+inline Eigen::VectorXd sparse_selected_inverse(const sparse_llt_factor& llt,
+                                               const SpMat& A) {
+  const Eigen::SparseMatrix<double>& L = llt.L;
+  const int n = L.cols();
+  const int* outer = L.outerIndexPtr();
+  const int* inner = L.innerIndexPtr();
+  const double* l = L.valuePtr();
+  std::vector<double> z(L.nonZeros());
+  // columns of L hold the diagonal first, then rows in increasing order
+  const auto z_at = [&](int row, int col) {
+    if (row == col) {
+      return z[outer[col]];
+    } else if (row < col) {
+      std::swap(row, col);
+    }
+    const int* end = inner + outer[col + 1];
+    const int* pos = std::lower_bound(inner + outer[col] + 1, end, row);
+    return pos != end && *pos == row ? z[pos - inner] : 0.0;
+  };
+  for (int i = n - 1; i >= 0; --i) {
+    const int diag = outer[i];
+    const int end = outer[i + 1];
+    const double inv_l_ii = 1.0 / l[diag];
+    for (int p = end - 1; p > diag; --p) {
+      const int j = inner[p];
+      double sum = 0;
+      for (int q = diag + 1; q < end; ++q) {
+        sum += l[q] * z_at(inner[q], j);
+      }
+      z[p] = -sum * inv_l_ii;
+    }
+    double sum = 0;
+    for (int q = diag + 1; q < end; ++q) {
+      sum += l[q] * z[q];
+    }
+    z[diag] = (inv_l_ii - sum) * inv_l_ii;
+  }
+
+  const Eigen::VectorXi& perm = llt.perm;
+  Eigen::VectorXd A_inv(A.nonZeros());
+  Eigen::Index pos = 0;
+  for (Eigen::Index k = 0; k < A.outerSize(); ++k) {
+    for (typename SpMat::InnerIterator it(A, k); it; ++it) {
+      A_inv.coeffRef(pos++)
+          = z_at(perm.coeff(it.row()), perm.coeff(it.col()));
+    }
+  }
+  return A_inv;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef STAN_MATH_PRIM_FUN_TRANSPOSE_MULTIPLY_HPP
+#define STAN_MATH_PRIM_FUN_TRANSPOSE_MULTIPLY_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the product of the transpose of the first matrix and the second
+ * matrix, \f$ A^T B \f$, without forming the transpose of `A`. The first
+ * matrix may be sparse.
+ *
+ * @tparam T1 type of the first matrix
+ * @tparam T2 type of the second matrix or vector
+ * @param A first matrix
+ * @param B second matrix or vector
+ * @return A' * B
+ * @throw std::invalid_argument if A and B do not have the same number
+ * of rows
+ */
+template <typename T1, typename T2, require_all_eigen_t<T1, T2>* = nullptr,
+          require_all_st_arithmetic<T1, T2>* = nullptr>
+inline auto transpose_multiply(const T1& A, const T2& B) {
+  check_size_match("transpose_multiply", "Rows of ", "A", A.rows(),
+                   "Rows of ", "B", B.rows());
+  return (A.transpose() * B).eval();
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
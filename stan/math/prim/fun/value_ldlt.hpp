@@ -0,0 +1,31 @@
+#ifndef STAN_MATH_PRIM_FUN_VALUE_LDLT_HPP
+#define STAN_MATH_PRIM_FUN_VALUE_LDLT_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the LDLT of the values of a matrix. For matrices of vars the
+ * factorization is cached for the rest of the gradient evaluation, see
+ * the reverse mode overload.
+ *
+ * @tparam Scalar scalar type of the factorization
+ * @tparam T type of the matrix
+ * @param A matrix
+ * @return LDLT of the values of the matrix
+ */
+template <typename Scalar, typename T, require_eigen_t<T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
+inline Eigen::LDLT<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>
+value_ldlt(const T& A) {
+  return Eigen::LDLT<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(
+      value_of(A).template cast<Scalar>());
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,52 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_ARITHMETIC_LOG_DENSITY_HPP
+#define STAN_MATH_PRIM_FUNCTOR_ARITHMETIC_LOG_DENSITY_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/size_zero.hpp>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/** \ingroup prob_dists
+ * Return the log density of a distribution whose arguments are all
+ * arithmetic, so there are no partials to compute.
+ *
+ * <p>`check_args()` runs the argument checks of the general overload.
+ * If nothing is included with `propto`, or an argument is empty, only
+ * the checks run and the result is 0. Otherwise
+ * `log_density(valid)` accumulates the density in a single loop that
+ * does not allocate, clearing `valid` on an invalid argument instead
+ * of throwing, and the checks are rerun to throw the same exception.
+ *
+ * @tparam propto whether to drop constant terms
+ * @tparam CheckArgs type of the argument checks
+ * @tparam LogDensity type of the density loop
+ * @tparam Args types of the arguments of the distribution
+ * @param check_args functor validating the arguments
+ * @param log_density functor taking a `bool&` flag and returning the
+ * log density
+ * @param args arguments of the distribution
+ * @return log density
+ */
+template <bool propto, typename CheckArgs, typename LogDensity,
+          typename... Args>
+inline double arithmetic_log_density(const CheckArgs& check_args,
+                                     const LogDensity& log_density,
+                                     const Args&... args) {
+  if (!include_summand<propto>::value || size_zero(args...)) {
+    check_args();
+    return 0.0;
+  }
+  bool valid = true;
+  const double logp = log_density(valid);
+  if (unlikely(!valid)) {
+    check_args();
+  }
+  return logp;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -3,9 +3,55 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 
 namespace stan {
 namespace math {
+namespace internal {
+
+/**
+ * Return the sixth-order finite difference approximation of the
+ * partial derivative of the specified function along one dimension.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] i dimension of the partial derivative
+ * @param[in] epsilon perturbation size
+ * @param[in, out] x_temp copy of `x`, perturbed and restored in place
+ * @return partial derivative of function along dimension `i`
+ */
+template <typename F>
+inline double finite_diff_partial(const F& f, const Eigen::VectorXd& x, int i,
+                                  double epsilon, Eigen::VectorXd& x_temp) {
+  double delta_f = 0.0;
+
+  x_temp(i) = x(i) + 3.0 * epsilon;
+  delta_f = f(x_temp);
+
+  x_temp(i) = x(i) + 2.0 * epsilon;
+  delta_f -= 9.0 * f(x_temp);
+
+  x_temp(i) = x(i) + epsilon;
+  delta_f += 45.0 * f(x_temp);
+
+  x_temp(i) = x(i) + -3.0 * epsilon;
+  delta_f -= f(x_temp);
+
+  x_temp(i) = x(i) + -2.0 * epsilon;
+  delta_f += 9.0 * f(x_temp);
+
+  x_temp(i) = x(i) + -epsilon;
+  delta_f -= 45.0 * f(x_temp);
+
+  delta_f /= 60 * epsilon;
+
+  x_temp(i) = x(i);
+  return delta_f;
+}
+
+}  // namespace internal
 
 /**
  * Calculate the value and the gradient of the specified function
@@ -49,32 +95,42 @@ void finite_diff_gradient(const F& f, const Eigen::VectorXd& x, double& fx,
   fx = f(x);
 
   for (int i = 0; i < d; ++i) {
-    double delta_f = 0.0;
-
-    x_temp(i) = x(i) + 3.0 * epsilon;
-    delta_f = f(x_temp);
-
-    x_temp(i) = x(i) + 2.0 * epsilon;
-    delta_f -= 9.0 * f(x_temp);
-
-    x_temp(i) = x(i) + epsilon;
-    delta_f += 45.0 * f(x_temp);
-
-    x_temp(i) = x(i) + -3.0 * epsilon;
-    delta_f -= f(x_temp);
-
-    x_temp(i) = x(i) + -2.0 * epsilon;
-    delta_f += 9.0 * f(x_temp);
-
-    x_temp(i) = x(i) + -epsilon;
-    delta_f -= 45.0 * f(x_temp);
-
-    delta_f /= 60 * epsilon;
-
-    x_temp(i) = x(i);
-    grad_fx(i) = delta_f;
+    grad_fx(i) = internal::finite_diff_partial(f, x, i, epsilon, x_temp);
   }
 }
+
+/**
+ * Calculate the value and the gradient of the specified function
+ * at the specified argument using finite difference, evaluating the
+ * partial derivatives concurrently with the TBB.
+ *
+ * <p>Each partial derivative is computed exactly as by
+ * <code>finite_diff_gradient()</code>, so the results are bitwise
+ * identical. The functor must be safe to call concurrently from
+ * several threads.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad_fx Gradient of function at argument
+ * @param[in] epsilon perturbation size
+ */
+template <typename F>
+void finite_diff_gradient_parallel(const F& f, const Eigen::VectorXd& x,
+                                   double& fx, Eigen::VectorXd& grad_fx,
+                                   double epsilon = 1e-03) {
+  grad_fx.resize(x.size());
+  fx = f(x);
+  tbb::parallel_for(tbb::blocked_range<int>(0, x.size()),
+                    [&](const tbb::blocked_range<int>& r) {
+                      Eigen::VectorXd x_temp(x);
+                      for (int i = r.begin(); i < r.end(); ++i) {
+                        grad_fx(i) = internal::finite_diff_partial(
+                            f, x, i, epsilon, x_temp);
+                      }
+                    });
+}
 }  // namespace math
 }  // namespace stan
 #endif
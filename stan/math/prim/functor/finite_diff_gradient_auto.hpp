@@ -3,6 +3,9 @@
 
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/finite_diff_stepsize.hpp>
+#include <stan/math/prim/functor/finite_diff_gradient.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 #include <cmath>
 
 namespace stan {
@@ -53,35 +56,43 @@ void finite_diff_gradient_auto(const F& f, const Eigen::VectorXd& x, double& fx,
   fx = f(x);
   grad_fx.resize(x.size());
   for (int i = 0; i < x.size(); ++i) {
-    double h = finite_diff_stepsize(x(i));
-
-    double delta_f = 0;
-
-    x_temp(i) = x(i) + 3 * h;
-    delta_f += f(x_temp);
-
-    x_temp(i) = x(i) + 2 * h;
-    delta_f -= 9 * f(x_temp);
-
-    x_temp(i) = x(i) + h;
-    delta_f += 45 * f(x_temp);
-
-    x_temp(i) = x(i) + -3 * h;
-    delta_f -= f(x_temp);
-
-    x_temp(i) = x(i) + -2 * h;
-    delta_f += 9 * f(x_temp);
-
-    x_temp(i) = x(i) - h;
-    delta_f -= 45 * f(x_temp);
-
-    delta_f /= 60 * h;
-
-    x_temp(i) = x(i);
-    grad_fx(i) = delta_f;
+    grad_fx(i) = internal::finite_diff_partial(
+        f, x, i, finite_diff_stepsize(x(i)), x_temp);
   }
 }
 
+/**
+ * Calculate the value and the gradient of the specified function
+ * at the specified argument using finite difference with automatically
+ * chosen step sizes, evaluating the partial derivatives concurrently
+ * with the TBB.
+ *
+ * <p>Each partial derivative is computed exactly as by
+ * <code>finite_diff_gradient_auto()</code>, so the results are bitwise
+ * identical. The functor must be safe to call concurrently from
+ * several threads.
+ *
+ * @tparam F Type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[out] fx function applied to argument
+ * @param[out] grad_fx gradient of function at argument
+ */
+template <typename F>
+void finite_diff_gradient_auto_parallel(const F& f, const Eigen::VectorXd& x,
+                                        double& fx, Eigen::VectorXd& grad_fx) {
+  grad_fx.resize(x.size());
+  fx = f(x);
+  tbb::parallel_for(tbb::blocked_range<int>(0, x.size()),
+                    [&](const tbb::blocked_range<int>& r) {
+                      Eigen::VectorXd x_temp(x);
+                      for (int i = r.begin(); i < r.end(); ++i) {
+                        grad_fx(i) = internal::finite_diff_partial(
+                            f, x, i, finite_diff_stepsize(x(i)), x_temp);
+                      }
+                    });
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
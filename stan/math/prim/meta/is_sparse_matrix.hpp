@@ -0,0 +1,41 @@
+#ifndef STAN_MATH_PRIM_META_IS_SPARSE_MATRIX_HPP
+#define STAN_MATH_PRIM_META_IS_SPARSE_MATRIX_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/meta/bool_constant.hpp>
+#include <stan/math/prim/meta/is_eigen_sparse_base.hpp>
+#include <stan/math/prim/meta/is_var.hpp>
+#include <stan/math/prim/meta/require_helpers.hpp>
+#include <stan/math/prim/meta/value_type.hpp>
+#include <type_traits>
+
+namespace stan {
+
+namespace internal {
+template <typename T, typename = void>
+struct is_sparse_matrix_impl : std::false_type {};
+
+template <typename T>
+struct is_sparse_matrix_impl<T, require_t<is_eigen_sparse_base<T>>>
+    : std::true_type {};
+
+template <typename T>
+struct is_sparse_matrix_impl<T, require_t<is_var<T>>>
+    : bool_constant<is_eigen_sparse_base<value_type_t<T>>::value> {};
+}  // namespace internal
+
+/**
+ * Checks whether type T is derived from Eigen::SparseMatrixBase or is a
+ * `var_value<>` whose inner type is. If true this will have a static member
+ * function named value with a type of true, else value is false.
+ * @tparam T Type to check
+ * @ingroup type_trait
+ */
+template <typename T>
+using is_sparse_matrix = internal::is_sparse_matrix_impl<std::decay_t<T>>;
+
+STAN_ADD_REQUIRE_UNARY(sparse_matrix, is_sparse_matrix, require_eigens_types);
+
+}  // namespace stan
+
+#endif
@@ -10,10 +10,12 @@
 #include <stan/math/prim/fun/inv.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
+#include <stan/math/prim/fun/scalar_seq_view.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/arithmetic_log_density.hpp>
 #include <stan/math/prim/functor/operands_and_partials.hpp>
 #include <cmath>
 
@@ -48,7 +50,8 @@ namespace math {
  */
 template <bool propto, typename T_y, typename T_inv_scale,
           require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
-              T_y, T_inv_scale>* = nullptr>
+              T_y, T_inv_scale>* = nullptr,
+          require_any_not_st_arithmetic<T_y, T_inv_scale>* = nullptr>
 return_type_t<T_y, T_inv_scale> exponential_lpdf(const T_y& y,
                                                  const T_inv_scale& beta) {
   using T_partials_return = partials_return_t<T_y, T_inv_scale>;
@@ -102,6 +105,62 @@ return_type_t<T_y, T_inv_scale> exponential_lpdf(const T_y& y,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * The log of an exponential density for y with the specified
+ * inverse scale parameter, for arguments that are all arithmetic.
+ *
+ * Without partials to compute, the arguments are validated and the
+ * density is accumulated in a single loop that does not allocate, see
+ * `internal::arithmetic_log_density()`.
+ *
+ * @tparam T_y type of scalar
+ * @tparam T_inv_scale type of inverse scale
+ * @param y A scalar variable.
+ * @param beta Inverse scale parameter.
+ * @throw std::domain_error if beta is not greater than 0.
+ * @throw std::domain_error if y is not greater than or equal to 0.
+ */
+template <bool propto, typename T_y, typename T_inv_scale,
+          require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
+              T_y, T_inv_scale>* = nullptr,
+          require_all_st_arithmetic<T_y, T_inv_scale>* = nullptr>
+inline double exponential_lpdf(const T_y& y, const T_inv_scale& beta) {
+  using std::isfinite;
+  using std::log;
+  static const char* function = "exponential_lpdf";
+  check_consistent_sizes(function, "Random variable", y,
+                         "Inverse scale parameter", beta);
+  decltype(auto) y_ref = to_ref(y);
+  decltype(auto) beta_ref = to_ref(beta);
+  auto check_args = [&]() {
+    check_nonnegative(function, "Random variable", y_ref);
+    check_positive_finite(function, "Inverse scale parameter", beta_ref);
+  };
+  auto log_density = [&](bool& valid) {
+    scalar_seq_view<decltype(y_ref)> y_vec(y_ref);
+    scalar_seq_view<decltype(beta_ref)> beta_vec(beta_ref);
+    size_t N = max_size(y, beta);
+    size_t size_beta = stan::math::size(beta);
+    double beta_dbl = 0;
+    double sum_beta_y = 0;
+    double sum_log_beta = 0;
+    for (size_t n = 0; n < N; ++n) {
+      // a scalar inverse scale is only validated and transformed once
+      if (n < size_beta) {
+        beta_dbl = beta_vec[n];
+        valid &= beta_dbl > 0 && isfinite(beta_dbl);
+        sum_log_beta += log(beta_dbl);
+      }
+      const double y_dbl = y_vec[n];
+      valid &= y_dbl >= 0;
+      sum_beta_y += beta_dbl * y_dbl;
+    }
+    return sum_log_beta * N / size_beta - sum_beta_y;
+  };
+  return internal::arithmetic_log_density<propto>(check_args, log_density, y,
+                                                  beta);
+}
+
 template <typename T_y, typename T_inv_scale>
 inline return_type_t<T_y, T_inv_scale> exponential_lpdf(
     const T_y& y, const T_inv_scale& beta) {
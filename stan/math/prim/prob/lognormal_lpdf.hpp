@@ -11,10 +11,12 @@
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/promote_scalar.hpp>
+#include <stan/math/prim/fun/scalar_seq_view.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/arithmetic_log_density.hpp>
 #include <stan/math/prim/functor/operands_and_partials.hpp>
 #include <cmath>
 
@@ -24,7 +26,8 @@ namespace math {
 // LogNormal(y|mu, sigma)  [y >= 0;  sigma > 0]
 template <bool propto, typename T_y, typename T_loc, typename T_scale,
           require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
-              T_y, T_loc, T_scale>* = nullptr>
+              T_y, T_loc, T_scale>* = nullptr,
+          require_any_not_st_arithmetic<T_y, T_loc, T_scale>* = nullptr>
 return_type_t<T_y, T_loc, T_scale> lognormal_lpdf(const T_y& y, const T_loc& mu,
                                                   const T_scale& sigma) {
   using T_partials_return = partials_return_t<T_y, T_loc, T_scale>;
@@ -100,6 +103,71 @@ return_type_t<T_y, T_loc, T_scale> lognormal_lpdf(const T_y& y, const T_loc& mu,
   return ops_partials.build(logp);
 }
 
+// LogNormal(y|mu, sigma)  [y >= 0;  sigma > 0]
+// Arithmetic arguments are validated and accumulated in one loop
+// without partials or temporaries
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
+              T_y, T_loc, T_scale>* = nullptr,
+          require_all_st_arithmetic<T_y, T_loc, T_scale>* = nullptr>
+inline double lognormal_lpdf(const T_y& y, const T_loc& mu,
+                             const T_scale& sigma) {
+  using std::isfinite;
+  using std::log;
+  static const char* function = "lognormal_lpdf";
+  check_consistent_sizes(function, "Random variable", y, "Location parameter",
+                         mu, "Scale parameter", sigma);
+  decltype(auto) y_ref = to_ref(y);
+  decltype(auto) mu_ref = to_ref(mu);
+  decltype(auto) sigma_ref = to_ref(sigma);
+  auto check_args = [&]() {
+    check_nonnegative(function, "Random variable", y_ref);
+    check_finite(function, "Location parameter", mu_ref);
+    check_positive_finite(function, "Scale parameter", sigma_ref);
+  };
+  auto log_density = [&](bool& valid) {
+    scalar_seq_view<decltype(y_ref)> y_vec(y_ref);
+    scalar_seq_view<decltype(mu_ref)> mu_vec(mu_ref);
+    scalar_seq_view<decltype(sigma_ref)> sigma_vec(sigma_ref);
+    size_t N = max_size(y, mu, sigma);
+    size_t size_y = stan::math::size(y);
+    size_t size_sigma = stan::math::size(sigma);
+    double log_y = 0;
+    double inv_sigma = 0;
+    double sum_sq = 0;
+    double sum_log_y = 0;
+    double sum_log_sigma = 0;
+    bool y_zero = false;
+    for (size_t n = 0; n < N; ++n) {
+      // scalar arguments are only validated and transformed once
+      if (n < size_y) {
+        const double y_dbl = y_vec[n];
+        valid &= y_dbl >= 0;
+        y_zero |= y_dbl == 0;
+        log_y = log(y_dbl);
+        sum_log_y += log_y;
+      }
+      const double mu_dbl = mu_vec[n];
+      valid &= isfinite(mu_dbl);
+      if (n < size_sigma) {
+        const double sigma_dbl = sigma_vec[n];
+        valid &= sigma_dbl > 0 && isfinite(sigma_dbl);
+        inv_sigma = 1.0 / sigma_dbl;
+        sum_log_sigma += log(sigma_dbl);
+      }
+      const double logy_m_mu_scaled = (log_y - mu_dbl) * inv_sigma;
+      sum_sq += logy_m_mu_scaled * logy_m_mu_scaled;
+    }
+    if (y_zero) {
+      return LOG_ZERO;
+    }
+    return N * NEG_LOG_SQRT_TWO_PI - 0.5 * sum_sq
+           - sum_log_sigma * N / size_sigma - sum_log_y * N / size_y;
+  };
+  return internal::arithmetic_log_density<propto>(check_args, log_density, y,
+                                                  mu, sigma);
+}
+
 template <typename T_y, typename T_loc, typename T_scale>
 inline return_type_t<T_y, T_loc, T_scale> lognormal_lpdf(const T_y& y,
                                                          const T_loc& mu,
@@ -3,25 +3,58 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
-#include <stan/math/prim/fun/as_column_vector_or_scalar.hpp>
+#include <stan/math/prim/fun/as_value_column_vector_or_scalar.hpp>
 #include <stan/math/prim/fun/constants.hpp>
-#include <stan/math/prim/fun/log_determinant_ldlt.hpp>
+#include <stan/math/prim/fun/dot_product.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size_mvt.hpp>
 #include <stan/math/prim/fun/size_mvt.hpp>
-#include <stan/math/prim/fun/to_ref.hpp>
-#include <stan/math/prim/fun/trace_inv_quad_form_ldlt.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_ldlt.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/fun/vector_seq_view.hpp>
+#include <stan/math/prim/functor/operands_and_partials.hpp>
 
 namespace stan {
 namespace math {
 
+/** \ingroup multivar_dists
+ * The log of the multivariate normal density for the given y, mu, and
+ * variance matrix Sigma.
+ *
+ * Sigma is factored once with an LDLT decomposition, which serves
+ * the log determinant, the quadratic forms and the partials. For a
+ * Sigma of vars the LDLT comes from `value_ldlt()`, which shares it with
+ * the other functions of the log density that factor the same matrix.
+ * The partials of Sigma are formed directly as
+ * \f$ \frac{1}{2} \sum_i (\Sigma^{-1} r_i r_i^T \Sigma^{-1} - \Sigma^{-1})
+ * \f$ with \f$ r_i = y_i - \mu_i \f$, so no intermediate triangular
+ * solves or Cholesky adjoints end up on the autodiff stack.
+ *
+ * @tparam T_y Type of scalar.
+ * @tparam T_loc Type of location.
+ * @tparam T_covar Type of variance matrix.
+ * @param y A scalar vector
+ * @param mu The mean vector of the multivariate normal distribution.
+ * @param Sigma The variance matrix of the multivariate normal
+ * distribution
+ * @return The log of the multivariate normal density.
+ * @throw std::domain_error if Sigma is not square, not symmetric,
+ * or not positive definite.
+ */
 template <bool propto, typename T_y, typename T_loc, typename T_covar>
 return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
                                                      const T_loc& mu,
                                                      const T_covar& Sigma) {
   using T_covar_elem = typename scalar_type<T_covar>::type;
-  using lp_type = return_type_t<T_y, T_loc, T_covar>;
-  using Eigen::Dynamic;
+  using T_return = return_type_t<T_y, T_loc, T_covar>;
+  using T_partials_return = partials_return_t<T_y, T_loc, T_covar>;
+  using matrix_partials_t
+      = Eigen::Matrix<T_partials_return, Eigen::Dynamic, Eigen::Dynamic>;
+  using vector_partials_t = Eigen::Matrix<T_partials_return, Eigen::Dynamic, 1>;
+  using T_y_ref = ref_type_t<T_y>;
+  using T_mu_ref = ref_type_t<T_loc>;
+  using T_Sigma_ref = ref_type_t<T_covar>;
   static const char* function = "multi_normal_lpdf";
   check_positive(function, "Covariance matrix rows", Sigma.rows());
 
@@ -32,9 +65,11 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
     return 0.0;
   }
 
-  lp_type lp(0.0);
-  vector_seq_view<T_y> y_vec(y);
-  vector_seq_view<T_loc> mu_vec(mu);
+  T_y_ref y_ref = y;
+  T_mu_ref mu_ref = mu;
+  T_Sigma_ref Sigma_ref = Sigma;
+  vector_seq_view<T_y_ref> y_vec(y_ref);
+  vector_seq_view<T_mu_ref> mu_vec(mu_ref);
   size_t size_vec = max_size_mvt(y, mu);
 
   int size_y = y_vec[0].size();
@@ -71,35 +106,57 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
     check_finite(function, "Location parameter", mu_vec[i]);
     check_not_nan(function, "Random variable", y_vec[i]);
   }
-  const auto& Sigma_ref = to_ref(Sigma);
   check_symmetric(function, "Covariance matrix", Sigma_ref);
 
-  auto ldlt_Sigma = make_ldlt_factor(Sigma_ref);
-  check_ldlt_factor(function, "LDLT_Factor of covariance parameter",
-                    ldlt_Sigma);
+  const auto& ldlt_Sigma = value_ldlt<T_partials_return>(Sigma_ref);
+  check_pos_definite(function, "Covariance matrix", ldlt_Sigma);
 
   if (size_y == 0) {
-    return lp;
+    return T_return(0);
   }
 
+  operands_and_partials<T_y_ref, T_mu_ref, T_Sigma_ref> ops_partials(
+      y_ref, mu_ref, Sigma_ref);
+
+  T_partials_return logp(0);
   if (include_summand<propto>::value) {
-    lp += NEG_LOG_SQRT_TWO_PI * size_y * size_vec;
+    logp += NEG_LOG_SQRT_TWO_PI * size_y * size_vec;
   }
 
   if (include_summand<propto, T_covar_elem>::value) {
-    lp -= 0.5 * log_determinant_ldlt(ldlt_Sigma) * size_vec;
+    logp -= 0.5 * sum(log(ldlt_Sigma.vectorD())) * size_vec;
+    if (!is_constant_all<T_covar>::value) {
+      ops_partials.edge3_.partials_
+          -= (0.5 * size_vec)
+             * ldlt_Sigma.solve(
+                 matrix_partials_t::Identity(size_y, size_y));
+    }
   }
 
   if (include_summand<propto, T_y, T_loc, T_covar_elem>::value) {
-    lp_type sum_lp_vec(0.0);
     for (size_t i = 0; i < size_vec; i++) {
-      const auto& y_col = as_column_vector_or_scalar(y_vec[i]);
-      const auto& mu_col = as_column_vector_or_scalar(mu_vec[i]);
-      sum_lp_vec += trace_inv_quad_form_ldlt(ldlt_Sigma, y_col - mu_col);
+      decltype(auto) y_val = as_value_column_vector_or_scalar(y_vec[i]);
+      decltype(auto) mu_val = as_value_column_vector_or_scalar(mu_vec[i]);
+      const vector_partials_t diff
+          = (y_val - mu_val).template cast<T_partials_return>();
+      const vector_partials_t scaled_diff = ldlt_Sigma.solve(diff);
+
+      logp -= 0.5 * dot_product(diff, scaled_diff);
+
+      if (!is_constant_all<T_y>::value) {
+        ops_partials.edge1_.partials_vec_[i] -= scaled_diff;
+      }
+      if (!is_constant_all<T_loc>::value) {
+        ops_partials.edge2_.partials_vec_[i] += scaled_diff;
+      }
+      if (!is_constant_all<T_covar>::value) {
+        ops_partials.edge3_.partials_
+            += 0.5 * scaled_diff * scaled_diff.transpose();
+      }
     }
-    lp -= 0.5 * sum_lp_vec;
   }
-  return lp;
+
+  return ops_partials.build(logp);
 }
 
 template <typename T_y, typename T_loc, typename T_covar>
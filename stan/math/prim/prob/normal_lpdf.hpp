@@ -9,10 +9,12 @@
 #include <stan/math/prim/fun/constants.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
+#include <stan/math/prim/fun/scalar_seq_view.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/arithmetic_log_density.hpp>
 #include <stan/math/prim/functor/operands_and_partials.hpp>
 #include <cmath>
 
@@ -40,7 +42,8 @@ namespace math {
  */
 template <bool propto, typename T_y, typename T_loc, typename T_scale,
           require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
-              T_y, T_loc, T_scale>* = nullptr>
+              T_y, T_loc, T_scale>* = nullptr,
+          require_any_not_st_arithmetic<T_y, T_loc, T_scale>* = nullptr>
 inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
                                                       const T_loc& mu,
                                                       const T_scale& sigma) {
@@ -106,6 +109,75 @@ inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * The log of the normal density for the specified scalar(s) given
+ * the specified mean(s) and deviation(s), for arguments that are all
+ * arithmetic.
+ *
+ * <p>Without partials to compute, the arguments are validated and the
+ * density is accumulated in a single loop that does not allocate, see
+ * `internal::arithmetic_log_density()`.
+ *
+ * @tparam T_y type of scalar
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (Sequence of) scalar(s).
+ * @param mu (Sequence of) location parameter(s)
+ * for the normal distribution.
+ * @param sigma (Sequence of) scale parameters for the normal distribution.
+ * @return The log of the product of the densities.
+ * @throw std::domain_error if the scale is not positive.
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
+              T_y, T_loc, T_scale>* = nullptr,
+          require_all_st_arithmetic<T_y, T_loc, T_scale>* = nullptr>
+inline double normal_lpdf(const T_y& y, const T_loc& mu,
+                          const T_scale& sigma) {
+  using std::isfinite;
+  using std::isnan;
+  using std::log;
+  static const char* function = "normal_lpdf";
+  check_consistent_sizes(function, "Random variable", y, "Location parameter",
+                         mu, "Scale parameter", sigma);
+  decltype(auto) y_ref = to_ref(y);
+  decltype(auto) mu_ref = to_ref(mu);
+  decltype(auto) sigma_ref = to_ref(sigma);
+  auto check_args = [&]() {
+    check_not_nan(function, "Random variable", y_ref);
+    check_finite(function, "Location parameter", mu_ref);
+    check_positive(function, "Scale parameter", sigma_ref);
+  };
+  auto log_density = [&](bool& valid) {
+    scalar_seq_view<decltype(y_ref)> y_vec(y_ref);
+    scalar_seq_view<decltype(mu_ref)> mu_vec(mu_ref);
+    scalar_seq_view<decltype(sigma_ref)> sigma_vec(sigma_ref);
+    size_t N = max_size(y, mu, sigma);
+    size_t size_sigma = stan::math::size(sigma);
+    double inv_sigma = 0;
+    double sum_y_scaled_sq = 0;
+    double sum_log_sigma = 0;
+    for (size_t n = 0; n < N; ++n) {
+      const double y_dbl = y_vec[n];
+      const double mu_dbl = mu_vec[n];
+      valid &= !isnan(y_dbl) && isfinite(mu_dbl);
+      // a scalar scale is only validated and transformed once
+      if (n < size_sigma) {
+        const double sigma_dbl = sigma_vec[n];
+        valid &= sigma_dbl > 0;
+        inv_sigma = 1.0 / sigma_dbl;
+        sum_log_sigma += log(sigma_dbl);
+      }
+      const double y_scaled = (y_dbl - mu_dbl) * inv_sigma;
+      sum_y_scaled_sq += y_scaled * y_scaled;
+    }
+    return -0.5 * sum_y_scaled_sq + NEG_LOG_SQRT_TWO_PI * N
+           - sum_log_sigma * N / size_sigma;
+  };
+  return internal::arithmetic_log_density<propto>(check_args, log_density, y,
+                                                  mu, sigma);
+}
+
 template <typename T_y, typename T_loc, typename T_scale>
 inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
                                                       const T_loc& mu,
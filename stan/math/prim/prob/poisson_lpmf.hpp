@@ -16,7 +16,9 @@
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/arithmetic_log_density.hpp>
 #include <stan/math/prim/functor/operands_and_partials.hpp>
 
 namespace stan {
@@ -25,7 +27,8 @@ namespace math {
 // Poisson(n|lambda)  [lambda > 0;  n >= 0]
 template <bool propto, typename T_n, typename T_rate,
           require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
-              T_n, T_rate>* = nullptr>
+              T_n, T_rate>* = nullptr,
+          require_any_not_st_arithmetic<T_n, T_rate>* = nullptr>
 return_type_t<T_rate> poisson_lpmf(const T_n& n, const T_rate& lambda) {
   using T_partials_return = partials_return_t<T_n, T_rate>;
   using T_n_ref = ref_type_if_t<!is_constant<T_n>::value, T_n>;
@@ -81,6 +84,65 @@ return_type_t<T_rate> poisson_lpmf(const T_n& n, const T_rate& lambda) {
   return ops_partials.build(logp);
 }
 
+// Poisson(n|lambda)  [lambda > 0;  n >= 0]
+// Arithmetic arguments are validated and accumulated in one loop
+// without partials or temporaries
+template <bool propto, typename T_n, typename T_rate,
+          require_all_not_nonscalar_prim_or_rev_kernel_expression_t<
+              T_n, T_rate>* = nullptr,
+          require_all_st_arithmetic<T_n, T_rate>* = nullptr>
+inline double poisson_lpmf(const T_n& n, const T_rate& lambda) {
+  using std::isinf;
+  using std::log;
+  static const char* function = "poisson_lpmf";
+  check_consistent_sizes(function, "Random variable", n, "Rate parameter",
+                         lambda);
+  decltype(auto) n_ref = to_ref(n);
+  decltype(auto) lambda_ref = to_ref(lambda);
+  auto check_args = [&]() {
+    check_nonnegative(function, "Random variable", n_ref);
+    check_nonnegative(function, "Rate parameter", lambda_ref);
+  };
+  auto log_density = [&](bool& valid) {
+    scalar_seq_view<decltype(n_ref)> n_vec(n_ref);
+    scalar_seq_view<decltype(lambda_ref)> lambda_vec(lambda_ref);
+    size_t N = max_size(n, lambda);
+    size_t size_n = stan::math::size(n);
+    size_t size_lambda = stan::math::size(lambda);
+    double lambda_dbl = 0;
+    double log_lambda = 0;
+    double logp = 0;
+    double sum_lambda = 0;
+    double sum_lgamma_n = 0;
+    bool log_zero = false;
+    for (size_t i = 0; i < N; ++i) {
+      // a scalar rate is only validated and transformed once
+      if (i < size_lambda) {
+        lambda_dbl = lambda_vec[i];
+        valid &= lambda_dbl >= 0;
+        log_zero |= isinf(lambda_dbl);
+        log_lambda = log(lambda_dbl);
+        sum_lambda += lambda_dbl;
+      }
+      const auto n_i = n_vec[i];
+      valid &= n_i >= 0;
+      if (n_i != 0) {
+        log_zero |= lambda_dbl == 0;
+        logp += n_i * log_lambda;
+      }
+      if (i < size_n) {
+        sum_lgamma_n += lgamma(n_i + 1.0);
+      }
+    }
+    if (log_zero) {
+      return LOG_ZERO;
+    }
+    return logp - sum_lambda * N / size_lambda - sum_lgamma_n * N / size_n;
+  };
+  return internal::arithmetic_log_density<propto>(check_args, log_density, n,
+                                                  lambda);
+}
+
 template <typename T_n, typename T_rate>
 inline return_type_t<T_rate> poisson_lpmf(const T_n& n, const T_rate& lambda) {
   return poisson_lpmf<false>(n, lambda);
@@ -64,6 +64,7 @@
 #include <stan/math/rev/core/std_isnan.hpp>
 #include <stan/math/rev/core/std_numeric_limits.hpp>
 #include <stan/math/rev/core/stored_gradient_vari.hpp>
+#include <stan/math/rev/core/tape_profiler.hpp>
 #include <stan/math/rev/core/typedefs.hpp>
 #include <stan/math/rev/core/v_vari.hpp>
 #include <stan/math/rev/core/var.hpp>
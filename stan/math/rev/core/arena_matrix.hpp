@@ -4,6 +4,8 @@
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/rev/core/chainable_alloc.hpp>
 #include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/meta/arena_type.hpp>
+#include <algorithm>
 
 namespace stan {
 namespace math {
@@ -16,7 +18,8 @@ namespace math {
  * ...)
  */
 template <typename MatrixType>
-class arena_matrix : public Eigen::Map<MatrixType> {
+class arena_matrix<MatrixType, require_eigen_dense_base_t<MatrixType>>
+    : public Eigen::Map<MatrixType> {
  public:
   using Scalar = value_type_t<MatrixType>;
   using Base = Eigen::Map<MatrixType>;
@@ -130,6 +133,210 @@ class arena_matrix : public Eigen::Map<MatrixType> {
   }
 };
 
+/**
+ * Equivalent to `Eigen::SparseMatrix`, except that the non-zero values and
+ * the inner and outer indices are stored on the AD stack. Several
+ * `arena_matrix`es can share one set of indices, as the value and the
+ * adjoint of a sparse `vari` do.
+ *
+ * @tparam MatrixType Eigen sparse matrix type this works as
+ * (`SparseMatrix<double>` ...)
+ */
+template <typename MatrixType>
+class arena_matrix<MatrixType, require_eigen_sparse_base_t<MatrixType>>
+    : public Eigen::Map<MatrixType> {
+ public:
+  using Scalar = value_type_t<MatrixType>;
+  using Base = Eigen::Map<MatrixType>;
+  using PlainObject = std::decay_t<MatrixType>;
+  using StorageIndex = typename PlainObject::StorageIndex;
+  static constexpr int RowsAtCompileTime = MatrixType::RowsAtCompileTime;
+  static constexpr int ColsAtCompileTime = MatrixType::ColsAtCompileTime;
+
+  /**
+   * Default constructor.
+   */
+  arena_matrix() : Base::Map(0, 0, 0, nullptr, nullptr, nullptr) {}
+
+  /**
+   * Constructs `arena_matrix` from compressed storage that is already on
+   * the AD stack. Nothing is copied.
+   * @param rows number of rows
+   * @param cols number of columns
+   * @param nnz number of non-zero values
+   * @param outer_index index of where each outer vector starts
+   * @param inner_index inner index of each non-zero value
+   * @param values non-zero values
+   */
+  arena_matrix(Eigen::Index rows, Eigen::Index cols, Eigen::Index nnz,
+               StorageIndex* outer_index, StorageIndex* inner_index,
+               Scalar* values)
+      : Base::Map(rows, cols, nnz, outer_index, inner_index, values) {}
+
+  /**
+   * Constructs `arena_matrix` from a sparse expression.
+   * @param other expression
+   */
+  template <typename T, require_eigen_sparse_base_t<T>* = nullptr>
+  arena_matrix(const T& other)  // NOLINT
+      : Base::Map(0, 0, 0, nullptr, nullptr, nullptr) {
+    *this = other;
+  }
+
+  /**
+   * Constructs `arena_matrix` from an `Eigen::Map`. This makes an assumption
+   * that any other `Eigen::Map` also contains memory allocated in the arena.
+   * @param other expression
+   */
+  arena_matrix(const Base& other)  // NOLINT
+      : Base::Map(other) {}
+
+  /**
+   * Copy constructor. The copy shares the storage of `other`.
+   * @param other matrix to copy from
+   */
+  arena_matrix(const arena_matrix<MatrixType>& other)
+      : Base::Map(other.rows(), other.cols(), other.nonZeros(),
+                  const_cast<StorageIndex*>(other.outerIndexPtr()),
+                  const_cast<StorageIndex*>(other.innerIndexPtr()),
+                  const_cast<Scalar*>(other.valuePtr())) {}
+
+  /**
+   * Return a new `arena_matrix` with the sparsity pattern of this one
+   * and all of its non-zero values set to zero. The indices are shared,
+   * only the values are allocated.
+   */
+  inline arena_matrix<MatrixType> zeros_like() const {
+    arena_matrix<MatrixType> ret(
+        this->rows(), this->cols(), this->nonZeros(),
+        const_cast<StorageIndex*>(this->outerIndexPtr()),
+        const_cast<StorageIndex*>(this->innerIndexPtr()),
+        ChainableStack::instance_->memalloc_.alloc_array<Scalar>(
+            this->nonZeros()));
+    ret.coeffs().setZero();
+    return ret;
+  }
+
+  /**
+   * Copy assignment operator. This rebinds to the storage of `other`.
+   * @param other matrix to copy from
+   * @return `*this`
+   */
+  arena_matrix& operator=(const arena_matrix<MatrixType>& other) {
+    // placement new changes what data map points to - there is no allocation
+    new (this) Base(other.rows(), other.cols(), other.nonZeros(),
+                    const_cast<StorageIndex*>(other.outerIndexPtr()),
+                    const_cast<StorageIndex*>(other.innerIndexPtr()),
+                    const_cast<Scalar*>(other.valuePtr()));
+    return *this;
+  }
+
+  /**
+   * Assignment operator for assigning a sparse expression. The result is
+   * evaluated and its compressed storage is copied to the AD stack.
+   * @param a expression to evaluate into this
+   * @return `*this`
+   */
+  template <typename T, require_eigen_sparse_base_t<T>* = nullptr>
+  arena_matrix& operator=(const T& a) {
+    PlainObject x(a);
+    x.makeCompressed();
+    auto& memalloc = ChainableStack::instance_->memalloc_;
+    const Eigen::Index nnz = x.nonZeros();
+    StorageIndex* outer_index
+        = memalloc.alloc_array<StorageIndex>(x.outerSize() + 1);
+    StorageIndex* inner_index = memalloc.alloc_array<StorageIndex>(nnz);
+    Scalar* values = memalloc.alloc_array<Scalar>(nnz);
+    std::copy_n(x.outerIndexPtr(), x.outerSize() + 1, outer_index);
+    std::copy_n(x.innerIndexPtr(), nnz, inner_index);
+    std::copy_n(x.valuePtr(), nnz, values);
+    // placement new changes what data map points to - there is no allocation
+    new (this) Base(x.rows(), x.cols(), nnz, outer_index, inner_index, values);
+    return *this;
+  }
+
+  /**
+   * Add a sparse expression to this matrix. Only the entries inside the
+   * sparsity pattern of this matrix are updated, entries of `other`
+   * outside of it are dropped.
+   * @param other sparse expression with the storage order of this matrix
+   * @return `*this`
+   */
+  template <typename T>
+  arena_matrix& operator+=(const Eigen::SparseMatrixBase<T>& other) {
+    inplace_op([](Scalar& x, Scalar y) { x += y; }, other.derived());
+    return *this;
+  }
+
+  /**
+   * Subtract a sparse expression from this matrix. Only the entries inside
+   * the sparsity pattern of this matrix are updated, entries of `other`
+   * outside of it are dropped.
+   * @param other sparse expression with the storage order of this matrix
+   * @return `*this`
+   */
+  template <typename T>
+  arena_matrix& operator-=(const Eigen::SparseMatrixBase<T>& other) {
+    inplace_op([](Scalar& x, Scalar y) { x -= y; }, other.derived());
+    return *this;
+  }
+
+  /**
+   * Add the entries of a dense expression that fall inside the sparsity
+   * pattern of this matrix.
+   * @param other dense expression
+   * @return `*this`
+   */
+  template <typename T>
+  arena_matrix& operator+=(const Eigen::MatrixBase<T>& other) {
+    inplace_op([](Scalar& x, Scalar y) { x += y; }, other.derived());
+    return *this;
+  }
+
+  /**
+   * Subtract the entries of a dense expression that fall inside the
+   * sparsity pattern of this matrix.
+   * @param other dense expression
+   * @return `*this`
+   */
+  template <typename T>
+  arena_matrix& operator-=(const Eigen::MatrixBase<T>& other) {
+    inplace_op([](Scalar& x, Scalar y) { x -= y; }, other.derived());
+    return *this;
+  }
+
+ private:
+  template <typename F, typename T, require_eigen_sparse_base_t<T>* = nullptr>
+  inline void inplace_op(F&& f, const T& other) {
+    Eigen::internal::evaluator<T> other_eval(other);
+    for (Eigen::Index k = 0; k < this->outerSize(); ++k) {
+      typename Base::InnerIterator it(*this, k);
+      typename Eigen::internal::evaluator<T>::InnerIterator iz(other_eval, k);
+      while (it && iz) {
+        if (it.index() < iz.index()) {
+          ++it;
+        } else if (iz.index() < it.index()) {
+          ++iz;
+        } else {
+          f(it.valueRef(), iz.value());
+          ++it;
+          ++iz;
+        }
+      }
+    }
+  }
+
+  template <typename F, typename T, require_eigen_dense_base_t<T>* = nullptr>
+  inline void inplace_op(F&& f, const T& other) {
+    const auto& other_ref = other.eval();
+    for (Eigen::Index k = 0; k < this->outerSize(); ++k) {
+      for (typename Base::InnerIterator it(*this, k); it; ++it) {
+        f(it.valueRef(), other_ref.coeff(it.row(), it.col()));
+      }
+    }
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 
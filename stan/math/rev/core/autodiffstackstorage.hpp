@@ -2,28 +2,12 @@
 #define STAN_MATH_REV_CORE_AUTODIFFSTACKSTORAGE_HPP
 
 #include <stan/math/memory/stack_alloc.hpp>
+#include <stan/math/prim/core/stan_threads_def.hpp>
 #include <vector>
 
 namespace stan {
 namespace math {
 
-// Internal macro used to modify global pointer definition to the
-// global AD instance.
-#ifdef STAN_THREADS
-// Whenever STAN_THREADS is set a TLS keyword is used. For reasons
-// explained below we use the GNU compiler extension __thread if
-// supported by the compiler while the generic thread_local C++11
-// keyword is used otherwise.
-#ifdef __GNUC__
-#define STAN_THREADS_DEF __thread
-#else
-#define STAN_THREADS_DEF thread_local
-#endif
-#else
-// In case STAN_THREADS is not set, then no modifier is needed.
-#define STAN_THREADS_DEF
-#endif
-
 /**
  * This struct always provides access to the autodiff stack using
  * the singleton pattern. Read warnings below!
@@ -273,6 +273,71 @@ inline auto add(const T1& a, const T2& b) {
   return a + b;
 }
 
+/**
+ * Addition operator for sparse matrix variables. The sparsity pattern of
+ * the result is the union of the patterns of the operands.
+ *
+ * @tparam T1 A sparse Eigen type.
+ * @tparam T2 A sparse Eigen type.
+ * @param a First variable operand.
+ * @param b Second variable operand.
+ * @return Variable result of adding two variables.
+ */
+template <typename T1, typename T2,
+          require_all_eigen_sparse_base_t<T1, T2>* = nullptr>
+inline var_value<T1> add(const var_value<T1>& a, const var_value<T2>& b) {
+  check_matching_dims("add", "a", a, "b", b);
+  var_value<T1> ret(a.val() + b.val());
+  reverse_pass_callback([ret, a, b]() mutable {
+    a.adj() += ret.adj();
+    b.adj() += ret.adj();
+  });
+  return ret;
+}
+
+/**
+ * Addition operator for a sparse matrix variable and a sparse matrix of
+ * doubles. The sparsity pattern of the result is the union of the
+ * patterns of the operands.
+ *
+ * @tparam T A sparse Eigen type.
+ * @tparam Options storage options of the sparse matrix of doubles
+ * @tparam StorageIndex index type of the sparse matrix of doubles
+ * @param a First variable operand.
+ * @param b Second operand.
+ * @return Variable result of adding two variables.
+ */
+template <typename T, int Options, typename StorageIndex,
+          require_eigen_sparse_base_t<T>* = nullptr>
+inline var_value<T> add(
+    const var_value<T>& a,
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& b) {
+  check_matching_dims("add", "a", a, "b", b);
+  var_value<T> ret(a.val() + b);
+  reverse_pass_callback([ret, a]() mutable { a.adj() += ret.adj(); });
+  return ret;
+}
+
+/**
+ * Addition operator for a sparse matrix of doubles and a sparse matrix
+ * variable. The sparsity pattern of the result is the union of the
+ * patterns of the operands.
+ *
+ * @tparam Options storage options of the sparse matrix of doubles
+ * @tparam StorageIndex index type of the sparse matrix of doubles
+ * @tparam T A sparse Eigen type.
+ * @param a First operand.
+ * @param b Second variable operand.
+ * @return Variable result of adding two variables.
+ */
+template <int Options, typename StorageIndex, typename T,
+          require_eigen_sparse_base_t<T>* = nullptr>
+inline var_value<T> add(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& a,
+    const var_value<T>& b) {
+  return add(b, a);
+}
+
 /**
  * Addition operator for matrix variables.
  *
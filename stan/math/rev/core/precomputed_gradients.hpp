@@ -13,6 +13,39 @@
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Merges runs of repeated operands in place, summing their gradients,
+ * so the reverse pass touches each of them once. Repeated operands
+ * come from scalars broadcast into containers, like `rep_vector()`, or
+ * the same scalar passed as several arguments.
+ *
+ * @param[in, out] varis operand implementations
+ * @param[in, out] gradients gradients with respect to operands
+ * @param[in] size number of operands
+ * @return number of operands after merging
+ */
+inline size_t merge_repeated_operands(vari** varis, double* gradients,
+                                      size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  size_t last = 0;
+  for (size_t i = 1; i < size; ++i) {
+    if (varis[i] == varis[last]) {
+      gradients[last] += gradients[i];
+    } else {
+      ++last;
+      varis[last] = varis[i];
+      gradients[last] = gradients[i];
+    }
+  }
+  return last + 1;
+}
+
+}  // namespace internal
+
 /**
  * A variable implementation taking a sequence of operands and
  * partial derivatives with respect to the operands.
@@ -166,7 +199,8 @@ class precomputed_gradients_vari_template : public vari {
   template <typename Op, typename Grad,
             require_all_not_std_vector_t<Op, Grad>* = nullptr>
   void chain_one(Op& op, const Grad& grad) {
-    op.vi_->adj_ = op.vi_->adj_ + this->adj_ * grad;
+    // in place, as block views of the operand map into its adjoint
+    op.vi_->adj_ += this->adj_ * grad;
   }
 
   /**
@@ -191,7 +225,8 @@ using precomputed_gradients_vari
 /**
  * This function returns a var for an expression that has the
  * specified value, vector of operands, and vector of partial
- * derivatives of value with respect to the operands.
+ * derivatives of value with respect to the operands. Runs of repeated
+ * operands are merged.
  *
  * @tparam Arith An arithmetic type
  * @tparam VecVar A vector of vars
@@ -215,10 +250,21 @@ inline var precomputed_gradients(
     const std::tuple<ContainerOperands...>& container_operands = std::tuple<>(),
     const std::tuple<ContainerGradients...>& container_gradients
     = std::tuple<>()) {
+  check_consistent_sizes("precomputed_gradients", "operands", operands,
+                         "gradients", gradients);
+  const size_t n = operands.size();
+  vari** varis = ChainableStack::instance_->memalloc_.alloc_array<vari*>(n);
+  double* partials
+      = ChainableStack::instance_->memalloc_.alloc_array<double>(n);
+  for (size_t i = 0; i < n; ++i) {
+    varis[i] = operands[i].vi_;
+    partials[i] = gradients[i];
+  }
+  const size_t size = internal::merge_repeated_operands(varis, partials, n);
   return {new precomputed_gradients_vari_template<
       std::tuple<arena_t<ContainerOperands>...>,
       std::tuple<arena_t<ContainerGradients>...>>(
-      value, operands, gradients, container_operands, container_gradients)};
+      value, size, varis, partials, container_operands, container_gradients)};
 }
 
 }  // namespace math
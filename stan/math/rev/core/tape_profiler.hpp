@@ -0,0 +1,188 @@
+#ifndef STAN_MATH_REV_CORE_TAPE_PROFILER_HPP
+#define STAN_MATH_REV_CORE_TAPE_PROFILER_HPP
+
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/empty_nested.hpp>
+#include <stan/math/rev/core/nested_size.hpp>
+#include <stan/math/rev/core/vari.hpp>
+#include <boost/core/demangle.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Statistics of the nodes of one type on the autodiff tape.
+ */
+struct tape_profile_entry {
+  /** Number of nodes. */
+  std::size_t count = 0;
+  /** Estimated arena bytes used by the nodes. */
+  std::size_t bytes = 0;
+  /** Time spent in the `chain()` methods of the nodes, in seconds. */
+  double chain_time = 0;
+};
+
+/**
+ * Histogram of the nodes on the autodiff tape by their dynamic type.
+ *
+ * `record()` walks the chaining and the non-chaining stacks of the
+ * current nested scope, or of the whole tape if not nested, and adds
+ * the count and the arena bytes of the nodes to the histogram. The
+ * bytes of a node are estimated as the distance in the arena to the
+ * next node, so they include the memory allocated after the node and
+ * before the next one, like the operands of a `var_value<Matrix>`.
+ *
+ * `grad()` runs the reverse pass like `stan::math::grad()`, timing each
+ * call to `chain()`. Timing every node adds some overhead to the
+ * reverse pass, so the times are mostly useful relative to each other.
+ *
+ * Profiling is opt-in: nothing is collected unless these methods are
+ * called, and the tape itself is not changed.
+ */
+class tape_profiler {
+  std::map<std::type_index, tape_profile_entry> entries_;
+
+ public:
+  /**
+   * Add the nodes on the tape of the current nested scope to the
+   * histogram.
+   */
+  inline void record() {
+    auto& stack = *ChainableStack::instance_;
+    std::vector<const vari_base*> nodes;
+    const std::size_t chain_end = stack.var_stack_.size();
+    const std::size_t chain_begin
+        = empty_nested() ? 0 : chain_end - nested_size();
+    const std::size_t nochain_end = stack.var_nochain_stack_.size();
+    const std::size_t nochain_begin
+        = empty_nested() ? 0 : stack.nested_var_nochain_stack_sizes_.back();
+    nodes.reserve(chain_end - chain_begin + nochain_end - nochain_begin);
+    for (std::size_t i = chain_begin; i < chain_end; ++i) {
+      nodes.push_back(stack.var_stack_[i]);
+    }
+    for (std::size_t i = nochain_begin; i < nochain_end; ++i) {
+      nodes.push_back(stack.var_nochain_stack_[i]);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+      tape_profile_entry& entry = entries_[typeid(*nodes[i])];
+      entry.count++;
+      const char* begin = reinterpret_cast<const char*>(nodes[i]);
+      const char* end = stack.memalloc_.used_end(begin);
+      if (end == nullptr) {
+        continue;
+      }
+      if (i + 1 < nodes.size()) {
+        const char* next = reinterpret_cast<const char*>(nodes[i + 1]);
+        end = std::min(end, next);
+      }
+      entry.bytes += end - begin;
+    }
+  }
+
+  /**
+   * Run the reverse pass of the current nested scope from the
+   * specified root, timing the `chain()` method of each node.
+   *
+   * @tparam Vari type of the root
+   * @param vi root of the reverse pass
+   */
+  template <typename Vari>
+  inline void grad(Vari* vi) {
+    using clock = std::chrono::steady_clock;
+    vi->init_dependent();
+    auto& var_stack = ChainableStack::instance_->var_stack_;
+    const std::size_t end = var_stack.size();
+    const std::size_t begin = empty_nested() ? 0 : end - nested_size();
+    for (std::size_t i = end; i-- > begin;) {
+      vari_base* node = var_stack[i];
+      const clock::time_point start = clock::now();
+      node->chain();
+      const std::chrono::duration<double> elapsed = clock::now() - start;
+      entries_[typeid(*node)].chain_time += elapsed.count();
+    }
+  }
+
+  /**
+   * Return the histogram, with demangled type names, sorted by
+   * decreasing count.
+   *
+   * @return pairs of type names and statistics
+   */
+  inline std::vector<std::pair<std::string, tape_profile_entry>> entries()
+      const {
+    std::vector<std::pair<std::string, tape_profile_entry>> res;
+    for (const auto& entry : entries_) {
+      res.emplace_back(boost::core::demangle(entry.first.name()),
+                       entry.second);
+    }
+    std::stable_sort(res.begin(), res.end(),
+                     [](const auto& a, const auto& b) {
+                       return a.second.count > b.second.count;
+                     });
+    return res;
+  }
+
+  /**
+   * Clear the histogram.
+   */
+  inline void clear() { entries_.clear(); }
+
+  /**
+   * Write the histogram as CSV with a header line.
+   *
+   * @param os stream to write to
+   */
+  inline void write_csv(std::ostream& os) const {
+    os << "type,count,bytes,chain_time\n";
+    for (const auto& entry : entries()) {
+      os << '"';
+      for (char c : entry.first) {
+        if (c == '"') {
+          os << '"';
+        }
+        os << c;
+      }
+      os << "\"," << entry.second.count << ',' << entry.second.bytes << ','
+         << entry.second.chain_time << '\n';
+    }
+  }
+
+  /**
+   * Write the histogram as a JSON array of objects.
+   *
+   * @param os stream to write to
+   */
+  inline void write_json(std::ostream& os) const {
+    os << '[';
+    bool first = true;
+    for (const auto& entry : entries()) {
+      os << (first ? "\n" : ",\n") << "  {\"type\": \"";
+      first = false;
+      for (char c : entry.first) {
+        if (c == '"' || c == '\\') {
+          os << '\\';
+        }
+        os << c;
+      }
+      os << "\", \"count\": " << entry.second.count
+         << ", \"bytes\": " << entry.second.bytes
+         << ", \"chain_time\": " << entry.second.chain_time << '}';
+    }
+    os << (first ? "]" : "\n]") << '\n';
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
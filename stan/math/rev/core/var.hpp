@@ -22,6 +22,19 @@ namespace math {
 template <typename Vari>
 static void grad(Vari* vi);
 
+namespace internal {
+/**
+ * Return the number of times the values of a `var_value` matrix were
+ * assigned in place on the current thread, including the restores of the
+ * previous values in the reverse pass. Values computed from a `var_value`
+ * matrix and cached by its vari are only valid while this is unchanged.
+ */
+inline size_t& var_value_assignment_count() {
+  static STAN_THREADS_DEF size_t count = 0;
+  return count;
+}
+}  // namespace internal
+
 /**
  * Independent (input) and dependent (output) variables for gradients.
  *
@@ -990,12 +1003,14 @@ class var_value<
   inline var_value<T>& operator=(const var_value<S>& other) {
     arena_t<plain_type_t<T>> prev_val = vi_->val_;
     vi_->val_ = other.val();
+    ++internal::var_value_assignment_count();
     // no need to change any adjoints - these are just zeros before the reverse
     // pass
 
     reverse_pass_callback(
         [this_vi = this->vi_, other_vi = other.vi_, prev_val]() mutable {
           this_vi->val_ = prev_val;
+          ++internal::var_value_assignment_count();
 
           // we have no way of detecting aliasing between this->vi_->adj_ and
           // other.vi_->adj_, so we must copy adjoint before reseting to zero
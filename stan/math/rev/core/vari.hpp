@@ -191,6 +191,24 @@ class vari_value<T, require_t<std::is_floating_point<T>>> : public vari_base {
     return os << v->val_ << ":" << v->adj_;
   }
 
+ protected:
+  /**
+   * Tag selecting the constructor that does not put the vari on a stack.
+   */
+  struct unstacked {};
+
+  /**
+   * Construct a variable implementation from a value without putting it
+   * on either stack, so neither `grad()` nor `set_zero_all_adjoints()`
+   * see it. This is only available to derived classes whose objects are
+   * not allocated on the arena and which reset their own adjoints.
+   *
+   * @tparam S a floating point type.
+   * @param x Value of the constructed variable.
+   */
+  template <typename S, require_convertible_t<S&, T>* = nullptr>
+  vari_value(S x, unstacked) noexcept : val_(x) {}
+
  private:
   template <typename, typename>
   friend class var_value;
@@ -755,14 +773,16 @@ class vari_value<T, require_all_t<is_plain_type<T>, is_eigen_dense_base<T>>>
  * A variable implementation is constructed with a constant
  * value. It also stores the adjoint for storing the partial
  * derivative with respect to the root of the derivative tree.
+ * The value and the adjoint are stored on the AD stack and share
+ * the inner and outer indices of the value, so the adjoint only
+ * holds entries inside the sparsity pattern of the value.
  *
  */
 template <typename T>
-class vari_value<T, require_eigen_sparse_base_t<T>> : public vari_base,
-                                                      chainable_alloc {
+class vari_value<T, require_eigen_sparse_base_t<T>> : public vari_base {
  public:
   using PlainObject = plain_type_t<T>;  // Base type of Eigen class
-  using value_type = PlainObject;       // vari's adj_ and val_ member type
+  using value_type = PlainObject;       // The underlying type for this class
   /**
    * Rows at compile time
    */
@@ -773,15 +793,15 @@ class vari_value<T, require_eigen_sparse_base_t<T>> : public vari_base,
   static constexpr int ColsAtCompileTime = T::ColsAtCompileTime;
 
   /**
-   * The adjoint of this variable, which is the partial derivative
-   * of this variable with respect to the root variable.
+   * The value of this variable.
    */
-  PlainObject adj_;
+  arena_matrix<PlainObject> val_;
 
   /**
-   * The value of this variable.
+   * The adjoint of this variable, which is the partial derivative
+   * of this variable with respect to the root variable.
    */
-  const PlainObject val_;
+  arena_matrix<PlainObject> adj_;
 
   /**
    * Construct a variable implementation from a value. The
@@ -798,9 +818,7 @@ class vari_value<T, require_eigen_sparse_base_t<T>> : public vari_base,
    * @param x Value of the constructed variable.
    */
   template <typename S, require_convertible_t<S&, T>* = nullptr>
-  explicit vari_value(S&& x)
-      : adj_(x), val_(std::forward<S>(x)), chainable_alloc() {
-    this->set_zero_adjoint();
+  explicit vari_value(S&& x) : val_(x), adj_(val_.zeros_like()) {
     ChainableStack::instance_->var_stack_.push_back(this);
   }
   /**
@@ -821,9 +839,7 @@ class vari_value<T, require_eigen_sparse_base_t<T>> : public vari_base,
    * that its `chain()` method is not called.
    */
   template <typename S, require_convertible_t<S&, T>* = nullptr>
-  vari_value(S&& x, bool stacked)
-      : adj_(x), val_(std::forward<S>(x)), chainable_alloc() {
-    this->set_zero_adjoint();
+  vari_value(S&& x, bool stacked) : val_(x), adj_(val_.zeros_like()) {
     if (stacked) {
       ChainableStack::instance_->var_stack_.push_back(this);
     } else {
@@ -871,26 +887,14 @@ class vari_value<T, require_eigen_sparse_base_t<T>> : public vari_base,
    * propagating derivatives, setting the derivative of the
    * result with respect to itself to be 1.
    */
-  inline void init_dependent() {
-    for (int k = 0; k < adj_.outerSize(); ++k) {
-      for (typename PlainObject::InnerIterator it(adj_, k); it; ++it) {
-        it.valueRef() = 1.0;
-      }
-    }
-  }
+  inline void init_dependent() { adj_.coeffs().setOnes(); }
 
   /**
    * Set the adjoint value of this variable to 0.  This is used to
    * reset adjoints before propagating derivatives again (for
    * example in a Jacobian calculation).
    */
-  inline void set_zero_adjoint() noexcept final {
-    for (int k = 0; k < adj_.outerSize(); ++k) {
-      for (typename PlainObject::InnerIterator it(adj_, k); it; ++it) {
-        it.valueRef() = 0.0;
-      }
-    }
-  }
+  inline void set_zero_adjoint() noexcept final { adj_.coeffs().setZero(); }
 
   /**
    * Insertion operator for vari. Prints the current value and
@@ -41,6 +41,7 @@
 #include <stan/math/rev/fun/cov_matrix_constrain.hpp>
 #include <stan/math/rev/fun/cov_exp_quad.hpp>
 #include <stan/math/rev/fun/cov_matrix_constrain_lkj.hpp>
+#include <stan/math/rev/fun/csr_matrix_times_vector.hpp>
 #include <stan/math/rev/fun/determinant.hpp>
 #include <stan/math/rev/fun/diag_pre_multiply.hpp>
 #include <stan/math/rev/fun/digamma.hpp>
@@ -48,6 +49,7 @@
 #include <stan/math/rev/fun/divide.hpp>
 #include <stan/math/rev/fun/dot_product.hpp>
 #include <stan/math/rev/fun/dot_self.hpp>
+#include <stan/math/rev/fun/eigendecompose_sym.hpp>
 #include <stan/math/rev/fun/eigenvalues_sym.hpp>
 #include <stan/math/rev/fun/eigenvectors_sym.hpp>
 #include <stan/math/rev/fun/elt_divide.hpp>
@@ -58,6 +60,7 @@
 #include <stan/math/rev/fun/exp2.hpp>
 #include <stan/math/rev/fun/expm1.hpp>
 #include <stan/math/rev/fun/fabs.hpp>
+#include <stan/math/rev/fun/factorization_cache.hpp>
 #include <stan/math/rev/fun/falling_factorial.hpp>
 #include <stan/math/rev/fun/fdim.hpp>
 #include <stan/math/rev/fun/fill.hpp>
@@ -117,6 +120,8 @@
 #include <stan/math/rev/fun/log_sum_exp.hpp>
 #include <stan/math/rev/fun/logit.hpp>
 #include <stan/math/rev/fun/lub_constrain.hpp>
+#include <stan/math/rev/fun/matrix_batch.hpp>
+#include <stan/math/rev/fun/matrix_exp.hpp>
 #include <stan/math/rev/fun/matrix_exp_multiply.hpp>
 #include <stan/math/rev/fun/matrix_power.hpp>
 #include <stan/math/rev/fun/mdivide_left.hpp>
@@ -138,6 +143,7 @@
 #include <stan/math/rev/fun/proj.hpp>
 #include <stan/math/rev/fun/quad_form.hpp>
 #include <stan/math/rev/fun/quad_form_sym.hpp>
+#include <stan/math/rev/fun/quad_form_tiled.hpp>
 #include <stan/math/rev/fun/read_corr_L.hpp>
 #include <stan/math/rev/fun/read_corr_matrix.hpp>
 #include <stan/math/rev/fun/read_cov_L.hpp>
@@ -147,6 +153,7 @@
 #include <stan/math/rev/fun/round.hpp>
 #include <stan/math/rev/fun/rows_dot_product.hpp>
 #include <stan/math/rev/fun/rows_dot_self.hpp>
+#include <stan/math/rev/fun/scale_matrix_exp_multiply.hpp>
 #include <stan/math/rev/fun/sd.hpp>
 #include <stan/math/rev/fun/simplex_constrain.hpp>
 #include <stan/math/rev/fun/sin.hpp>
@@ -173,10 +180,12 @@
 #include <stan/math/rev/fun/trace_gen_quad_form.hpp>
 #include <stan/math/rev/fun/trace_inv_quad_form_ldlt.hpp>
 #include <stan/math/rev/fun/trace_quad_form.hpp>
+#include <stan/math/rev/fun/transpose_multiply.hpp>
 #include <stan/math/rev/fun/trigamma.hpp>
 #include <stan/math/rev/fun/trunc.hpp>
 #include <stan/math/rev/fun/unit_vector_constrain.hpp>
 #include <stan/math/rev/fun/ub_constrain.hpp>
+#include <stan/math/rev/fun/value_ldlt.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/rev/fun/value_of_rec.hpp>
 #include <stan/math/rev/fun/variance.hpp>
@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_ldlt.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/LDLT_factor.hpp>
 
@@ -13,18 +14,20 @@ namespace math {
  * An LDLT_factor of an `Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>`
  * with `alloc_in_arena = True` holds a copy of the input matrix and the LDLT
  * of its values, with all member variable allocations are done in the arena.
+ * The LDLT is shared through `value_ldlt()` with every other factorization of
+ * the same matrix during the gradient evaluation.
  */
 template <typename T>
 class LDLT_factor<T, require_eigen_matrix_dynamic_vt<is_var, T>> {
  private:
   arena_t<plain_type_t<T>> matrix_;
-  Eigen::LDLT<Eigen::MatrixXd> ldlt_;
+  const Eigen::LDLT<Eigen::MatrixXd>* ldlt_;
 
  public:
   template <typename S,
             require_same_t<plain_type_t<T>, plain_type_t<S>>* = nullptr>
   explicit LDLT_factor(const S& matrix)
-      : matrix_(matrix), ldlt_(matrix.val().ldlt()) {}
+      : matrix_(matrix), ldlt_(&value_ldlt<double>(matrix_)) {}
 
   /**
    * Return a const reference to the underlying matrix
@@ -34,24 +37,25 @@ class LDLT_factor<T, require_eigen_matrix_dynamic_vt<is_var, T>> {
   /**
    * Return a const reference to the LDLT factor of the matrix values
    */
-  const auto& ldlt() const noexcept { return ldlt_; }
+  const auto& ldlt() const noexcept { return *ldlt_; }
 };
 
 /**
  * An LDLT_factor of a `var_value<Eigen::MatrixXd>`
- * holds a copy of the input `var_value` and the LDLT of its values.
+ * holds a copy of the input `var_value` and the LDLT of its values, which
+ * is shared through `value_ldlt()`.
  */
 template <typename T>
 class LDLT_factor<T, require_var_matrix_t<T>> {
  private:
   std::decay_t<T> matrix_;
-  Eigen::LDLT<Eigen::MatrixXd> ldlt_;
+  const Eigen::LDLT<Eigen::MatrixXd>* ldlt_;
 
  public:
   template <typename S,
             require_same_t<plain_type_t<T>, plain_type_t<S>>* = nullptr>
   explicit LDLT_factor(const S& matrix)
-      : matrix_(matrix), ldlt_(matrix.val().ldlt()) {}
+      : matrix_(matrix), ldlt_(&value_ldlt<double>(matrix_)) {}
 
   /**
    * Return a const reference the underlying `var_value`
@@ -61,7 +65,7 @@ class LDLT_factor<T, require_var_matrix_t<T>> {
   /**
    * Return a const reference to the LDLT factor of the matrix values
    */
-  const auto& ldlt() const noexcept { return ldlt_; }
+  const auto& ldlt() const noexcept { return *ldlt_; }
 };
 
 }  // namespace math
@@ -5,8 +5,10 @@
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/fun/cholesky_decompose.hpp>
+#include <stan/math/prim/fun/cholesky_decompose_tiled.hpp>
 #include <stan/math/rev/fun/value_of_rec.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/rev/fun/matrix_batch.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
 #include <stan/math/prim/err/check_pos_definite.hpp>
@@ -119,6 +121,66 @@ inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
     A.adj().template triangularView<Eigen::Lower>() += L_adj;
   };
 }
+
+/**
+ * Parallel version of `cholesky_lambda()` for large matrices.
+ *
+ * The blocks are the tiles of `cholesky_tuning_opts()`. Within each
+ * block step the triangular solve and the update of the rows below the
+ * diagonal block run in parallel over row tiles, and the update of the
+ * rows left of the diagonal block runs in parallel over column tiles.
+ */
+template <typename T1, typename T2, typename T3>
+inline auto tiled_cholesky_lambda(T1& L_A, T2& L, T3& A) {
+  const Eigen::Index tile_size = cholesky_tuning_opts().tile_size;
+  return [L_A, L, A, tile_size]() mutable {
+    using Eigen::Lower;
+    using Eigen::StrictlyUpper;
+    using Eigen::Upper;
+    Eigen::MatrixXd L_adj = Eigen::MatrixXd::Zero(L.rows(), L.cols());
+    L_adj.template triangularView<Eigen::Lower>() = L.adj();
+    const Eigen::Index M_ = L_A.rows();
+    for (Eigen::Index k = M_; k > 0; k -= tile_size) {
+      const Eigen::Index j = std::max(Eigen::Index(0), k - tile_size);
+      const Eigen::Index bs = k - j;
+      auto D = L_A.block(j, j, bs, bs).eval();
+      auto D_adj = L_adj.block(j, j, bs, bs);
+      D.transposeInPlace();
+      if (k < M_) {
+        parallel_for_tiles(k, M_, tile_size,
+                           [&](Eigen::Index i, Eigen::Index rows) {
+                             auto C_adj = L_adj.block(i, j, rows, bs);
+                             D.transpose()
+                                 .template triangularView<Lower>()
+                                 .template solveInPlace<Eigen::OnTheRight>(
+                                     C_adj);
+                             L_adj.block(i, 0, rows, j).noalias()
+                                 -= C_adj * L_A.block(j, 0, bs, j);
+                           });
+        D_adj.noalias() -= L_adj.block(k, j, M_ - k, bs).transpose()
+                           * L_A.block(k, j, M_ - k, bs);
+      }
+      D_adj = (D * D_adj.template triangularView<Lower>()).eval();
+      D_adj.template triangularView<StrictlyUpper>()
+          = D_adj.adjoint().template triangularView<StrictlyUpper>();
+      D.template triangularView<Upper>().solveInPlace(D_adj);
+      D.template triangularView<Upper>().solveInPlace(D_adj.transpose());
+      if (j > 0) {
+        const Eigen::MatrixXd D_adj_sym
+            = D_adj.template selfadjointView<Lower>();
+        parallel_for_tiles(
+            0, j, tile_size, [&](Eigen::Index c, Eigen::Index cols) {
+              auto R_adj = L_adj.block(j, c, bs, cols);
+              R_adj.noalias() -= L_adj.block(k, j, M_ - k, bs).transpose()
+                                 * L_A.block(k, c, M_ - k, cols);
+              R_adj.noalias() -= D_adj_sym * L_A.block(j, c, bs, cols);
+            });
+      }
+      D_adj.diagonal() *= 0.5;
+    }
+    A.adj().template triangularView<Eigen::Lower>() += L_adj;
+  };
+}
 }  // namespace internal
 
 /**
@@ -139,8 +201,16 @@ inline auto cholesky_decompose(const EigMat& A) {
   arena_t<Eigen::Matrix<double, -1, -1>> L_A(arena_A.val());
 
   check_symmetric("cholesky_decompose", "A", A);
-  Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> L_factor(L_A);
-  check_pos_definite("cholesky_decompose", "m", L_factor);
+  if (internal::use_tiled_cholesky(L_A.rows())) {
+    if (!internal::cholesky_tiled_in_place(L_A,
+                                           cholesky_tuning_opts().tile_size)) {
+      throw_domain_error("cholesky_decompose", "Matrix",
+                         " is not positive definite", "m");
+    }
+  } else {
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> L_factor(L_A);
+    check_pos_definite("cholesky_decompose", "m", L_factor);
+  }
 
   L_A.template triangularView<Eigen::StrictlyUpper>().setZero();
   // looping gradient calcs faster for small matrices compared to
@@ -150,6 +220,9 @@ inline auto cholesky_decompose(const EigMat& A) {
   if (L_A.rows() <= 35) {
     internal::initialize_return(L, L_A, dummy);
     reverse_pass_callback(internal::unblocked_cholesky_lambda(L_A, L, arena_A));
+  } else if (internal::use_tiled_cholesky(L_A.rows())) {
+    internal::initialize_return(L, L_A, dummy);
+    reverse_pass_callback(internal::tiled_cholesky_lambda(L_A, L, arena_A));
   } else {
     internal::initialize_return(L, L_A, dummy);
     reverse_pass_callback(internal::cholesky_lambda(L_A, L, arena_A));
@@ -174,12 +247,87 @@ inline auto cholesky_decompose(const T& A) {
   plain_type_t<T> L = cholesky_decompose(A.val());
   if (A.rows() <= 35) {
     reverse_pass_callback(internal::unblocked_cholesky_lambda(L.val(), L, A));
+  } else if (internal::use_tiled_cholesky(A.rows())) {
+    reverse_pass_callback(internal::tiled_cholesky_lambda(L.val(), L, A));
   } else {
     reverse_pass_callback(internal::cholesky_lambda(L.val(), L, A));
   }
   return L;
 }
 
+/**
+ * Return the Cholesky factors of a batch of symmetric,
+ * positive-definite matrices of equal size.
+ *
+ * The batch is stored as one matrix on the arena, the factors are
+ * computed with fixed-size kernels for matrices of size 2 to 8, and a
+ * single reverse pass callback propagates the adjoints of the whole
+ * batch.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices of vars
+ * @param A batch of square, symmetric, positive-definite matrices
+ * @return Cholesky factors of the matrices
+ * @throw std::invalid_argument if a matrix is not square or the sizes of
+ * the matrices differ
+ * @throw std::domain_error if a matrix is not symmetric or not positive
+ * definite
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_std_vector_st<is_var, T>* = nullptr>
+inline auto cholesky_decompose(const T& A) {
+  using ret_type = plain_type_t<value_type_t<T>>;
+  if (A.empty()) {
+    return std::vector<ret_type>();
+  }
+  const Eigen::Index n = internal::check_square_batch("cholesky_decompose",
+                                                      "A", A);
+  if (n == 0) {
+    return std::vector<ret_type>(A.size());
+  }
+  arena_t<Eigen::Matrix<var, -1, -1>> arena_A = internal::to_arena_batch(A);
+  const Eigen::MatrixXd A_val = arena_A.val();
+  arena_t<Eigen::MatrixXd> L_val(n * n, A.size());
+  internal::fixed_size_dispatch(n, [&](auto N_) {
+    constexpr int N = decltype(N_)::value;
+    using mat_t = Eigen::Matrix<double, N, N>;
+    for (size_t k = 0; k < A.size(); ++k) {
+      Eigen::Map<const mat_t> A_k(A_val.col(k).data(), n, n);
+      check_symmetric("cholesky_decompose", "A", A_k);
+      Eigen::LLT<mat_t> llt(A_k);
+      check_pos_definite("cholesky_decompose", "m", llt);
+      Eigen::Map<mat_t>(L_val.col(k).data(), n, n) = llt.matrixL();
+    }
+  });
+  arena_t<Eigen::Matrix<var, -1, -1>> L = L_val;
+
+  reverse_pass_callback([arena_A, L_val, L, n]() mutable {
+    const Eigen::MatrixXd L_adj = L.adj();
+    internal::fixed_size_dispatch(n, [&](auto N_) {
+      constexpr int N = decltype(N_)::value;
+      using mat_t = Eigen::Matrix<double, N, N>;
+      for (Eigen::Index k = 0; k < L.cols(); ++k) {
+        Eigen::Map<const mat_t> L_k(L_val.col(k).data(), n, n);
+        mat_t A_adj = L_k.transpose()
+                      * Eigen::Map<const mat_t>(L_adj.col(k).data(), n, n)
+                            .template triangularView<Eigen::Lower>();
+        A_adj.template triangularView<Eigen::StrictlyUpper>()
+            = A_adj.transpose().template triangularView<Eigen::StrictlyUpper>();
+        L_k.transpose().template triangularView<Eigen::Upper>().solveInPlace(
+            A_adj);
+        L_k.transpose().template triangularView<Eigen::Upper>().solveInPlace(
+            A_adj.transpose());
+        A_adj.diagonal() *= 0.5;
+        for (Eigen::Index j = 0; j < n; ++j) {
+          for (Eigen::Index i = j; i < n; ++i) {
+            arena_A.coeffRef(i + j * n, k).adj() += A_adj.coeff(i, j);
+          }
+        }
+      }
+    });
+  });
+  return internal::from_arena_batch<ret_type>(L, n, n);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,155 @@
+#ifndef STAN_MATH_REV_FUN_CSR_MATRIX_TIMES_VECTOR_HPP
+#define STAN_MATH_REV_FUN_CSR_MATRIX_TIMES_VECTOR_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/csr_u_to_z.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the product of a CSR matrix and a dense vector of values.
+ *
+ * @tparam W type of the non-zero values
+ * @tparam B type of the dense vector
+ * @param m number of rows
+ * @param u zero-based index of where each row starts in w, with a
+ * final one-past-the-end entry
+ * @param v zero-based column index of each non-zero value
+ * @param w non-zero values of the matrix
+ * @param b dense vector
+ */
+template <typename W, typename B>
+inline Eigen::VectorXd csr_times_vector_val(int m, const int* u, const int* v,
+                                            const W& w, const B& b) {
+  Eigen::VectorXd res(m);
+  for (int row = 0; row < m; ++row) {
+    double sum = 0;
+    for (int nze = u[row]; nze < u[row + 1]; ++nze) {
+      sum += w.coeff(nze) * b.coeff(v[nze]);
+    }
+    res.coeffRef(row) = sum;
+  }
+  return res;
+}
+}  // namespace internal
+
+/**
+ * \addtogroup csr_format
+ * Return the multiplication of the sparse matrix (specified by
+ * by values and indexing) by the specified dense vector, where
+ * either the values or the vector are autodiff variables.
+ *
+ * The CSR indexes are validated and copied to the arena once, and
+ * the whole product is a single node on the autodiff stack. The
+ * reverse pass multiplies the result adjoint by the transposed
+ * matrix for the adjoint of b and scatters it over the non-zero
+ * entries for the adjoint of w.
+ *
+ * @tparam T1 type of the sparse matrix
+ * @tparam T2 type of the dense vector
+ * @param m Number of rows in matrix.
+ * @param n Number of columns in matrix.
+ * @param w Vector of non-zero values in matrix.
+ * @param v Column index of each non-zero value, same
+ *          length as w.
+ * @param u Index of where each row starts in w, length equal to
+ *          the number of rows plus one.
+ * @param b Eigen vector which the matrix is multiplied by.
+ * @return Dense vector for the product.
+ * @throw std::domain_error if m and n are not positive or are nan.
+ * @throw std::domain_error if the implied sparse matrix and b are
+ *                          not multiplicable.
+ * @throw std::invalid_argument if m/n/w/v/u are not internally
+ *   consistent, as defined by the indexing scheme.
+ * @throw std::out_of_range if any of the indexes are out of range.
+ */
+template <typename T1, typename T2,
+          require_all_eigen_vector_t<T1, T2>* = nullptr,
+          require_any_st_var<T1, T2>* = nullptr>
+inline Eigen::Matrix<var, Eigen::Dynamic, 1> csr_matrix_times_vector(
+    int m, int n, const T1& w, const std::vector<int>& v,
+    const std::vector<int>& u, const T2& b) {
+  static const char* function = "csr_matrix_times_vector";
+  check_positive(function, "m", m);
+  check_positive(function, "n", n);
+  check_size_match(function, "n", n, "b", b.size());
+  check_size_match(function, "m", m, "u", u.size() - 1);
+  check_size_match(function, "w", w.size(), "v", v.size());
+  check_size_match(function, "u/z", u[m - 1] + csr_u_to_z(u, m - 1) - 1, "v",
+                   v.size());
+
+  int* arena_u = ChainableStack::instance_->memalloc_.alloc_array<int>(m + 1);
+  for (int row = 0; row <= m; ++row) {
+    arena_u[row] = u[row] - stan::error_index::value;
+  }
+  int* arena_v
+      = ChainableStack::instance_->memalloc_.alloc_array<int>(v.size());
+  for (size_t nze = 0; nze < v.size(); ++nze) {
+    check_range(function, "v[]", n, v[nze]);
+    arena_v[nze] = v[nze] - stan::error_index::value;
+  }
+
+  using ret_type = Eigen::Matrix<var, Eigen::Dynamic, 1>;
+  if (!is_constant<T1>::value && !is_constant<T2>::value) {
+    arena_t<promote_scalar_t<var, T1>> arena_w = w;
+    arena_t<promote_scalar_t<var, T2>> arena_b = b;
+    arena_t<ret_type> res = internal::csr_times_vector_val(
+        m, arena_u, arena_v, arena_w.val(), arena_b.val());
+    reverse_pass_callback([m, arena_u, arena_v, arena_w, arena_b,
+                           res]() mutable {
+      for (int row = 0; row < m; ++row) {
+        const double res_adj = res.adj().coeff(row);
+        for (int nze = arena_u[row]; nze < arena_u[row + 1]; ++nze) {
+          const int col = arena_v[nze];
+          arena_w.adj().coeffRef(nze) += res_adj * arena_b.val().coeff(col);
+          arena_b.adj().coeffRef(col) += res_adj * arena_w.val().coeff(nze);
+        }
+      }
+    });
+    return ret_type(res);
+  } else if (!is_constant<T1>::value) {
+    arena_t<promote_scalar_t<var, T1>> arena_w = w;
+    arena_t<promote_scalar_t<double, T2>> arena_b = value_of(b);
+    arena_t<ret_type> res = internal::csr_times_vector_val(
+        m, arena_u, arena_v, arena_w.val(), arena_b);
+    reverse_pass_callback([m, arena_u, arena_v, arena_w, arena_b,
+                           res]() mutable {
+      for (int row = 0; row < m; ++row) {
+        const double res_adj = res.adj().coeff(row);
+        for (int nze = arena_u[row]; nze < arena_u[row + 1]; ++nze) {
+          arena_w.adj().coeffRef(nze)
+              += res_adj * arena_b.coeff(arena_v[nze]);
+        }
+      }
+    });
+    return ret_type(res);
+  } else {
+    arena_t<promote_scalar_t<double, T1>> arena_w = value_of(w);
+    arena_t<promote_scalar_t<var, T2>> arena_b = b;
+    arena_t<ret_type> res = internal::csr_times_vector_val(
+        m, arena_u, arena_v, arena_w, arena_b.val());
+    reverse_pass_callback([m, arena_u, arena_v, arena_w, arena_b,
+                           res]() mutable {
+      for (int row = 0; row < m; ++row) {
+        const double res_adj = res.adj().coeff(row);
+        for (int nze = arena_u[row]; nze < arena_u[row + 1]; ++nze) {
+          arena_b.adj().coeffRef(arena_v[nze])
+              += res_adj * arena_w.coeff(nze);
+        }
+      }
+    });
+    return ret_type(res);
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
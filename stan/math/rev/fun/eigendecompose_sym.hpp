@@ -0,0 +1,127 @@
+#ifndef STAN_MATH_REV_FUN_EIGENDECOMPOSE_SYM_HPP
+#define STAN_MATH_REV_FUN_EIGENDECOMPOSE_SYM_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <tuple>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the adjoint of a symmetric matrix \f$A = V W V^T\f$ given the
+ * adjoint of its eigenvalues only, \f$\bar{A} = V \bar{W} V^T\f$.
+ *
+ * While few eigenvalues have a nonzero adjoint, as for models that use
+ * the smallest or largest eigenvalue, the adjoint is accumulated with a
+ * rank one update of \f$O(n^2)\f$ per eigenvalue instead of forming the
+ * dense product.
+ *
+ * @tparam EigMat type of the eigenvectors
+ * @tparam EigVec type of the adjoint of the eigenvalues
+ * @param v eigenvectors
+ * @param adj_w adjoint of the eigenvalues
+ * @return adjoint of the matrix
+ */
+template <typename EigMat, typename EigVec>
+inline Eigen::MatrixXd eigenvalues_sym_adjoint(const EigMat& v,
+                                               const EigVec& adj_w) {
+  const Eigen::Index M = v.rows();
+  const Eigen::Index nonzero = (adj_w.array() != 0.0).count();
+  if (8 * nonzero > M) {
+    return v * adj_w.asDiagonal() * v.transpose();
+  }
+  Eigen::MatrixXd adjA = Eigen::MatrixXd::Zero(M, M);
+  for (Eigen::Index i = 0; i < M; ++i) {
+    if (adj_w.coeff(i) != 0.0) {
+      adjA.noalias() += (adj_w.coeff(i) * v.col(i)) * v.col(i).transpose();
+    }
+  }
+  return adjA;
+}
+
+/**
+ * Return the adjoint of a symmetric matrix \f$A = V W V^T\f$ given the
+ * adjoints of its eigenvalues and eigenvectors,
+ * \f$\bar{A} = V (\bar{W} + F \circ (V^T \bar{V})) V^T\f$ with
+ * \f$F_{ij} = 1 / (w_j - w_i)\f$ for \f$i \neq j\f$ and zero otherwise.
+ * If the eigenvectors have no adjoint this is
+ * `eigenvalues_sym_adjoint()`.
+ *
+ * Reverse mode differentiation algorithm reference:
+ *
+ * Mike Giles. An extended collection of matrix derivative results for
+ * forward and reverse mode AD.  Jan. 2008.
+ *
+ * Section 3.1 Eigenvalues and eigenvectors.
+ *
+ * @tparam EigVec1 type of the eigenvalues
+ * @tparam EigMat1 type of the eigenvectors
+ * @tparam EigVec2 type of the adjoint of the eigenvalues
+ * @tparam EigMat2 type of the adjoint of the eigenvectors
+ * @param w eigenvalues
+ * @param v eigenvectors
+ * @param adj_w adjoint of the eigenvalues
+ * @param adj_v adjoint of the eigenvectors
+ * @return adjoint of the matrix
+ */
+template <typename EigVec1, typename EigMat1, typename EigVec2,
+          typename EigMat2>
+inline Eigen::MatrixXd eigendecompose_sym_adjoint(const EigVec1& w,
+                                                  const EigMat1& v,
+                                                  const EigVec2& adj_w,
+                                                  const EigMat2& adj_v) {
+  if (adj_v.isZero(0.0)) {
+    return eigenvalues_sym_adjoint(v, adj_w);
+  }
+  const Eigen::Index M = v.rows();
+  Eigen::MatrixXd f = v.transpose() * adj_v;
+  for (Eigen::Index j = 0; j < M; ++j) {
+    for (Eigen::Index i = 0; i < M; ++i) {
+      f.coeffRef(i, j) = i != j ? f.coeff(i, j) / (w.coeff(j) - w.coeff(i))
+                                : adj_w.coeff(i);
+    }
+  }
+  return v * f * v.transpose();
+}
+}  // namespace internal
+
+/**
+ * Return the eigenvalues and eigenvectors of the specified symmetric
+ * matrix from a single decomposition. A single reverse pass callback
+ * propagates the adjoints of both with
+ * `internal::eigendecompose_sym_adjoint()`.
+ * <p>See <code>eigen_decompose()</code> for more information.
+ *
+ * @tparam T type of the matrix
+ * @param m Specified matrix.
+ * @return A tuple of the eigenvalues and the eigenvectors of the matrix.
+ */
+template <typename T, require_rev_matrix_t<T>* = nullptr>
+inline auto eigendecompose_sym(const T& m) {
+  using eigval_return_t = return_var_matrix_t<Eigen::VectorXd, T>;
+  using eigvec_return_t = return_var_matrix_t<Eigen::MatrixXd, T>;
+  check_nonzero_size("eigendecompose_sym", "m", m);
+  auto arena_m = to_arena(m);
+  check_symmetric("eigendecompose_sym", "m", arena_m.val());
+
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(arena_m.val());
+  arena_t<eigval_return_t> eigenvals = solver.eigenvalues();
+  arena_t<eigvec_return_t> eigenvecs = solver.eigenvectors();
+
+  reverse_pass_callback([arena_m, eigenvals, eigenvecs]() mutable {
+    arena_m.adj() += internal::eigendecompose_sym_adjoint(
+        eigenvals.val_op(), eigenvecs.val_op(), eigenvals.adj_op(),
+        eigenvecs.adj_op());
+  });
+
+  return std::make_tuple(eigval_return_t(eigenvals),
+                         eigvec_return_t(eigenvecs));
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
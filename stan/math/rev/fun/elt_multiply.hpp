@@ -62,6 +62,79 @@ auto elt_multiply(const Mat1& m1, const Mat2& m2) {
   }
 }
 
+/**
+ * Return the elementwise multiplication of the specified sparse
+ * matrices. The sparsity pattern of the result is the intersection of
+ * the patterns of the operands.
+ *
+ * @tparam T1 type of the first sparse matrix
+ * @tparam T2 type of the second sparse matrix
+ *
+ * @param m1 First sparse matrix
+ * @param m2 Second sparse matrix
+ * @return Elementwise product of matrices.
+ */
+template <typename T1, typename T2,
+          require_all_eigen_sparse_base_t<T1, T2>* = nullptr>
+inline var_value<T1> elt_multiply(const var_value<T1>& m1,
+                                  const var_value<T2>& m2) {
+  check_matching_dims("elt_multiply", "m1", m1, "m2", m2);
+  var_value<T1> ret(m1.val().cwiseProduct(m2.val()));
+  reverse_pass_callback([ret, m1, m2]() mutable {
+    m1.adj() += ret.adj().cwiseProduct(m2.val());
+    m2.adj() += ret.adj().cwiseProduct(m1.val());
+  });
+  return ret;
+}
+
+/**
+ * Return the elementwise multiplication of a sparse matrix variable and a
+ * sparse matrix of doubles. The sparsity pattern of the result is the
+ * intersection of the patterns of the operands.
+ *
+ * @tparam T type of the sparse matrix variable
+ * @tparam Options storage options of the sparse matrix of doubles
+ * @tparam StorageIndex index type of the sparse matrix of doubles
+ *
+ * @param m1 First sparse matrix
+ * @param m2 Second sparse matrix
+ * @return Elementwise product of matrices.
+ */
+template <typename T, int Options, typename StorageIndex,
+          require_eigen_sparse_base_t<T>* = nullptr>
+inline var_value<T> elt_multiply(
+    const var_value<T>& m1,
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& m2) {
+  check_matching_dims("elt_multiply", "m1", m1, "m2", m2);
+  arena_t<Eigen::SparseMatrix<double, Options, StorageIndex>> arena_m2 = m2;
+  var_value<T> ret(m1.val().cwiseProduct(arena_m2));
+  reverse_pass_callback([ret, m1, arena_m2]() mutable {
+    m1.adj() += ret.adj().cwiseProduct(arena_m2);
+  });
+  return ret;
+}
+
+/**
+ * Return the elementwise multiplication of a sparse matrix of doubles and
+ * a sparse matrix variable. The sparsity pattern of the result is the
+ * intersection of the patterns of the operands.
+ *
+ * @tparam Options storage options of the sparse matrix of doubles
+ * @tparam StorageIndex index type of the sparse matrix of doubles
+ * @tparam T type of the sparse matrix variable
+ *
+ * @param m1 First sparse matrix
+ * @param m2 Second sparse matrix
+ * @return Elementwise product of matrices.
+ */
+template <int Options, typename StorageIndex, typename T,
+          require_eigen_sparse_base_t<T>* = nullptr>
+inline var_value<T> elt_multiply(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& m1,
+    const var_value<T>& m2) {
+  return elt_multiply(m2, m1);
+}
+
 }  // namespace math
 }  // namespace stan
 
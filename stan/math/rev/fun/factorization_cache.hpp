@@ -0,0 +1,211 @@
+#ifndef STAN_MATH_REV_FUN_FACTORIZATION_CACHE_HPP
+#define STAN_MATH_REV_FUN_FACTORIZATION_CACHE_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <unordered_map>
+#include <utility>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * A factorization of the values of a matrix of vars that lives until
+ * the memory of the autodiff stack is recovered.
+ *
+ * The entries are found through a per thread registry keyed on the
+ * identity of the varis of the matrix. As a `chainable_alloc` an entry
+ * is deleted by `recover_memory()` and `recover_memory_nested()`, and it
+ * removes itself from the registry then, so a key is never matched with
+ * a vari that reuses the memory of a recovered one. The registry itself
+ * is freed once its last entry is deleted.
+ *
+ * An entry for an Eigen matrix of vars keeps the varis of its elements
+ * on the arena. The values of a `var_value` matrix can be assigned in
+ * place, which keeps its vari, so an entry for it only matches until the
+ * next such assignment on the thread (see
+ * `var_value_assignment_count()`).
+ *
+ * @tparam Factor type of the factorization
+ */
+template <typename Factor>
+class cached_factorization : public chainable_alloc {
+ public:
+  using registry_t
+      = std::unordered_multimap<const void*, cached_factorization*>;
+
+  /**
+   * Return the registry of the factorizations of the current thread,
+   * creating it if needed.
+   */
+  static registry_t& registry() {
+    registry_t*& registry = registry_ptr();
+    if (registry == nullptr) {
+      registry = new registry_t();
+    }
+    return *registry;
+  }
+
+  /**
+   * Return the number of factorizations cached on the current thread.
+   */
+  static size_t size() {
+    const registry_t* registry = registry_ptr();
+    return registry == nullptr ? 0 : registry->size();
+  }
+
+  /**
+   * Cache the factorization of a `var_value` matrix.
+   *
+   * @tparam T type of the matrix
+   * @param m matrix
+   * @param factor factorization of the values of `m`
+   */
+  template <typename T, require_var_matrix_t<T>* = nullptr>
+  cached_factorization(const T& m, Factor&& factor)
+      : key_(m.vi_),
+        rows_(m.rows()),
+        cols_(m.cols()),
+        varis_(nullptr),
+        assignment_count_(var_value_assignment_count()),
+        factor_(std::move(factor)) {
+    registry().emplace(key_, this);
+  }
+
+  /**
+   * Cache the factorization of an Eigen matrix of vars.
+   *
+   * @tparam T type of the matrix
+   * @param m matrix
+   * @param factor factorization of the values of `m`
+   */
+  template <typename T, require_eigen_vt<is_var, T>* = nullptr>
+  cached_factorization(const T& m, Factor&& factor)
+      : key_(factorization_key(m)),
+        rows_(m.rows()),
+        cols_(m.cols()),
+        varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            m.size())),
+        assignment_count_(0),
+        factor_(std::move(factor)) {
+    Eigen::Map<Eigen::Matrix<vari*, Eigen::Dynamic, Eigen::Dynamic>>(
+        varis_, rows_, cols_)
+        = m.vi();
+    registry().emplace(key_, this);
+  }
+
+  ~cached_factorization() {
+    registry_t*& registry = registry_ptr();
+    auto range = registry->equal_range(key_);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == this) {
+        registry->erase(it);
+        break;
+      }
+    }
+    if (registry->empty()) {
+      delete registry;
+      registry = nullptr;
+    }
+  }
+
+  /**
+   * Return the key of a `var_value` matrix, which is its vari.
+   */
+  template <typename T, require_var_matrix_t<T>* = nullptr>
+  static const void* factorization_key(const T& m) {
+    return m.vi_;
+  }
+
+  /**
+   * Return the key of an Eigen matrix of vars, which is the vari of its
+   * first element. `matches()` tells apart matrices that share it.
+   */
+  template <typename T, require_eigen_vt<is_var, T>* = nullptr>
+  static const void* factorization_key(const T& m) {
+    return m.size() == 0 ? nullptr : m.coeff(0, 0).vi_;
+  }
+
+  /**
+   * Return true if the factorization belongs to the given `var_value`
+   * matrix, whose values were not assigned in place since.
+   */
+  template <typename T, require_var_matrix_t<T>* = nullptr>
+  bool matches(const T& m) const {
+    return varis_ == nullptr && m.rows() == rows_ && m.cols() == cols_
+           && assignment_count_ == var_value_assignment_count();
+  }
+
+  /**
+   * Return true if the factorization belongs to the Eigen matrix of vars
+   * with the same varis.
+   */
+  template <typename T, require_eigen_vt<is_var, T>* = nullptr>
+  bool matches(const T& m) const {
+    if (varis_ == nullptr || m.rows() != rows_ || m.cols() != cols_) {
+      return false;
+    }
+    Eigen::Index k = 0;
+    for (Eigen::Index j = 0; j < cols_; ++j) {
+      for (Eigen::Index i = 0; i < rows_; ++i, ++k) {
+        if (m.coeff(i, j).vi_ != varis_[k]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  const Factor& factor() const noexcept { return factor_; }
+
+ private:
+  static registry_t*& registry_ptr() {
+    static STAN_THREADS_DEF registry_t* registry_ = nullptr;
+    return registry_;
+  }
+
+  const void* key_;
+  Eigen::Index rows_;
+  Eigen::Index cols_;
+  // varis of the elements of an Eigen matrix of vars, on the arena
+  vari** varis_;
+  // in place assignments before a var_value matrix was factored
+  size_t assignment_count_;
+  Factor factor_;
+};
+
+/**
+ * Return the factorization of the values of a matrix of vars, computing
+ * it with `factor` only the first time it is asked for during a
+ * gradient evaluation. A model that uses one covariance matrix in
+ * several functions factors it once.
+ *
+ * @tparam Factor type of the factorization
+ * @tparam T type of the matrix
+ * @tparam F type of the functor
+ * @param m matrix of vars
+ * @param factor functor computing the factorization from the values of
+ * `m`
+ * @return reference to the factorization, valid until the memory of the
+ * autodiff stack is recovered
+ */
+template <typename Factor, typename T, typename F>
+inline const Factor& get_cached_factorization(const T& m, const F& factor) {
+  using cache_t = cached_factorization<Factor>;
+  if (cache_t::size() > 0) {
+    auto range = cache_t::registry().equal_range(cache_t::factorization_key(m));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second->matches(m)) {
+        return it->second->factor();
+      }
+    }
+  }
+  return (new cache_t(m, factor(m.val())))->factor();
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -83,7 +83,8 @@ inline var fma(const var& x, const var& y, Tc&& z) {
  */
 template <typename Ta, typename Tb, typename Tc,
           require_arithmetic_t<Tb>* = nullptr,
-          require_all_var_t<Ta, Tc>* = nullptr>
+          require_all_var_t<Ta, Tc>* = nullptr,
+          require_all_stan_scalar_t<Ta, Tc>* = nullptr>
 inline var fma(Ta&& x, Tb&& y, Tc&& z) {
   return make_callback_var(fma(x.val(), y, z.val()), [x, y, z](auto& vi) {
     x.adj() += vi.adj() * y;
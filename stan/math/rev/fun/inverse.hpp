@@ -6,7 +6,9 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/rev/fun/matrix_batch.hpp>
 #include <stan/math/prim/err.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -39,6 +41,63 @@ inline auto inverse(const T& m) {
   return ret_type(res);
 }
 
+/**
+ * Return the inverses of a batch of square matrices of equal size.
+ *
+ * The batch is stored as one matrix on the arena, the inverses are
+ * computed with fixed-size kernels for matrices of size 2 to 8, and a
+ * single reverse pass callback propagates the adjoints of the whole
+ * batch.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices of vars
+ * @param m batch of square matrices
+ * @return inverses of the matrices
+ * @throw std::invalid_argument if a matrix is not square or the sizes of
+ * the matrices differ
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_std_vector_st<is_var, T>* = nullptr>
+inline auto inverse(const T& m) {
+  using ret_type = plain_type_t<value_type_t<T>>;
+  if (m.empty()) {
+    return std::vector<ret_type>();
+  }
+  const Eigen::Index n = internal::check_square_batch("inverse", "m", m);
+  if (n == 0) {
+    return std::vector<ret_type>(m.size());
+  }
+  arena_t<Eigen::Matrix<var, -1, -1>> arena_m = internal::to_arena_batch(m);
+  const Eigen::MatrixXd m_val = arena_m.val();
+  arena_t<Eigen::MatrixXd> res_val(n * n, m.size());
+  internal::fixed_size_dispatch(n, [&](auto N_) {
+    constexpr int N = decltype(N_)::value;
+    using mat_t = Eigen::Matrix<double, N, N>;
+    for (size_t k = 0; k < m.size(); ++k) {
+      Eigen::Map<mat_t>(res_val.col(k).data(), n, n)
+          = Eigen::Map<const mat_t>(m_val.col(k).data(), n, n).inverse();
+    }
+  });
+  arena_t<Eigen::Matrix<var, -1, -1>> res = res_val;
+
+  reverse_pass_callback([arena_m, res_val, res, n]() mutable {
+    const Eigen::MatrixXd res_adj = res.adj();
+    internal::fixed_size_dispatch(n, [&](auto N_) {
+      constexpr int N = decltype(N_)::value;
+      using mat_t = Eigen::Matrix<double, N, N>;
+      for (Eigen::Index k = 0; k < res.cols(); ++k) {
+        Eigen::Map<const mat_t> inv_k(res_val.col(k).data(), n, n);
+        const mat_t m_adj
+            = inv_k.transpose()
+              * Eigen::Map<const mat_t>(res_adj.col(k).data(), n, n)
+              * inv_k.transpose();
+        arena_m.col(k).adj()
+            -= Eigen::Map<const Eigen::VectorXd>(m_adj.data(), n * n);
+      }
+    });
+  });
+  return internal::from_arena_batch<ret_type>(res, n, n);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -3,9 +3,11 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/matrix_batch.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -29,6 +31,56 @@ inline var log_determinant(const T& m) {
   return log_det;
 }
 
+/**
+ * Return the log absolute determinants of a batch of square matrices of
+ * equal size.
+ *
+ * The batch is stored as one matrix on the arena, the determinants are
+ * computed with fixed-size kernels for matrices of size 2 to 8, and a
+ * single reverse pass callback propagates the adjoints of the whole
+ * batch.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices of vars
+ * @param m batch of square matrices
+ * @return log absolute determinants of the matrices
+ * @throw std::invalid_argument if a matrix is not square or the sizes of
+ * the matrices differ
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_std_vector_st<is_var, T>* = nullptr>
+inline std::vector<var> log_determinant(const T& m) {
+  if (m.empty()) {
+    return {};
+  }
+  const Eigen::Index n
+      = internal::check_square_batch("log_determinant", "m", m);
+  if (n == 0) {
+    return std::vector<var>(m.size(), var(0.0));
+  }
+  arena_t<Eigen::Matrix<var, -1, -1>> arena_m = internal::to_arena_batch(m);
+  const Eigen::MatrixXd m_val = arena_m.val();
+  arena_t<Eigen::MatrixXd> m_inv_transpose(n * n, m.size());
+  Eigen::VectorXd log_det_val(m.size());
+  internal::fixed_size_dispatch(n, [&](auto N_) {
+    constexpr int N = decltype(N_)::value;
+    using mat_t = Eigen::Matrix<double, N, N>;
+    for (size_t k = 0; k < m.size(); ++k) {
+      const auto m_hh
+          = Eigen::Map<const mat_t>(m_val.col(k).data(), n, n)
+                .colPivHouseholderQr();
+      log_det_val.coeffRef(k) = m_hh.logAbsDeterminant();
+      Eigen::Map<mat_t>(m_inv_transpose.col(k).data(), n, n)
+          = m_hh.inverse().transpose();
+    }
+  });
+  arena_t<Eigen::Matrix<var, -1, 1>> log_det = log_det_val;
+
+  reverse_pass_callback([arena_m, m_inv_transpose, log_det]() mutable {
+    arena_m.adj() += m_inv_transpose * log_det.adj().asDiagonal();
+  });
+  return std::vector<var>(log_det.data(), log_det.data() + log_det.size());
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
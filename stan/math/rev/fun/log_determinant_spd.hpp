@@ -7,6 +7,7 @@
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/sparse_llt.hpp>
 #include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 
@@ -103,6 +104,36 @@ inline var log_determinant_spd(const T& m) {
                            });
 }
 
+/**
+ * Returns the log det of a symmetric, positive-definite sparse matrix
+ *
+ * The matrix is factored with a sparse Cholesky decomposition. Its
+ * adjoint, the inverse of the matrix, is only formed inside the
+ * sparsity pattern of the matrix with the Takahashi selected inverse,
+ * so the dense inverse is never needed.
+ *
+ * @tparam T Type of the sparse matrix
+ * @param m a symmetric, positive-definite sparse matrix
+ * @return The log determinant of the specified matrix
+ */
+template <typename T, require_eigen_sparse_base_t<T>* = nullptr>
+inline var log_determinant_spd(const var_value<T>& m) {
+  check_symmetric("log_determinant_spd", "m", m.val());
+  if (m.rows() == 0) {
+    return var(0.0);
+  }
+
+  internal::sparse_llt_factor llt
+      = internal::sparse_llt("log_determinant_spd", "m", m.val());
+  arena_t<Eigen::VectorXd> arena_m_inv
+      = internal::sparse_selected_inverse(llt, m.val());
+  const double val = 2.0 * sum(log(llt.L.diagonal().array()));
+
+  return make_callback_var(val, [m, arena_m_inv](const auto& res) mutable {
+    m.adj().coeffs() += res.adj() * arena_m_inv.array();
+  });
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,69 @@
+#ifndef STAN_MATH_REV_FUN_MATRIX_BATCH_HPP
+#define STAN_MATH_REV_FUN_MATRIX_BATCH_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_batch.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Copy a batch of matrices to a single matrix on the arena whose
+ * columns are the column-major elements of the matrices.
+ *
+ * @tparam T type of the matrices
+ * @param batch non-empty batch of matrices of equal size, which the
+ * caller has checked
+ * @return matrix with one column per matrix of the batch
+ */
+template <typename T>
+inline arena_t<Eigen::Matrix<scalar_type_t<T>, Eigen::Dynamic, Eigen::Dynamic>>
+to_arena_batch(const std::vector<T>& batch) {
+  const Eigen::Index rows = batch[0].rows();
+  const Eigen::Index cols = batch[0].cols();
+  arena_t<Eigen::Matrix<scalar_type_t<T>, Eigen::Dynamic, Eigen::Dynamic>>
+      packed(rows * cols, batch.size());
+  for (size_t k = 0; k < batch.size(); ++k) {
+    for (Eigen::Index j = 0; j < cols; ++j) {
+      for (Eigen::Index i = 0; i < rows; ++i) {
+        packed.coeffRef(i + j * rows, k) = batch[k].coeff(i, j);
+      }
+    }
+  }
+  return packed;
+}
+
+/**
+ * Return the batch of matrices stored in the columns of a matrix of
+ * vars, sharing the varis of the packed matrix.
+ *
+ * @tparam Ret type of the returned matrices
+ * @tparam EigMat type of the packed matrix
+ * @param packed matrix with one column per matrix
+ * @param rows number of rows of the matrices
+ * @param cols number of columns of the matrices
+ * @return batch of matrices
+ */
+template <typename Ret, typename EigMat>
+inline std::vector<Ret> from_arena_batch(const EigMat& packed,
+                                         Eigen::Index rows,
+                                         Eigen::Index cols) {
+  std::vector<Ret> batch;
+  batch.reserve(packed.cols());
+  for (Eigen::Index k = 0; k < packed.cols(); ++k) {
+    batch.emplace_back(
+        Eigen::Map<const Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>>(
+            packed.col(k).data(), rows, cols));
+  }
+  return batch;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
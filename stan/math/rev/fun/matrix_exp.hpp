@@ -0,0 +1,85 @@
+#ifndef STAN_MATH_REV_FUN_MATRIX_EXP_HPP
+#define STAN_MATH_REV_FUN_MATRIX_EXP_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/matrix_batch.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/matrix_exp_pade.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the matrix exponentials of a batch of square matrices of
+ * equal size.
+ *
+ * The batch is stored as one matrix on the arena, the exponentials are
+ * computed with fixed-size kernels for matrices of size 2 to 8, and a
+ * single reverse pass callback propagates the adjoints of the whole
+ * batch. The adjoint of each matrix \f$A\f$ is the upper right block of
+ * the exponential of
+ * \f$\left[\begin{smallmatrix} A^T & \bar{Y} \\ 0 & A^T \end{smallmatrix}
+ * \right]\f$, where \f$\bar{Y}\f$ is the adjoint of its exponential.
+ *
+ * @tparam T type of the batch, a `std::vector` of matrices of vars
+ * @param A batch of square matrices
+ * @return matrix exponentials of the matrices
+ * @throw std::invalid_argument if a matrix is not square or the sizes of
+ * the matrices differ
+ */
+template <typename T, require_std_vector_vt<is_eigen, T>* = nullptr,
+          require_std_vector_st<is_var, T>* = nullptr>
+inline auto matrix_exp(const T& A) {
+  using ret_type = plain_type_t<value_type_t<T>>;
+  if (A.empty()) {
+    return std::vector<ret_type>();
+  }
+  const Eigen::Index n = internal::check_square_batch("matrix_exp", "A", A);
+  if (n == 0) {
+    return std::vector<ret_type>(A.size());
+  }
+  arena_t<Eigen::Matrix<var, -1, -1>> arena_A = internal::to_arena_batch(A);
+  arena_t<Eigen::MatrixXd> A_val = arena_A.val();
+  arena_t<Eigen::MatrixXd> res_val(n * n, A.size());
+  internal::fixed_size_dispatch(n, [&](auto N_) {
+    constexpr int N = decltype(N_)::value;
+    using mat_t = Eigen::Matrix<double, N, N>;
+    for (size_t k = 0; k < A.size(); ++k) {
+      const mat_t A_k = Eigen::Map<const mat_t>(A_val.col(k).data(), n, n);
+      Eigen::Map<mat_t>(res_val.col(k).data(), n, n) = matrix_exp(A_k);
+    }
+  });
+  arena_t<Eigen::Matrix<var, -1, -1>> res = res_val;
+
+  reverse_pass_callback([arena_A, A_val, res, n]() mutable {
+    const Eigen::MatrixXd res_adj = res.adj();
+    internal::fixed_size_dispatch(n, [&](auto N_) {
+      constexpr int N = decltype(N_)::value;
+      constexpr int N2 = N == Eigen::Dynamic ? Eigen::Dynamic : 2 * N;
+      using mat_t = Eigen::Matrix<double, N, N>;
+      Eigen::Matrix<double, N2, N2> augmented(2 * n, 2 * n);
+      augmented.bottomLeftCorner(n, n).setZero();
+      for (Eigen::Index k = 0; k < res.cols(); ++k) {
+        Eigen::Map<const mat_t> A_k(A_val.col(k).data(), n, n);
+        augmented.topLeftCorner(n, n) = A_k.transpose();
+        augmented.topRightCorner(n, n)
+            = Eigen::Map<const mat_t>(res_adj.col(k).data(), n, n);
+        augmented.bottomRightCorner(n, n) = A_k.transpose();
+        const mat_t A_adj
+            = matrix_exp_pade(augmented).topRightCorner(n, n);
+        arena_A.col(k).adj()
+            += Eigen::Map<const Eigen::VectorXd>(A_adj.data(), n * n);
+      }
+    });
+  });
+  return internal::from_arena_batch<ret_type>(res, n, n);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -3,35 +3,137 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
-#include <stan/math/rev/fun/multiply.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
-#include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/matrix_exp_action_handler.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 
 namespace stan {
 namespace math {
 
+namespace internal {
 /**
- * Wrapper of matrix_exp_action function for a more literal name
+ * Return the adjoint of \f$M\f$ in \f$Y = \exp(M) B\f$ given the
+ * adjoint of \f$Y\f$.
  *
+ * The adjoint is the Frechet derivative of the matrix exponential at
+ * \f$M^T\f$ in the direction \f$E = \bar{Y} B^T\f$, which is the upper
+ * right block of the exponential of the block triangular matrix
+ * \f$\left[\begin{smallmatrix} M^T & E \\ 0 & M^T \end{smallmatrix}
+ * \right]\f$. Only the action of that exponential on the last block
+ * column is computed. The derivative is linear in \f$E\f$, so
+ * \f$E\f$ is normalized to keep it from increasing the number of
+ * scaling steps.
+ *
+ * @tparam EigMat1 type of the matrix M
+ * @tparam EigMat2 type of the matrix B
+ * @tparam EigMat3 type of the adjoint of Y
+ * @param M square matrix
+ * @param B matrix multiplied by the exponential
+ * @param Y_adj adjoint of the product
+ * @return adjoint of M
+ */
+template <typename EigMat1, typename EigMat2, typename EigMat3>
+inline Eigen::MatrixXd matrix_exp_multiply_adjoint(const EigMat1& M,
+                                                   const EigMat2& B,
+                                                   const EigMat3& Y_adj) {
+  const Eigen::Index n = M.rows();
+  Eigen::MatrixXd E = Y_adj * B.transpose();
+  const double E_norm = E.cwiseAbs().colwise().sum().maxCoeff();
+  if (E_norm == 0.0) {
+    return Eigen::MatrixXd::Zero(n, n);
+  }
+  Eigen::MatrixXd augmented(2 * n, 2 * n);
+  augmented.topLeftCorner(n, n) = M.transpose();
+  augmented.topRightCorner(n, n) = E / E_norm;
+  augmented.bottomLeftCorner(n, n).setZero();
+  augmented.bottomRightCorner(n, n) = M.transpose();
+  Eigen::MatrixXd last_block_column = Eigen::MatrixXd::Zero(2 * n, n);
+  last_block_column.bottomRows(n).setIdentity();
+  return E_norm
+         * matrix_exp_action_handler()
+               .action(augmented, last_block_column)
+               .topRows(n);
+}
+
+/**
+ * Return product of exp(At) and B, where A is a NxN matrix, B is a
+ * NxCb matrix and t is a scalar, and at least one of them holds
+ * reverse mode autodiff variables.
+ *
+ * The product and the adjoint of B are computed with the action of the
+ * matrix exponential, so neither exp(At) nor its adjoint is formed. The
+ * adjoint of A needs a full NxN matrix and is computed with
+ * `matrix_exp_multiply_adjoint()`.
+ *
+ * @tparam Tt type of the scalar t
  * @tparam Ta type of the matrix A
  * @tparam Tb type of the matrix B
+ * @param function name of the calling function (for error messages)
+ * @param t scalar
+ * @param A Matrix
+ * @param B Matrix
+ * @return exponential of At multiplied by B
+ */
+template <typename Tt, typename Ta, typename Tb>
+inline auto matrix_exp_multiply_rev(const char* function, const Tt& t,
+                                    const Ta& A, const Tb& B) {
+  using ret_val_type = plain_type_t<decltype(value_of(B))>;
+  using ret_type = return_var_matrix_t<ret_val_type, Ta, Tb>;
+  check_square(function, "input matrix", A);
+  check_multiplicable(function, "A", A, "B", B);
+  if (A.size() == 0) {
+    return ret_type(ret_val_type(0, B.cols()));
+  }
+
+  arena_t<Ta> arena_A = A;
+  arena_t<Tb> arena_B = B;
+  arena_t<ret_type> res = matrix_exp_action_handler().action(
+      value_of(arena_A), value_of(arena_B), value_of(t));
+
+  reverse_pass_callback([t, arena_A, arena_B, res]() mutable {
+    using Ta_var = arena_t<plain_type_t<promote_scalar_t<var, Ta>>>;
+    using Tb_var = arena_t<plain_type_t<promote_scalar_t<var, Tb>>>;
+    const double t_val = value_of(t);
+    const auto& A_val = to_ref(value_of(arena_A));
+    const Eigen::MatrixXd res_adj = res.adj();
+    if (!is_constant<Tt>::value) {
+      forward_as<var>(t).adj()
+          += (res_adj.array() * (A_val * res.val_op()).array()).sum();
+    }
+    if (!is_constant<Ta>::value) {
+      forward_as<Ta_var>(arena_A).adj()
+          += t_val
+             * matrix_exp_multiply_adjoint(t_val * A_val, value_of(arena_B),
+                                           res_adj);
+    }
+    if (!is_constant<Tb>::value) {
+      forward_as<Tb_var>(arena_B).adj()
+          += matrix_exp_action_handler().action(A_val.transpose(), res_adj,
+                                                t_val);
+    }
+  });
+  return ret_type(res);
+}
+}  // namespace internal
+
+/**
+ * Return product of exp(A) and B, where A is a NxN matrix and B is a
+ * NxCb matrix, and at least one of them holds reverse mode autodiff
+ * variables. See `internal::matrix_exp_multiply_rev()`.
  *
+ * @tparam Ta type of the matrix A
+ * @tparam Tb type of the matrix B
  * @param[in] A Matrix
  * @param[in] B Matrix
  * @return exponential of A multiplies B
  */
-template <typename Ta, typename Tb, require_all_eigen_t<Ta, Tb>* = nullptr,
-          require_any_st_autodiff<Ta, Tb>* = nullptr>
-inline Eigen::Matrix<return_type_t<Ta, Tb>, -1, Tb::ColsAtCompileTime>
-matrix_exp_multiply(const Ta& A, const Tb& B) {
-  check_square("matrix_exp_multiply", "input matrix", A);
-  check_multiplicable("matrix_exp_multiply", "A", A, "B", B);
-  if (A.size() == 0) {
-    return {0, B.cols()};
-  }
-
-  return multiply(matrix_exp(A), B);
+template <typename Ta, typename Tb, require_all_matrix_t<Ta, Tb>* = nullptr,
+          require_any_st_var<Ta, Tb>* = nullptr>
+inline auto matrix_exp_multiply(const Ta& A, const Tb& B) {
+  return internal::matrix_exp_multiply_rev("matrix_exp_multiply", 1.0, A, B);
 }
 
 }  // namespace math
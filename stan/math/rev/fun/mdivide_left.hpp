@@ -5,6 +5,7 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/core/typedefs.hpp>
 #include <stan/math/rev/core/chainable_object.hpp>
+#include <stan/math/rev/fun/matrix_batch.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
@@ -86,6 +87,98 @@ inline auto mdivide_left(const T1& A, const T2& B) {
   }
 }
 
+/**
+ * Return the solutions of the linear systems \f$A_k X_k = B_k\f$ for
+ * batches of square matrices \f$A_k\f$ of equal size and right-hand
+ * sides \f$B_k\f$ of equal size.
+ *
+ * The batches are stored as matrices on the arena, the systems are
+ * solved with fixed-size kernels for matrices of size 2 to 8, and a
+ * single reverse pass callback propagates the adjoints of both batches.
+ * The reverse pass factors the matrices again instead of keeping their
+ * factorizations on the arena.
+ *
+ * @tparam T1 type of the batch of matrices
+ * @tparam T2 type of the batch of right-hand sides
+ * @param A batch of square matrices
+ * @param B batch of right-hand sides
+ * @return solutions of the systems
+ * @throw std::invalid_argument if the batches differ in length, a matrix
+ * is not square, or the sizes of the matrices or right-hand sides differ
+ */
+template <typename T1, typename T2,
+          require_all_std_vector_vt<is_eigen, T1, T2>* = nullptr,
+          require_any_st_var<T1, T2>* = nullptr>
+inline auto mdivide_left(const T1& A, const T2& B) {
+  using ret_type
+      = Eigen::Matrix<var, value_type_t<T1>::RowsAtCompileTime,
+                      value_type_t<T2>::ColsAtCompileTime>;
+  check_matching_sizes("mdivide_left", "A", A, "B", B);
+  if (A.empty()) {
+    return std::vector<ret_type>();
+  }
+  const Eigen::Index n = internal::check_square_batch("mdivide_left", "A", A);
+  const Eigen::Index cols = B[0].cols();
+  for (const auto& B_k : B) {
+    check_multiplicable("mdivide_left", "A", A[0], "B", B_k);
+    check_size_match("mdivide_left", "Columns of first right-hand side", cols,
+                     "columns of right-hand side", B_k.cols());
+  }
+  if (n == 0 || cols == 0) {
+    return std::vector<ret_type>(A.size(), ret_type(n, cols));
+  }
+  auto arena_A = internal::to_arena_batch(A);
+  auto arena_B = internal::to_arena_batch(B);
+  arena_t<Eigen::MatrixXd> A_val = value_of(arena_A);
+  const Eigen::MatrixXd B_val = value_of(arena_B);
+  arena_t<Eigen::MatrixXd> res_val(n * cols, A.size());
+  internal::fixed_size_dispatch(n, [&](auto N_) {
+    constexpr int N = decltype(N_)::value;
+    using mat_t = Eigen::Matrix<double, N, N>;
+    using rhs_t = Eigen::Matrix<double, N, Eigen::Dynamic>;
+    for (size_t k = 0; k < A.size(); ++k) {
+      Eigen::Map<rhs_t>(res_val.col(k).data(), n, cols)
+          = Eigen::Map<const mat_t>(A_val.col(k).data(), n, n)
+                .partialPivLu()
+                .solve(Eigen::Map<const rhs_t>(B_val.col(k).data(), n, cols));
+    }
+  });
+  arena_t<Eigen::Matrix<var, -1, -1>> res = res_val;
+
+  reverse_pass_callback([arena_A, arena_B, A_val, res_val, res, n,
+                         cols]() mutable {
+    using T1_var = arena_t<Eigen::Matrix<var, -1, -1>>;
+    using T2_var = arena_t<Eigen::Matrix<var, -1, -1>>;
+    const Eigen::MatrixXd res_adj = res.adj();
+    internal::fixed_size_dispatch(n, [&](auto N_) {
+      constexpr int N = decltype(N_)::value;
+      using mat_t = Eigen::Matrix<double, N, N>;
+      using rhs_t = Eigen::Matrix<double, N, Eigen::Dynamic>;
+      for (Eigen::Index k = 0; k < res.cols(); ++k) {
+        const rhs_t B_adj
+            = Eigen::Map<const mat_t>(A_val.col(k).data(), n, n)
+                  .partialPivLu()
+                  .transpose()
+                  .solve(Eigen::Map<const rhs_t>(res_adj.col(k).data(), n,
+                                                 cols));
+        if (!is_constant<T1>::value) {
+          const mat_t A_adj
+              = B_adj
+                * Eigen::Map<const rhs_t>(res_val.col(k).data(), n, cols)
+                      .transpose();
+          forward_as<T1_var>(arena_A).col(k).adj()
+              -= Eigen::Map<const Eigen::VectorXd>(A_adj.data(), n * n);
+        }
+        if (!is_constant<T2>::value) {
+          forward_as<T2_var>(arena_B).col(k).adj()
+              += Eigen::Map<const Eigen::VectorXd>(B_adj.data(), n * cols);
+        }
+      }
+    });
+  });
+  return internal::from_arena_batch<ret_type>(res, n, cols);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -4,8 +4,10 @@
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/core/typedefs.hpp>
+#include <stan/math/rev/fun/multiply.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/sparse_llt.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <vector>
@@ -306,7 +308,7 @@ inline auto mdivide_left_spd(const T1 &A, const T2 &B) {
     check_pos_definite("mdivide_left_spd", "A", A_llt);
 
     arena_t<Eigen::MatrixXd> arena_A_llt = A_llt.matrixL();
-    arena_t<ret_type> res = A_llt.solve(value_of(B));
+    arena_t<ret_type> res = ret_val_type(A_llt.solve(value_of(B)));
 
     reverse_pass_callback([arena_A, arena_A_llt, res]() mutable {
       promote_scalar_t<double, T2> adjB = res.adj();
@@ -349,6 +351,110 @@ inline auto mdivide_left_spd(const T1 &A, const T2 &B) {
   }
 }
 
+/**
+ * Returns the solution of the system Ax=B where A is a symmetric
+ * positive-definite sparse matrix.
+ *
+ * A is factored once with a sparse Cholesky decomposition. Its factor
+ * and fill-reducing permutation are kept on the arena for the reverse
+ * pass, which solves with them again and only forms the adjoint of A
+ * inside its sparsity pattern.
+ *
+ * @tparam T1 type of the sparse matrix
+ * @tparam T2 type of the right-hand side matrix or vector
+ *
+ * @param A Sparse matrix.
+ * @param B Right hand side matrix or vector.
+ * @return x = A^-1 B, solution of the linear system.
+ * @throws std::domain_error if A is not square, symmetric and positive
+ * definite or B does not have as many rows as A has columns.
+ */
+template <typename T1, typename T2, require_eigen_sparse_base_t<T1>* = nullptr,
+          require_matrix_t<T2>* = nullptr,
+          require_not_sparse_matrix_t<T2>* = nullptr>
+inline auto mdivide_left_spd(const var_value<T1>& A, const T2& B) {
+  using ret_val_type
+      = Eigen::Matrix<double, Eigen::Dynamic, T2::ColsAtCompileTime>;
+  using ret_type = return_var_matrix_t<ret_val_type, var_value<T1>, T2>;
+  static const char* function = "mdivide_left_spd";
+  check_multiplicable(function, "A", A, "B", B);
+  check_symmetric(function, "A", A.val());
+  if (A.rows() == 0) {
+    return ret_type(ret_val_type(0, B.cols()));
+  }
+
+  internal::sparse_llt_factor A_llt
+      = internal::sparse_llt(function, "A", A.val());
+  arena_t<Eigen::SparseMatrix<double>> arena_L = A_llt.L;
+  arena_t<Eigen::VectorXi> arena_perm = A_llt.perm;
+
+  if (!is_constant<T2>::value) {
+    arena_t<promote_scalar_t<var, T2>> arena_B = B;
+    arena_t<ret_type> res = ret_val_type(A_llt.solve(arena_B.val_op()));
+    reverse_pass_callback(
+        [A, arena_B, arena_L, arena_perm, res]() mutable {
+          ret_val_type adjB = res.adj();
+          internal::sparse_llt_solve_in_place(arena_L, arena_perm, adjB);
+          internal::sparse_outer_adjoint(A.adj(), -adjB, res.val());
+          arena_B.adj() += adjB;
+        });
+    return ret_type(res);
+  } else {
+    arena_t<ret_type> res = ret_val_type(A_llt.solve(value_of(B)));
+    reverse_pass_callback([A, arena_L, arena_perm, res]() mutable {
+      ret_val_type adjB = res.adj();
+      internal::sparse_llt_solve_in_place(arena_L, arena_perm, adjB);
+      internal::sparse_outer_adjoint(A.adj(), -adjB, res.val());
+    });
+    return ret_type(res);
+  }
+}
+
+/**
+ * Returns the solution of the system Ax=B where A is a symmetric
+ * positive-definite sparse matrix of doubles and B holds autodiff
+ * variables.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam T2 type of the right-hand side matrix or vector
+ *
+ * @param A Sparse matrix.
+ * @param B Right hand side matrix or vector.
+ * @return x = A^-1 B, solution of the linear system.
+ * @throws std::domain_error if A is not square, symmetric and positive
+ * definite or B does not have as many rows as A has columns.
+ */
+template <int Options, typename StorageIndex, typename T2,
+          require_matrix_t<T2>* = nullptr,
+          require_not_sparse_matrix_t<T2>* = nullptr,
+          require_st_var<T2>* = nullptr>
+inline auto mdivide_left_spd(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+    const T2& B) {
+  using ret_val_type
+      = Eigen::Matrix<double, Eigen::Dynamic, T2::ColsAtCompileTime>;
+  using ret_type = return_var_matrix_t<ret_val_type, T2>;
+  static const char* function = "mdivide_left_spd";
+  check_multiplicable(function, "A", A, "B", B);
+  check_symmetric(function, "A", A);
+  if (A.rows() == 0) {
+    return ret_type(ret_val_type(0, B.cols()));
+  }
+
+  internal::sparse_llt_factor A_llt = internal::sparse_llt(function, "A", A);
+  arena_t<Eigen::SparseMatrix<double>> arena_L = A_llt.L;
+  arena_t<Eigen::VectorXi> arena_perm = A_llt.perm;
+  arena_t<promote_scalar_t<var, T2>> arena_B = B;
+  arena_t<ret_type> res = ret_val_type(A_llt.solve(arena_B.val_op()));
+  reverse_pass_callback([arena_B, arena_L, arena_perm, res]() mutable {
+    ret_val_type adjB = res.adj();
+    internal::sparse_llt_solve_in_place(arena_L, arena_perm, adjB);
+    arena_B.adj() += adjB;
+  });
+  return ret_type(res);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -194,6 +194,100 @@ inline auto multiply(const T1& A, const T2& B) {
   return multiply(B, A);
 }
 
+namespace internal {
+/**
+ * Add \f$ L R^T \f$ to the adjoint of a sparse matrix, only forming
+ * the entries inside its sparsity pattern.
+ *
+ * @tparam SpMat type of the sparse adjoint
+ * @tparam MatL type of the left factor
+ * @tparam MatR type of the right factor
+ * @param[in, out] A_adj sparse adjoint to update
+ * @param L left factor with as many rows as `A_adj`
+ * @param R right factor with as many rows as `A_adj` has columns
+ */
+template <typename SpMat, typename MatL, typename MatR>
+inline void sparse_outer_adjoint(SpMat& A_adj, const MatL& L, const MatR& R) {
+  for (Eigen::Index k = 0; k < A_adj.outerSize(); ++k) {
+    for (typename SpMat::InnerIterator it(A_adj, k); it; ++it) {
+      it.valueRef() += L.row(it.row()).dot(R.row(it.col()));
+    }
+  }
+}
+}  // namespace internal
+
+/**
+ * Return the product of a sparse matrix and a dense matrix or vector,
+ * where the sparse matrix is a `var_value`.
+ *
+ * The adjoint of the sparse matrix is only formed inside its sparsity
+ * pattern, so the reverse pass costs one dot product per non-zero
+ * instead of a dense outer product.
+ *
+ * @tparam T type of the sparse matrix value
+ * @tparam T2 type of the dense matrix or vector
+ *
+ * @param[in] A sparse matrix
+ * @param[in] B dense matrix or vector
+ * @return A * B
+ */
+template <typename T, typename T2, require_eigen_sparse_base_t<T>* = nullptr,
+          require_matrix_t<T2>* = nullptr,
+          require_not_sparse_matrix_t<T2>* = nullptr>
+inline auto multiply(const var_value<T>& A, const T2& B) {
+  check_multiplicable("multiply", "A", A, "B", B);
+  arena_t<promote_scalar_t<double, T2>> arena_B_val = value_of(B);
+  using return_t
+      = return_var_matrix_t<decltype(A.val() * arena_B_val), var_value<T>, T2>;
+  arena_t<return_t> res = A.val() * arena_B_val;
+  if (!is_constant<T2>::value) {
+    arena_t<promote_scalar_t<var, T2>> arena_B = B;
+    reverse_pass_callback([A, arena_B, arena_B_val, res]() mutable {
+      const auto& res_adj = to_ref(res.adj());
+      internal::sparse_outer_adjoint(A.adj(), res_adj, arena_B_val);
+      arena_B.adj() += A.val().transpose() * res_adj;
+    });
+  } else {
+    reverse_pass_callback([A, arena_B_val, res]() mutable {
+      internal::sparse_outer_adjoint(A.adj(), to_ref(res.adj()), arena_B_val);
+    });
+  }
+  return return_t(res);
+}
+
+/**
+ * Return the product of a sparse matrix of doubles and a dense matrix or
+ * vector of autodiff variables.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam T2 type of the dense matrix or vector
+ *
+ * @param[in] A sparse matrix
+ * @param[in] B dense matrix or vector
+ * @return A * B
+ */
+template <int Options, typename StorageIndex, typename T2,
+          require_matrix_t<T2>* = nullptr,
+          require_not_sparse_matrix_t<T2>* = nullptr,
+          require_st_var<T2>* = nullptr>
+inline auto multiply(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+    const T2& B) {
+  using sparse_t = Eigen::SparseMatrix<double, Options, StorageIndex>;
+  check_multiplicable("multiply", "A", A, "B", B);
+  arena_t<sparse_t> arena_A = A;
+  arena_t<promote_scalar_t<var, T2>> arena_B = B;
+  using return_t
+      = return_var_matrix_t<decltype(arena_A * value_of(B).eval()), sparse_t,
+                            T2>;
+  arena_t<return_t> res = arena_A * arena_B.val_op();
+  reverse_pass_callback([arena_A, arena_B, res]() mutable {
+    arena_B.adj() += arena_A.transpose() * res.adj_op();
+  });
+  return return_t(res);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -3,10 +3,13 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/multiply.hpp>
+#include <stan/math/rev/fun/quad_form_tiled.hpp>
 #include <stan/math/rev/fun/to_var_value.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/quad_form.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <type_traits>
@@ -15,106 +18,36 @@ namespace stan {
 namespace math {
 
 namespace internal {
-template <typename Ta, int Ra, int Ca, typename Tb, int Rb, int Cb>
-class quad_form_vari_alloc : public chainable_alloc {
- private:
-  inline void compute(const Eigen::Matrix<double, Ra, Ca>& A,
-                      const Eigen::Matrix<double, Rb, Cb>& B) {
-    matrix_d Cd = B.transpose() * A * B;
-    if (sym_) {
-      matrix_d M = 0.5 * (Cd + Cd.transpose());
-      Cd = M;
-    }
-    for (int j = 0; j < C_.cols(); j++) {
-      for (int i = 0; i < C_.rows(); i++) {
-        C_(i, j) = var(new vari(Cd(i, j), false));
-      }
-    }
-  }
-
- public:
-  quad_form_vari_alloc(const Eigen::Matrix<Ta, Ra, Ca>& A,
-                       const Eigen::Matrix<Tb, Rb, Cb>& B,
-                       bool symmetric = false)
-      : A_(A), B_(B), C_(B_.cols(), B_.cols()), sym_(symmetric) {
-    compute(value_of(A), value_of(B));
-  }
-
-  Eigen::Matrix<Ta, Ra, Ca> A_;
-  Eigen::Matrix<Tb, Rb, Cb> B_;
-  Eigen::Matrix<var, Cb, Cb> C_;
-  bool sym_;
-};
-
-template <typename Ta, int Ra, int Ca, typename Tb, int Rb, int Cb>
-class quad_form_vari : public vari {
- protected:
-  inline void chainA(Eigen::Matrix<double, Ra, Ca>& A,
-                     const Eigen::Matrix<double, Rb, Cb>& Bd,
-                     const Eigen::Matrix<double, Cb, Cb>& adjC) {}
-  inline void chainB(Eigen::Matrix<double, Rb, Cb>& B,
-                     const Eigen::Matrix<double, Ra, Ca>& Ad,
-                     const Eigen::Matrix<double, Rb, Cb>& Bd,
-                     const Eigen::Matrix<double, Cb, Cb>& adjC) {}
-
-  inline void chainA(Eigen::Matrix<var, Ra, Ca>& A,
-                     const Eigen::Matrix<double, Rb, Cb>& Bd,
-                     const Eigen::Matrix<double, Cb, Cb>& adjC) {
-    A.adj() += Bd * adjC * Bd.transpose();
-  }
-  inline void chainB(Eigen::Matrix<var, Rb, Cb>& B,
-                     const Eigen::Matrix<double, Ra, Ca>& Ad,
-                     const Eigen::Matrix<double, Rb, Cb>& Bd,
-                     const Eigen::Matrix<double, Cb, Cb>& adjC) {
-    B.adj() += Ad * Bd * adjC.transpose() + Ad.transpose() * Bd * adjC;
-  }
-
-  inline void chainAB(Eigen::Matrix<Ta, Ra, Ca>& A,
-                      Eigen::Matrix<Tb, Rb, Cb>& B,
-                      const Eigen::Matrix<double, Ra, Ca>& Ad,
-                      const Eigen::Matrix<double, Rb, Cb>& Bd,
-                      const Eigen::Matrix<double, Cb, Cb>& adjC) {
-    chainA(A, Bd, adjC);
-    chainB(B, Ad, Bd, adjC);
-  }
-
- public:
-  quad_form_vari(const Eigen::Matrix<Ta, Ra, Ca>& A,
-                 const Eigen::Matrix<Tb, Rb, Cb>& B, bool symmetric = false)
-      : vari(0.0) {
-    impl_ = new quad_form_vari_alloc<Ta, Ra, Ca, Tb, Rb, Cb>(A, B, symmetric);
-  }
-
-  virtual void chain() {
-    matrix_d adjC = impl_->C_.adj();
-
-    chainAB(impl_->A_, impl_->B_, value_of(impl_->A_), value_of(impl_->B_),
-            adjC);
-  }
-
-  quad_form_vari_alloc<Ta, Ra, Ca, Tb, Rb, Cb>* impl_;
-};
-
 /**
  * Return the quadratic form \f$ B^T A B \f$.
  *
  * Symmetry of the resulting matrix is not guaranteed due to numerical
  * precision.
  *
+ * Only the arguments and the result are kept on the arena. The forward
+ * product and the adjoints are computed one cache sized tile of columns
+ * of B at a time, see `quad_form_tiled()`, so no full intermediate such
+ * as \f$ A B \f$ is stored. Each tile of \f$ B \bar{C} \f$ is used for
+ * both adjoints. If `symmetric` and `A` is known to be symmetric only the
+ * lower half of the result is computed and the adjoint of `B` takes one
+ * product instead of two.
+ *
  * @tparam Mat1 type of the first (square) matrix
  * @tparam Mat2 type of the second matrix
  *
  * @param A square matrix
  * @param B second matrix
  * @param symmetric indicates whether the output should be made symmetric
+ * @param A_symmetric indicates whether A is symmetric
  * @return The quadratic form
  * @throws std::invalid_argument if A is not square, or if A cannot be
  * multiplied by B
  */
 template <typename Mat1, typename Mat2,
           require_all_matrix_t<Mat1, Mat2>* = nullptr,
-          require_any_var_matrix_t<Mat1, Mat2>* = nullptr>
-inline auto quad_form_impl(const Mat1& A, const Mat2& B, bool symmetric) {
+          require_any_st_var<Mat1, Mat2>* = nullptr>
+inline auto quad_form_impl(const Mat1& A, const Mat2& B, bool symmetric,
+                           bool A_symmetric = false) {
   check_square("quad_form", "A", A);
   check_multiplicable("quad_form", "A", A, "B", B);
 
@@ -123,101 +56,161 @@ inline auto quad_form_impl(const Mat1& A, const Mat2& B, bool symmetric) {
                                      * value_of(A) * value_of(B).eval()),
                             Mat1, Mat2>;
 
-  if (!is_constant<Mat1>::value && !is_constant<Mat2>::value) {
-    arena_t<promote_scalar_t<var, Mat1>> arena_A = A;
-    arena_t<promote_scalar_t<var, Mat2>> arena_B = B;
-
-    check_not_nan("multiply", "A", value_of(arena_A));
-    check_not_nan("multiply", "B", value_of(arena_B));
-
-    auto arena_res = to_arena(value_of(arena_B).transpose() * value_of(arena_A)
-                              * value_of(arena_B));
-
+  arena_t<Mat1> arena_A = A;
+  arena_t<Mat2> arena_B = B;
+
+  const auto& A_val = to_ref(value_of(arena_A));
+  const auto& B_val = to_ref(value_of(arena_B));
+  check_not_nan("multiply", "A", A_val);
+  check_not_nan("multiply", "B", B_val);
+  arena_t<return_t> res
+      = quad_form_tiled(A_val, B_val, symmetric, A_symmetric);
+
+  reverse_pass_callback([arena_A, arena_B, res, symmetric,
+                         A_symmetric]() mutable {
+    using A_var_t = arena_t<plain_type_t<promote_scalar_t<var, Mat1>>>;
+    using B_var_t = arena_t<plain_type_t<promote_scalar_t<var, Mat2>>>;
+    const auto& A_val = to_ref(value_of(arena_A));
+    const auto& B_val = to_ref(value_of(arena_B));
+    Eigen::MatrixXd res_adj = res.adj();
     if (symmetric) {
-      arena_res += arena_res.transpose().eval();
+      res_adj = (0.5 * (res_adj + res_adj.transpose())).eval();
     }
 
-    return_t res = arena_res;
+    for_each_tile(
+        B_val.cols(), quad_form_tile_cols(B_val.rows()),
+        [&](Eigen::Index j, Eigen::Index t) {
+          const Eigen::MatrixXd B_res_adj = B_val * res_adj.middleCols(j, t);
+          if (!is_constant<Mat1>::value) {
+            add_to_block(forward_as<A_var_t>(arena_A).adj(), 0, 0,
+                         B_res_adj * B_val.middleCols(j, t).transpose());
+          }
+          if (!is_constant<Mat2>::value) {
+            auto&& B_adj = forward_as<B_var_t>(arena_B).adj();
+            if (symmetric && A_symmetric) {
+              add_to_block(B_adj, 0, j, 2.0 * A_val * B_res_adj);
+            } else {
+              const Eigen::MatrixXd B_res_adj_t
+                  = B_val * res_adj.middleRows(j, t).transpose();
+              add_to_block(B_adj, 0, j,
+                           A_val * B_res_adj_t
+                               + A_val.transpose() * B_res_adj);
+            }
+          }
+        });
+  });
+
+  return return_t(res);
+}
 
-    reverse_pass_callback([arena_A, arena_B, res]() mutable {
-      auto C_adj_B_t = (res.adj() * value_of(arena_B).transpose()).eval();
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a sparse matrix variable.
+ *
+ * The adjoint of `A` is only formed inside its sparsity pattern.
+ *
+ * @tparam T type of the sparse matrix value
+ * @tparam Mat2 type of the dense matrix or vector
+ *
+ * @param A square sparse matrix
+ * @param B second matrix
+ * @param symmetric indicates whether the output should be made symmetric
+ * @return The quadratic form
+ * @throws std::invalid_argument if A is not square, or if A cannot be
+ * multiplied by B
+ */
+template <typename T, typename Mat2, require_eigen_sparse_base_t<T>* = nullptr,
+          require_matrix_t<Mat2>* = nullptr>
+inline auto quad_form_impl(const var_value<T>& A, const Mat2& B,
+                           bool symmetric) {
+  check_square("quad_form", "A", A);
+  check_multiplicable("quad_form", "A", A, "B", B);
 
-      if (is_var_matrix<Mat1>::value) {
-        arena_A.adj().noalias() += value_of(arena_B) * C_adj_B_t;
-      } else {
-        arena_A.adj() += value_of(arena_B) * C_adj_B_t;
-      }
+  arena_t<promote_scalar_t<double, Mat2>> arena_B_val = value_of(B);
+  check_not_nan("multiply", "B", arena_B_val);
+  using return_t
+      = return_var_matrix_t<decltype(arena_B_val.transpose() * arena_B_val),
+                            var_value<T>, Mat2>;
 
-      if (is_var_matrix<Mat2>::value) {
-        arena_B.adj().noalias()
-            += value_of(arena_A) * C_adj_B_t.transpose()
-               + value_of(arena_A).transpose() * value_of(arena_B) * res.adj();
-      } else {
-        arena_B.adj()
-            += value_of(arena_A) * C_adj_B_t.transpose()
-               + value_of(arena_A).transpose() * value_of(arena_B) * res.adj();
-      }
-    });
+  auto arena_res = to_arena(arena_B_val.transpose() * (A.val() * arena_B_val));
+  if (symmetric) {
+    arena_res = (0.5 * (arena_res + arena_res.transpose())).eval();
+  }
+  return_t res = arena_res;
 
-    return res;
-  } else if (!is_constant<Mat2>::value) {
-    arena_t<promote_scalar_t<double, Mat1>> arena_A = value_of(A);
+  if (!is_constant<Mat2>::value) {
     arena_t<promote_scalar_t<var, Mat2>> arena_B = B;
-
-    check_not_nan("multiply", "A", arena_A);
-    check_not_nan("multiply", "B", arena_B.val());
-
-    auto arena_res
-        = to_arena(value_of(arena_B).transpose() * arena_A * value_of(arena_B));
-
-    if (symmetric) {
-      arena_res += arena_res.transpose().eval();
-    }
-
-    return_t res = arena_res;
-
-    reverse_pass_callback([arena_A, arena_B, res]() mutable {
-      auto C_adj_B_t = (res.adj() * value_of(arena_B).transpose());
-
-      if (is_var_matrix<Mat2>::value) {
-        arena_B.adj().noalias()
-            += arena_A * C_adj_B_t.transpose()
-               + arena_A.transpose() * value_of(arena_B) * res.adj();
-      } else {
-        arena_B.adj() += arena_A * C_adj_B_t.transpose()
-                         + arena_A.transpose() * value_of(arena_B) * res.adj();
+    reverse_pass_callback(
+        [A, arena_B, arena_B_val, res, symmetric]() mutable {
+          Eigen::MatrixXd res_adj = res.adj();
+          if (symmetric) {
+            res_adj = (0.5 * (res_adj + res_adj.transpose())).eval();
+          }
+          Eigen::MatrixXd B_res_adj = arena_B_val * res_adj;
+          sparse_outer_adjoint(A.adj(), B_res_adj, arena_B_val);
+          arena_B.adj() += A.val() * (arena_B_val * res_adj.transpose())
+                           + A.val().transpose() * B_res_adj;
+        });
+  } else {
+    reverse_pass_callback([A, arena_B_val, res, symmetric]() mutable {
+      Eigen::MatrixXd res_adj = res.adj();
+      if (symmetric) {
+        res_adj = (0.5 * (res_adj + res_adj.transpose())).eval();
       }
+      sparse_outer_adjoint(A.adj(), (arena_B_val * res_adj).eval(),
+                           arena_B_val);
     });
+  }
+  return res;
+}
 
-    return res;
-  } else {
-    arena_t<promote_scalar_t<var, Mat1>> arena_A = A;
-    arena_t<promote_scalar_t<double, Mat2>> arena_B = value_of(B);
-
-    check_not_nan("multiply", "A", value_of(arena_A));
-    check_not_nan("multiply", "B", arena_B);
-
-    auto arena_res
-        = to_arena(arena_B.transpose() * value_of(arena_A) * arena_B);
-
-    if (symmetric) {
-      arena_res += arena_res.transpose().eval();
-    }
-
-    return_t res = arena_res;
-
-    reverse_pass_callback([arena_A, arena_B, res]() mutable {
-      auto C_adj_B_t = (res.adj() * arena_B.transpose());
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a sparse matrix of doubles
+ * and a dense matrix or vector of autodiff variables.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam Mat2 type of the dense matrix or vector
+ *
+ * @param A square sparse matrix
+ * @param B second matrix
+ * @param symmetric indicates whether the output should be made symmetric
+ * @return The quadratic form
+ * @throws std::invalid_argument if A is not square, or if A cannot be
+ * multiplied by B
+ */
+template <int Options, typename StorageIndex, typename Mat2,
+          require_matrix_t<Mat2>* = nullptr, require_st_var<Mat2>* = nullptr>
+inline auto quad_form_impl(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+    const Mat2& B, bool symmetric) {
+  using sparse_t = Eigen::SparseMatrix<double, Options, StorageIndex>;
+  check_square("quad_form", "A", A);
+  check_multiplicable("quad_form", "A", A, "B", B);
 
-      if (is_var_matrix<Mat1>::value) {
-        arena_A.adj().noalias() += arena_B * C_adj_B_t;
-      } else {
-        arena_A.adj() += arena_B * C_adj_B_t;
-      }
-    });
+  arena_t<sparse_t> arena_A = A;
+  arena_t<promote_scalar_t<var, Mat2>> arena_B = B;
+  arena_t<promote_scalar_t<double, Mat2>> arena_B_val = value_of(arena_B);
+  check_not_nan("multiply", "B", arena_B_val);
+  using return_t
+      = return_var_matrix_t<decltype(arena_B_val.transpose() * arena_B_val),
+                            sparse_t, Mat2>;
 
-    return res;
+  auto arena_res = to_arena(arena_B_val.transpose() * (arena_A * arena_B_val));
+  if (symmetric) {
+    arena_res = (0.5 * (arena_res + arena_res.transpose())).eval();
   }
+  return_t res = arena_res;
+
+  reverse_pass_callback(
+      [arena_A, arena_B, arena_B_val, res, symmetric]() mutable {
+        Eigen::MatrixXd res_adj = res.adj();
+        if (symmetric) {
+          res_adj = (0.5 * (res_adj + res_adj.transpose())).eval();
+        }
+        arena_B.adj() += arena_A * (arena_B_val * res_adj.transpose())
+                         + arena_A.transpose() * (arena_B_val * res_adj);
+      });
+  return res;
 }
 }  // namespace internal
 
@@ -244,15 +237,7 @@ template <typename EigMat1, typename EigMat2,
 inline promote_scalar_t<var, EigMat2> quad_form(const EigMat1& A,
                                                 const EigMat2& B,
                                                 bool symmetric = false) {
-  check_square("quad_form", "A", A);
-  check_multiplicable("quad_form", "A", A, "B", B);
-
-  auto* baseVari = new internal::quad_form_vari<
-      value_type_t<EigMat1>, EigMat1::RowsAtCompileTime,
-      EigMat1::ColsAtCompileTime, value_type_t<EigMat2>,
-      EigMat2::RowsAtCompileTime, EigMat2::ColsAtCompileTime>(A, B, symmetric);
-
-  return baseVari->impl_->C_;
+  return internal::quad_form_impl(A, B, symmetric);
 }
 
 /**
@@ -272,15 +257,7 @@ template <typename EigMat, typename ColVec, require_eigen_t<EigMat>* = nullptr,
           require_eigen_col_vector_t<ColVec>* = nullptr,
           require_any_vt_var<EigMat, ColVec>* = nullptr>
 inline var quad_form(const EigMat& A, const ColVec& B, bool symmetric = false) {
-  check_square("quad_form", "A", A);
-  check_multiplicable("quad_form", "A", A, "B", B);
-
-  auto* baseVari = new internal::quad_form_vari<
-      value_type_t<EigMat>, EigMat::RowsAtCompileTime,
-      EigMat::ColsAtCompileTime, value_type_t<ColVec>,
-      ColVec::RowsAtCompileTime, 1>(A, B, symmetric);
-
-  return baseVari->impl_->C_(0, 0);
+  return internal::quad_form_impl(A, B, symmetric)(0, 0);
 }
 
 /**
@@ -337,6 +314,102 @@ inline var quad_form(const Mat& A, const Vec& B, bool symmetric = false) {
   return internal::quad_form_impl(A, B, symmetric)(0, 0);
 }
 
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a sparse matrix variable.
+ *
+ * Only the sparse products \f$ A B \f$ and \f$ A^T B \f$ are formed and
+ * the adjoint of `A` is only computed inside its sparsity pattern.
+ *
+ * @tparam T type of the sparse matrix value
+ * @tparam Mat2 type of the second matrix
+ *
+ * @param A square sparse matrix
+ * @param B second matrix
+ * @param symmetric indicates whether the output should be made symmetric
+ * @return The quadratic form, which is a symmetric matrix.
+ * @throws std::invalid_argument if A is not square, or if A cannot be
+ * multiplied by B
+ */
+template <typename T, typename Mat2, require_eigen_sparse_base_t<T>* = nullptr,
+          require_matrix_t<Mat2>* = nullptr,
+          require_not_sparse_matrix_t<Mat2>* = nullptr,
+          require_not_col_vector_t<Mat2>* = nullptr>
+inline auto quad_form(const var_value<T>& A, const Mat2& B,
+                      bool symmetric = false) {
+  return internal::quad_form_impl(A, B, symmetric);
+}
+
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a sparse matrix variable
+ * and a vector.
+ *
+ * @tparam T type of the sparse matrix value
+ * @tparam Vec type of the vector
+ *
+ * @param A square sparse matrix
+ * @param B vector
+ * @param symmetric indicates whether the output should be made symmetric
+ * @return The quadratic form (a scalar).
+ * @throws std::invalid_argument if A is not square, or if A cannot be
+ * multiplied by B
+ */
+template <typename T, typename Vec, require_eigen_sparse_base_t<T>* = nullptr,
+          require_col_vector_t<Vec>* = nullptr>
+inline var quad_form(const var_value<T>& A, const Vec& B,
+                     bool symmetric = false) {
+  return internal::quad_form_impl(A, B, symmetric)(0, 0);
+}
+
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a sparse matrix of doubles
+ * and a dense matrix of autodiff variables.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam Mat2 type of the second matrix
+ *
+ * @param A square sparse matrix
+ * @param B second matrix
+ * @param symmetric indicates whether the output should be made symmetric
+ * @return The quadratic form, which is a symmetric matrix.
+ * @throws std::invalid_argument if A is not square, or if A cannot be
+ * multiplied by B
+ */
+template <int Options, typename StorageIndex, typename Mat2,
+          require_matrix_t<Mat2>* = nullptr,
+          require_not_sparse_matrix_t<Mat2>* = nullptr,
+          require_not_col_vector_t<Mat2>* = nullptr,
+          require_st_var<Mat2>* = nullptr>
+inline auto quad_form(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+    const Mat2& B, bool symmetric = false) {
+  return internal::quad_form_impl(A, B, symmetric);
+}
+
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a sparse matrix of doubles
+ * and a vector of autodiff variables.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam Vec type of the vector
+ *
+ * @param A square sparse matrix
+ * @param B vector
+ * @param symmetric indicates whether the output should be made symmetric
+ * @return The quadratic form (a scalar).
+ * @throws std::invalid_argument if A is not square, or if A cannot be
+ * multiplied by B
+ */
+template <int Options, typename StorageIndex, typename Vec,
+          require_col_vector_t<Vec>* = nullptr,
+          require_st_var<Vec>* = nullptr>
+inline var quad_form(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+    const Vec& B, bool symmetric = false) {
+  return internal::quad_form_impl(A, B, symmetric)(0, 0);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -6,6 +6,7 @@
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/rev/fun/quad_form.hpp>
 #include <type_traits>
 
@@ -15,7 +16,9 @@ namespace math {
 /**
  * Return the quadratic form \f$ B^T A B \f$ of a symmetric matrix.
  *
- * Symmetry of the resulting matrix is guaranteed.
+ * Symmetry of the resulting matrix is guaranteed. The symmetry of `A`
+ * and of the result halves the work of the reverse pass, see
+ * `internal::quad_form_impl()`.
  *
  * @tparam EigMat1 type of the first (symmetric) matrix
  * @tparam EigMat2 type of the second matrix
@@ -23,18 +26,41 @@ namespace math {
  * @param A symmetric matrix
  * @param B second matrix
  * @return The quadratic form, which is a symmetric matrix of size Cb.
- * If \c B is a column vector returns a scalar.
  * @throws std::invalid_argument if A is not symmetric, or if A cannot be
  * multiplied by B
  */
 template <typename EigMat1, typename EigMat2,
-          require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
-          require_any_vt_var<EigMat1, EigMat2>* = nullptr>
+          require_all_matrix_t<EigMat1, EigMat2>* = nullptr,
+          require_not_col_vector_t<EigMat2>* = nullptr,
+          require_any_st_var<EigMat1, EigMat2>* = nullptr>
 inline auto quad_form_sym(const EigMat1& A, const EigMat2& B) {
   check_multiplicable("quad_form_sym", "A", A, "B", B);
   const auto& A_ref = to_ref(A);
-  check_symmetric("quad_form_sym", "A", A_ref);
-  return quad_form(A_ref, B, true);
+  check_symmetric("quad_form_sym", "A", value_of(A_ref));
+  return internal::quad_form_impl(A_ref, B, true, true);
+}
+
+/**
+ * Return the quadratic form \f$ B^T A B \f$ of a symmetric matrix.
+ *
+ * @tparam EigMat type of the (symmetric) matrix
+ * @tparam ColVec type of the vector
+ *
+ * @param A symmetric matrix
+ * @param B vector
+ * @return The quadratic form (a scalar).
+ * @throws std::invalid_argument if A is not symmetric, or if A cannot be
+ * multiplied by B
+ */
+template <typename EigMat, typename ColVec,
+          require_all_matrix_t<EigMat, ColVec>* = nullptr,
+          require_col_vector_t<ColVec>* = nullptr,
+          require_any_st_var<EigMat, ColVec>* = nullptr>
+inline var quad_form_sym(const EigMat& A, const ColVec& B) {
+  check_multiplicable("quad_form_sym", "A", A, "B", B);
+  const auto& A_ref = to_ref(A);
+  check_symmetric("quad_form_sym", "A", value_of(A_ref));
+  return internal::quad_form_impl(A_ref, B, true, true)(0, 0);
 }
 
 }  // namespace math
@@ -0,0 +1,155 @@
+#ifndef STAN_MATH_REV_FUN_QUAD_FORM_TILED_HPP
+#define STAN_MATH_REV_FUN_QUAD_FORM_TILED_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/symmetrize_from_lower_tri.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <algorithm>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Return the number of columns of the tiles in which the quadratic form
+ * functions compute their products, chosen so that a tile with `rows`
+ * rows takes at most about 8 MB while staying wide enough for efficient
+ * matrix products.
+ *
+ * The products of the quadratic forms are recomputed tile by tile
+ * instead of storing full intermediates such as \f$A B\f$ on the arena,
+ * so the memory a call holds beyond its arguments and result is a few
+ * tiles, and that only while it runs.
+ *
+ * @param rows number of rows of the tiles
+ * @return number of columns of the tiles
+ */
+inline Eigen::Index quad_form_tile_cols(Eigen::Index rows) {
+  constexpr Eigen::Index tile_doubles = 1 << 20;
+  return std::max<Eigen::Index>(64,
+                                tile_doubles / std::max<Eigen::Index>(rows, 1));
+}
+
+/**
+ * Return whether a quadratic form function should keep its `rows` x
+ * `cols` intermediate products on the arena for the reverse pass
+ * instead of recomputing them tile by tile. Below about 32 MB per
+ * product, storing them is faster and the memory is modest.
+ *
+ * @param rows number of rows of the products
+ * @param cols number of columns of the products
+ * @return whether to store the products
+ */
+inline bool quad_form_stores_products(Eigen::Index rows, Eigen::Index cols) {
+  constexpr Eigen::Index stored_doubles = 1 << 22;
+  return rows * cols <= stored_doubles;
+}
+
+/**
+ * Call `f(start, size)` for consecutive tiles of at most `tile_size`
+ * indices that cover `[0, n)`.
+ *
+ * @tparam F type of the functor
+ * @param n number of indices
+ * @param tile_size maximal number of indices of a tile
+ * @param f functor
+ */
+template <typename F>
+inline void for_each_tile(Eigen::Index n, Eigen::Index tile_size, F&& f) {
+  for (Eigen::Index start = 0; start < n; start += tile_size) {
+    f(start, std::min(tile_size, n - start));
+  }
+}
+
+/**
+ * Add the matrix `M` to the block of `res` whose top left corner is at
+ * row `i` and column `j`.
+ *
+ * The update goes coefficient by coefficient, as blocks of the adjoint
+ * view of an Eigen matrix of vars are not valid lvalues.
+ *
+ * @tparam T_res type of the matrix updated in place, e.g. an adjoint
+ * @tparam EigMat type of the added matrix
+ * @param res matrix to update
+ * @param i first row of the block
+ * @param j first column of the block
+ * @param M matrix to add
+ */
+template <typename T_res, typename EigMat>
+inline void add_to_block(T_res&& res, Eigen::Index i, Eigen::Index j,
+                         const EigMat& M) {
+  const auto& M_ref = to_ref(M);
+  for (Eigen::Index c = 0; c < M_ref.cols(); ++c) {
+    for (Eigen::Index r = 0; r < M_ref.rows(); ++r) {
+      res.coeffRef(i + r, j + c) += M_ref.coeff(r, c);
+    }
+  }
+}
+
+/**
+ * Return \f$B^T A B\f$ computed one tile of columns of \f$B\f$ at a
+ * time. If `symmetric` the result is \f$\frac{1}{2}(C + C^T)\f$. If
+ * `A_symmetric` as well only the lower block triangle of the result is
+ * computed and then mirrored.
+ *
+ * @tparam EigMat1 type of the matrix A
+ * @tparam EigMat2 type of the matrix B
+ * @param A square matrix
+ * @param B matrix
+ * @param symmetric whether to symmetrize the result
+ * @param A_symmetric whether A is symmetric
+ * @return quadratic form
+ */
+template <typename EigMat1, typename EigMat2>
+inline Eigen::MatrixXd quad_form_tiled(const EigMat1& A, const EigMat2& B,
+                                       bool symmetric, bool A_symmetric) {
+  const Eigen::Index K = B.cols();
+  Eigen::MatrixXd C(K, K);
+  const bool lower_only = symmetric && A_symmetric;
+  for_each_tile(K, quad_form_tile_cols(B.rows()),
+                [&](Eigen::Index j, Eigen::Index t) {
+                  const Eigen::MatrixXd AB_j = A * B.middleCols(j, t);
+                  const Eigen::Index first = lower_only ? j : 0;
+                  C.block(first, j, K - first, t).noalias()
+                      = B.rightCols(K - first).transpose() * AB_j;
+                });
+  if (lower_only) {
+    C = symmetrize_from_lower_tri(C);
+  } else if (symmetric) {
+    C = (0.5 * (C + C.transpose())).eval();
+  }
+  return C;
+}
+
+/**
+ * Add the symmetric product \f$L R^T\f$ to `res`, where the rows of
+ * \f$L\f$ are computed tile by tile with `left_rows(start, size)`. Only
+ * the lower block triangle of the product is computed and mirrored,
+ * which with at least eight tiles takes a bit over half the work of the
+ * full product.
+ *
+ * @tparam T_res type of the matrix updated in place, e.g. an adjoint
+ * @tparam F type of the functor computing rows of L
+ * @tparam EigMat type of the matrix R
+ * @param res square matrix to update
+ * @param left_rows functor returning the rows `[start, start + size)`
+ * of L
+ * @param R right factor
+ */
+template <typename T_res, typename F, typename EigMat>
+inline void add_symmetric_product_tiled(T_res&& res, const F& left_rows,
+                                        const EigMat& R) {
+  const Eigen::Index n = R.rows();
+  const Eigen::Index tile_rows = std::min(
+      quad_form_tile_cols(n), std::max<Eigen::Index>(64, (n + 7) / 8));
+  for_each_tile(n, tile_rows, [&](Eigen::Index i, Eigen::Index t) {
+    const Eigen::MatrixXd P = left_rows(i, t) * R.topRows(i + t).transpose();
+    add_to_block(res, i, 0, P);
+    add_to_block(res, 0, i, P.leftCols(i).transpose());
+  });
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,35 @@
+#ifndef STAN_MATH_REV_FUN_SCALE_MATRIX_EXP_MULTIPLY_HPP
+#define STAN_MATH_REV_FUN_SCALE_MATRIX_EXP_MULTIPLY_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/fun/matrix_exp_multiply.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return product of exp(At) and B, where A is a NxN matrix, B is a
+ * NxCb matrix and t is a scalar, and at least one of them holds reverse
+ * mode autodiff variables. See `internal::matrix_exp_multiply_rev()`.
+ *
+ * @tparam Tt type of the scalar t
+ * @tparam Ta type of the matrix A
+ * @tparam Tb type of the matrix B
+ * @param[in] t scalar
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return exponential of At multiplied by B
+ */
+template <typename Tt, typename Ta, typename Tb,
+          require_stan_scalar_t<Tt>* = nullptr,
+          require_all_matrix_t<Ta, Tb>* = nullptr,
+          require_any_st_var<Tt, Ta, Tb>* = nullptr>
+inline auto scale_matrix_exp_multiply(const Tt& t, const Ta& A, const Tb& B) {
+  return internal::matrix_exp_multiply_rev("scale_matrix_exp_multiply", t, A,
+                                           B);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef STAN_MATH_REV_FUN_TRANSPOSE_MULTIPLY_HPP
+#define STAN_MATH_REV_FUN_TRANSPOSE_MULTIPLY_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/multiply.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the product of the transpose of the first matrix and the second
+ * matrix, \f$ A^T B \f$, where at least one argument holds autodiff
+ * variables and neither is sparse.
+ *
+ * @tparam T1 type of the first matrix
+ * @tparam T2 type of the second matrix or vector
+ *
+ * @param[in] A first matrix
+ * @param[in] B second matrix or vector
+ * @return A' * B
+ */
+template <typename T1, typename T2, require_all_matrix_t<T1, T2>* = nullptr,
+          require_any_st_var<T1, T2>* = nullptr,
+          require_all_not_sparse_matrix_t<T1, T2>* = nullptr>
+inline auto transpose_multiply(const T1& A, const T2& B) {
+  check_size_match("transpose_multiply", "Rows of ", "A", A.rows(),
+                   "Rows of ", "B", B.rows());
+  return multiply(A.transpose(), B);
+}
+
+/**
+ * Return the product of the transpose of a sparse matrix and a dense
+ * matrix or vector, \f$ A^T B \f$, where the sparse matrix is a
+ * `var_value`. The transpose of `A` is never formed and the adjoint of
+ * `A` is only computed inside its sparsity pattern.
+ *
+ * @tparam T type of the sparse matrix value
+ * @tparam T2 type of the dense matrix or vector
+ *
+ * @param[in] A sparse matrix
+ * @param[in] B dense matrix or vector
+ * @return A' * B
+ */
+template <typename T, typename T2, require_eigen_sparse_base_t<T>* = nullptr,
+          require_matrix_t<T2>* = nullptr,
+          require_not_sparse_matrix_t<T2>* = nullptr>
+inline auto transpose_multiply(const var_value<T>& A, const T2& B) {
+  check_size_match("transpose_multiply", "Rows of ", "A", A.rows(),
+                   "Rows of ", "B", B.rows());
+  arena_t<promote_scalar_t<double, T2>> arena_B_val = value_of(B);
+  using return_t
+      = return_var_matrix_t<decltype(A.val().transpose() * arena_B_val),
+                            var_value<T>, T2>;
+  arena_t<return_t> res = A.val().transpose() * arena_B_val;
+  if (!is_constant<T2>::value) {
+    arena_t<promote_scalar_t<var, T2>> arena_B = B;
+    reverse_pass_callback([A, arena_B, arena_B_val, res]() mutable {
+      const auto& res_adj = to_ref(res.adj());
+      internal::sparse_outer_adjoint(A.adj(), arena_B_val, res_adj);
+      arena_B.adj() += A.val() * res_adj;
+    });
+  } else {
+    reverse_pass_callback([A, arena_B_val, res]() mutable {
+      internal::sparse_outer_adjoint(A.adj(), arena_B_val, to_ref(res.adj()));
+    });
+  }
+  return return_t(res);
+}
+
+/**
+ * Return the product of the transpose of a sparse matrix of doubles and a
+ * dense matrix or vector of autodiff variables, \f$ A^T B \f$.
+ *
+ * @tparam Options storage options of the sparse matrix
+ * @tparam StorageIndex index type of the sparse matrix
+ * @tparam T2 type of the dense matrix or vector
+ *
+ * @param[in] A sparse matrix
+ * @param[in] B dense matrix or vector
+ * @return A' * B
+ */
+template <int Options, typename StorageIndex, typename T2,
+          require_matrix_t<T2>* = nullptr,
+          require_not_sparse_matrix_t<T2>* = nullptr,
+          require_st_var<T2>* = nullptr>
+inline auto transpose_multiply(
+    const Eigen::SparseMatrix<double, Options, StorageIndex>& A,
+    const T2& B) {
+  using sparse_t = Eigen::SparseMatrix<double, Options, StorageIndex>;
+  check_size_match("transpose_multiply", "Rows of ", "A", A.rows(),
+                   "Rows of ", "B", B.rows());
+  arena_t<sparse_t> arena_A = A;
+  arena_t<promote_scalar_t<var, T2>> arena_B = B;
+  using return_t
+      = return_var_matrix_t<decltype(arena_A.transpose() * value_of(B).eval()),
+                            sparse_t, T2>;
+  arena_t<return_t> res = arena_A.transpose() * arena_B.val_op();
+  reverse_pass_callback([arena_A, arena_B, res]() mutable {
+    arena_B.adj() += arena_A * res.adj_op();
+  });
+  return return_t(res);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
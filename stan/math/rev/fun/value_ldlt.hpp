@@ -0,0 +1,34 @@
+#ifndef STAN_MATH_REV_FUN_VALUE_LDLT_HPP
+#define STAN_MATH_REV_FUN_VALUE_LDLT_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/factorization_cache.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/value_ldlt.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the LDLT of the values of a matrix of vars. The factorization
+ * is cached for the rest of the gradient evaluation, so the LDLT_factors
+ * and log densities that take the same matrix share it.
+ *
+ * @tparam Scalar scalar type of the factorization, which is `double`
+ * @tparam T type of the matrix
+ * @param A matrix
+ * @return reference to the LDLT of the values of the matrix
+ */
+template <typename Scalar, typename T, require_rev_matrix_t<T>* = nullptr,
+          require_same_t<Scalar, double>* = nullptr>
+inline const Eigen::LDLT<Eigen::MatrixXd>& value_ldlt(const T& A) {
+  return internal::get_cached_factorization<Eigen::LDLT<Eigen::MatrixXd>>(
+      A, [](const auto& A_val) {
+        return Eigen::LDLT<Eigen::MatrixXd>(Eigen::MatrixXd(A_val));
+      });
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
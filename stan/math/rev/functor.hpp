@@ -11,6 +11,7 @@
 #include <stan/math/rev/functor/cvodes_integrator.hpp>
 #include <stan/math/rev/functor/cvodes_utils.hpp>
 #include <stan/math/rev/functor/gradient.hpp>
+#include <stan/math/rev/functor/gradient_evaluator.hpp>
 #include <stan/math/rev/functor/integrate_1d.hpp>
 #include <stan/math/rev/functor/integrate_dae.hpp>
 #include <stan/math/rev/functor/integrate_ode_adams.hpp>
@@ -25,6 +26,7 @@
 #include <stan/math/rev/functor/map_rect_reduce.hpp>
 #include <stan/math/rev/functor/operands_and_partials.hpp>
 #include <stan/math/rev/functor/reduce_sum.hpp>
+#include <stan/math/rev/functor/sparse_jacobian.hpp>
 #include <stan/math/rev/functor/finite_diff_hessian_auto.hpp>
 
 #endif
@@ -6,11 +6,39 @@
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/rev/functor.hpp>
 #include <stan/math/prim/fun/finite_diff_stepsize.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 #include <stdexcept>
+#include <vector>
 
 namespace stan {
 namespace math {
 namespace internal {
+
+/**
+ * Approximate the Hessian of a function as the central finite
+ * difference of its gradients at perturbed arguments.
+ *
+ * @param[in] g_plus gradients at `x + epsilons[i] * e_i`
+ * @param[in] g_minus gradients at `x - epsilons[i] * e_i`
+ * @param[in] epsilons step sizes
+ * @param[out] hess_fx Hessian, sized before the call
+ */
+inline void finite_diff_hessian_from_gradients(
+    const std::vector<Eigen::VectorXd>& g_plus,
+    const std::vector<Eigen::VectorXd>& g_minus,
+    const std::vector<double>& epsilons, Eigen::MatrixXd& hess_fx) {
+  const int d = epsilons.size();
+  // approximate the hessian as a finite difference of gradients
+  for (int i = 0; i < d; ++i) {
+    for (int j = i; j < d; ++j) {
+      hess_fx(j, i) = (g_plus[j](i) - g_minus[j](i)) / (4 * epsilons[j])
+                      + (g_plus[i](j) - g_minus[i](j)) / (4 * epsilons[i]);
+      hess_fx(i, j) = hess_fx(j, i);
+    }
+  }
+}
+
 /**
  * Calculate the value and the Hessian of the specified function at
  * the specified argument using first-order finite difference of gradients,
@@ -71,14 +99,68 @@ void finite_diff_hessian_auto(const F& f, const Eigen::VectorXd& x, double& fx,
     x_temp(i) -= epsilons[i];
     gradient(f, x_temp, tmp, g_minus[i]);
   }
-  // approximate the hessian as a finite difference of gradients
+  finite_diff_hessian_from_gradients(g_plus, g_minus, epsilons, hess_fx);
+}
+
+/**
+ * Calculate the value and the Hessian of the specified function at
+ * the specified argument using first-order finite difference of gradients,
+ * like <code>finite_diff_hessian_auto()</code>, computing the 2n
+ * gradients concurrently with the TBB if `STAN_THREADS` is defined.
+ *
+ * <p>Each gradient is computed exactly as in the serial version, so the
+ * results are bitwise identical. The functor must be safe to call
+ * concurrently from several threads.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad_fx Gradient of function at argument
+ * @param[out] hess_fx Hessian of function at argument
+ */
+template <typename F>
+void finite_diff_hessian_auto_parallel(const F& f, const Eigen::VectorXd& x,
+                                       double& fx, Eigen::VectorXd& grad_fx,
+                                       Eigen::MatrixXd& hess_fx) {
+  int d = x.size();
+  hess_fx.resize(d, d);
+
+  gradient(f, x, fx, grad_fx);
+
+  std::vector<Eigen::VectorXd> g_plus(d);
+  std::vector<Eigen::VectorXd> g_minus(d);
+  std::vector<double> epsilons(d);
   for (int i = 0; i < d; ++i) {
-    for (int j = i; j < d; ++j) {
-      hess_fx(j, i) = (g_plus[j](i) - g_minus[j](i)) / (4 * epsilons[j])
-                      + (g_plus[i](j) - g_minus[i](j)) / (4 * epsilons[i]);
-      hess_fx(i, j) = hess_fx(j, i);
-    }
+    epsilons[i] = finite_diff_stepsize(x(i));
   }
+
+  // gradients k < d are at x+eps_k*e_k, the others at x-eps_k*e_k
+  auto execute_chunk = [&](std::size_t start, std::size_t end) {
+    for (std::size_t k = start; k != end; ++k) {
+      const bool plus = k < static_cast<std::size_t>(d);
+      const int i = plus ? k : k - d;
+      Eigen::VectorXd x_temp(x);
+      double tmp;
+      if (plus) {
+        x_temp(i) += epsilons[i];
+        gradient(f, x_temp, tmp, g_plus[i]);
+      } else {
+        x_temp(i) -= epsilons[i];
+        gradient(f, x_temp, tmp, g_minus[i]);
+      }
+    }
+  };
+#ifdef STAN_THREADS
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, 2 * d),
+                    [&](const tbb::blocked_range<size_t>& r) {
+                      execute_chunk(r.begin(), r.end());
+                    });
+#else
+  execute_chunk(0, 2 * d);
+#endif
+
+  finite_diff_hessian_from_gradients(g_plus, g_minus, epsilons, hess_fx);
 }
 }  // namespace internal
 }  // namespace math
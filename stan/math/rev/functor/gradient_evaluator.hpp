@@ -0,0 +1,133 @@
+#ifndef STAN_MATH_REV_FUNCTOR_GRADIENT_EVALUATOR_HPP
+#define STAN_MATH_REV_FUNCTOR_GRADIENT_EVALUATOR_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * The vari of an input of a `gradient_evaluator`. Its storage belongs
+ * to the session, which constructs it again in place for every call
+ * instead of allocating it on the arena, so each call starts from a
+ * zero adjoint. It is not put on a stack, since it is never chained
+ * and nothing else needs to reset it.
+ */
+class gradient_input_vari : public vari {
+ public:
+  explicit gradient_input_vari(double x) noexcept : vari(x, unstacked{}) {}
+};
+
+}  // namespace internal
+
+/**
+ * A session for computing the value and the gradient of a function at
+ * many arguments, as `gradient()` does for a single argument.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * var
+ * operator()(const
+ * Eigen::Matrix<var, Eigen::Dynamic, 1>&)
+ * </code>
+ *
+ * <p>Each call still records the expression graph of the function in a
+ * nested autodiff scope. The varis of the inputs are not part of that
+ * graph: the session owns their storage and only resets their values
+ * and adjoints, so they are neither allocated on the arena nor put on a
+ * stack. Together with the arena blocks, which are kept between calls,
+ * repeated calls with arguments of the same size do not allocate.
+ *
+ * <p>The arena is the one of the calling thread. A session holds state
+ * between calls, so it must not be shared between threads running
+ * concurrently; use one session per thread instead.
+ *
+ * @tparam F Type of function
+ */
+template <typename F>
+class gradient_evaluator {
+  using input_storage
+      = std::aligned_storage_t<sizeof(internal::gradient_input_vari),
+                               alignof(internal::gradient_input_vari)>;
+  F f_;
+  // storage of the input varis, which outlives the nested scopes
+  std::vector<input_storage> x_vari_;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> x_var_;
+
+ public:
+  /**
+   * Create a session for the specified function.
+   *
+   * @param[in] f Function
+   * @param[in] arena_bytes number of bytes to reserve in the arena of
+   * the calling thread for the expression graph, or 0 to grow it on
+   * demand
+   */
+  explicit gradient_evaluator(const F& f, std::size_t arena_bytes = 0)
+      : f_(f) {
+    if (arena_bytes > 0) {
+      // blocks of the arena are kept after the nested scope is recovered
+      nested_rev_autodiff nested;
+      ChainableStack::instance_->memalloc_.alloc(arena_bytes);
+    }
+  }
+
+  /**
+   * Calculate the value and the gradient of the function at the
+   * specified argument.
+   *
+   * @param[in] x Argument to function
+   * @param[out] fx Function applied to argument
+   * @param[out] grad_fx Gradient of function at argument
+   */
+  inline void operator()(const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                         double& fx,
+                         Eigen::Matrix<double, Eigen::Dynamic, 1>& grad_fx) {
+    nested_rev_autodiff nested;
+
+    if (x_var_.size() != x.size()) {
+      x_vari_.resize(x.size());
+      x_var_.resize(x.size());
+    }
+    for (int i = 0; i < x.size(); ++i) {
+      // vari::val_ is const, so the input is constructed again in place
+      x_var_.coeffRef(i).vi_
+          = ::new (&x_vari_[i]) internal::gradient_input_vari(x.coeff(i));
+    }
+    var fx_var = f_(x_var_);
+    fx = fx_var.val();
+    grad(fx_var.vi_);
+    grad_fx.resize(x.size());
+    for (int i = 0; i < x.size(); ++i) {
+      grad_fx.coeffRef(i) = x_var_.coeff(i).adj();
+    }
+  }
+};
+
+/**
+ * Return a session for computing the value and the gradient of the
+ * specified function at many arguments.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] arena_bytes number of bytes to reserve in the arena of the
+ * calling thread for the expression graph, or 0 to grow it on demand
+ * @return session for the function
+ */
+template <typename F>
+inline gradient_evaluator<std::decay_t<F>> make_gradient_evaluator(
+    const F& f, std::size_t arena_bytes = 0) {
+  return gradient_evaluator<std::decay_t<F>>(f, arena_bytes);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
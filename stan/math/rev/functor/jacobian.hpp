@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stdexcept>
 #include <vector>
@@ -34,6 +35,91 @@ void jacobian(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
   J.transposeInPlace();
 }
 
+/**
+ * Calculate the value of the specified function at the specified
+ * argument and the product of a vector with its Jacobian. The
+ * function is evaluated once and its expression graph is swept in
+ * reverse once, from the outputs weighted by the vector, instead of
+ * once per output as needed to form the Jacobian.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix\<var, Eigen::Dynamic, 1\>
+ * operator()(const Eigen::Matrix\<var, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] u vector multiplying the Jacobian from the left
+ * @param[out] fx function applied to argument
+ * @param[out] uJ product of `u` transposed and the Jacobian of function at
+ * argument, as a column vector
+ * @throw std::invalid_argument if the size of `u` does not match the size
+ * of the result
+ */
+template <typename F>
+void vjp(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+         const Eigen::Matrix<double, Eigen::Dynamic, 1>& u,
+         Eigen::Matrix<double, Eigen::Dynamic, 1>& fx,
+         Eigen::Matrix<double, Eigen::Dynamic, 1>& uJ) {
+  // Run nested autodiff in this scope
+  nested_rev_autodiff nested;
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> x_var(x);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> fx_var = f(x_var);
+  check_size_match("vjp", "size of u", u.size(), "size of result",
+                   fx_var.size());
+  fx = fx_var.val();
+  for (int i = 0; i < fx_var.size(); ++i) {
+    fx_var(i).vi_->adj_ += u(i);
+  }
+  grad();
+  uJ = x_var.adj();
+}
+
+/**
+ * Calculate the value of the specified function at the specified
+ * argument and the products of several vectors with its Jacobian. The
+ * function is evaluated once and its expression graph is swept in
+ * reverse once per vector.
+ *
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] U matrix with the vectors multiplying the Jacobian as rows
+ * @param[out] fx function applied to argument
+ * @param[out] UJ product of `U` and the Jacobian of function at argument
+ * @throw std::invalid_argument if the number of columns of `U` does not
+ * match the size of the result
+ */
+template <typename F>
+void vjp(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+         const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& U,
+         Eigen::Matrix<double, Eigen::Dynamic, 1>& fx,
+         Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& UJ) {
+  // Run nested autodiff in this scope
+  nested_rev_autodiff nested;
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> x_var(x);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> fx_var = f(x_var);
+  check_size_match("vjp", "columns of U", U.cols(), "size of result",
+                   fx_var.size());
+  fx = fx_var.val();
+  UJ.resize(U.rows(), x.size());
+  for (int k = 0; k < U.rows(); ++k) {
+    if (k > 0) {
+      nested.set_zero_all_adjoints();
+    }
+    for (int i = 0; i < fx_var.size(); ++i) {
+      fx_var(i).vi_->adj_ += U(k, i);
+    }
+    grad();
+    UJ.row(k) = x_var.adj().transpose();
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
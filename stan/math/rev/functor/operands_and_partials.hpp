@@ -142,6 +142,9 @@ class operands_and_partials<Op1, Op2, Op3, Op4, Op5, var> {
         edge3_.container_partials(), edge4_.container_partials(),
         edge5_.container_partials());
 
+    // scalars broadcast into several operands are chained once
+    edges_size
+        = internal::merge_repeated_operands(varis, partials, edges_size);
     return var(return_vari(value, edges_size, varis, partials,
                            container_operands, container_partials));
   }
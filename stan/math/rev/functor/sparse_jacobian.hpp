@@ -0,0 +1,126 @@
+#ifndef STAN_MATH_REV_FUNCTOR_SPARSE_JACOBIAN_HPP
+#define STAN_MATH_REV_FUNCTOR_SPARSE_JACOBIAN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/column_coloring.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Detects the sparsity pattern of the Jacobian of the specified function by
+ * tracing its expression graph at the specified argument. The graph is
+ * recorded once and swept in reverse from each output; the inputs the
+ * sweep reaches with a nonzero or non-finite adjoint depend on that output.
+ *
+ * Partial derivatives that happen to vanish at `x` are not detected, so the
+ * pattern should be detected at a generic argument and can then be reused
+ * with `sparse_jacobian()` at other arguments.
+ *
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @return pattern with an entry of 1 for each dependency of an output on
+ * an input
+ */
+template <typename F>
+Eigen::SparseMatrix<double> jacobian_sparsity(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x) {
+  // Run nested autodiff in this scope
+  nested_rev_autodiff nested;
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> x_var(x);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> fx_var = f(x_var);
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int i = 0; i < fx_var.size(); ++i) {
+    if (i > 0) {
+      nested.set_zero_all_adjoints();
+    }
+    grad(fx_var(i).vi_);
+    for (int j = 0; j < x.size(); ++j) {
+      const double adj = x_var(j).adj();
+      if (adj != 0 || !std::isfinite(adj)) {
+        entries.emplace_back(i, j, 1.0);
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(fx_var.size(), x.size());
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  return pattern;
+}
+
+/**
+ * Calculate the value and the sparse Jacobian of the specified function at
+ * the specified argument, given the sparsity pattern of the Jacobian.
+ *
+ * The rows of the pattern are colored so that rows of one color share no
+ * column. The function is evaluated once and its expression graph is swept
+ * in reverse once per color, from the sum of the outputs of that color,
+ * which recovers all entries of these rows. That takes as many sweeps as
+ * there are colors instead of one per output.
+ *
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] pattern sparsity pattern of the Jacobian, every nonzero of the
+ * Jacobian must be stored in it
+ * @param[out] fx function applied to argument
+ * @param[out] J Jacobian of function at argument, with the pattern of
+ * `pattern`
+ * @throw std::invalid_argument if the size of the pattern does not match
+ * the sizes of the argument and the result
+ */
+template <typename F>
+void sparse_jacobian(const F& f,
+                     const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                     const Eigen::SparseMatrix<double>& pattern,
+                     Eigen::Matrix<double, Eigen::Dynamic, 1>& fx,
+                     Eigen::SparseMatrix<double>& J) {
+  // Run nested autodiff in this scope
+  nested_rev_autodiff nested;
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> x_var(x);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> fx_var = f(x_var);
+  check_size_match("sparse_jacobian", "rows of pattern", pattern.rows(),
+                   "size of result", fx_var.size());
+  check_size_match("sparse_jacobian", "columns of pattern", pattern.cols(),
+                   "size of argument", x.size());
+  fx = fx_var.val();
+
+  const Eigen::SparseMatrix<double> pattern_t = pattern.transpose();
+  const std::vector<int> colors = column_coloring(pattern_t);
+  const int n_colors
+      = colors.empty() ? 0
+                       : *std::max_element(colors.begin(), colors.end()) + 1;
+  std::vector<std::vector<int>> rows_of_color(n_colors);
+  for (size_t i = 0; i < colors.size(); ++i) {
+    rows_of_color[colors[i]].push_back(i);
+  }
+
+  J = pattern;
+  for (int c = 0; c < n_colors; ++c) {
+    if (c > 0) {
+      nested.set_zero_all_adjoints();
+    }
+    for (int i : rows_of_color[c]) {
+      fx_var(i).vi_->adj_ = 1;
+    }
+    grad();
+    for (int i : rows_of_color[c]) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(pattern_t, i); it;
+           ++it) {
+        J.coeffRef(i, it.row()) = x_var(it.row()).adj();
+      }
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
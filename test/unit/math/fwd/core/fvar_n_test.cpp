@@ -0,0 +1,162 @@
+#include <stan/math/fwd.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <sstream>
+
+TEST(mathFwdCoreFvarN, ctor) {
+  using stan::math::fvar_n;
+  fvar_n<double, 3> a;
+  EXPECT_FLOAT_EQ(0.0, a.val_);
+  EXPECT_TRUE(a.d_.isZero());
+
+  fvar_n<double, 3> b(1.9);
+  EXPECT_FLOAT_EQ(1.9, b.val_);
+  EXPECT_TRUE(b.d_.isZero());
+
+  Eigen::Vector3d d(1, -2, 3);
+  fvar_n<double, 3> c(1.93, d);
+  EXPECT_FLOAT_EQ(1.93, c.val_);
+  EXPECT_FLOAT_EQ(1, c.d_(0));
+  EXPECT_FLOAT_EQ(-2, c.d_(1));
+  EXPECT_FLOAT_EQ(3, c.d_(2));
+
+  std::stringstream ss;
+  ss << c;
+  EXPECT_EQ("1.93", ss.str());
+}
+
+// every tangent of the results must match the tangent of fvar<double>
+// seeded with the same direction
+template <typename F>
+void expect_fvar_n_matches_fvar(const F& f, double x_val, double y_val) {
+  using stan::math::fvar;
+  using stan::math::fvar_n;
+  Eigen::Vector4d x_d(1, 0, 0.5, 2);
+  Eigen::Vector4d y_d(0, 1, -1, 3);
+  fvar_n<double, 4> x(x_val, x_d);
+  fvar_n<double, 4> y(y_val, y_d);
+  fvar_n<double, 4> res = f(x, y);
+  for (int i = 0; i < 4; i++) {
+    fvar<double> res_i = f(fvar<double>(x_val, x_d(i)),
+                           fvar<double>(y_val, y_d(i)));
+    EXPECT_FLOAT_EQ(res_i.val_, res.val_);
+    EXPECT_FLOAT_EQ(res_i.d_, res.d_(i));
+  }
+}
+
+TEST(mathFwdCoreFvarN, arithmetic) {
+  auto f = [](const auto& x, const auto& y) {
+    auto z = x * y - y / x + 2.0 * x - y * 3 + 1.5 / y + (-x) + (+y) - 1;
+    z += x;
+    z -= 0.5;
+    z *= y;
+    z /= x;
+    z *= 2;
+    z /= 3;
+    z += 1;
+    z -= y;
+    return z;
+  };
+  expect_fvar_n_matches_fvar(f, 1.3, -0.7);
+}
+
+TEST(mathFwdCoreFvarN, comparison) {
+  using stan::math::fvar_n;
+  fvar_n<double, 2> a(1.0, Eigen::Vector2d(1, 2));
+  fvar_n<double, 2> b(2.0, Eigen::Vector2d(-1, 0));
+  EXPECT_TRUE(a < b);
+  EXPECT_TRUE(a <= b);
+  EXPECT_FALSE(a > b);
+  EXPECT_FALSE(a >= b);
+  EXPECT_FALSE(a == b);
+  EXPECT_TRUE(a != b);
+  EXPECT_TRUE(a == 1);
+  EXPECT_TRUE(1.0 == a);
+  EXPECT_TRUE(a < 1.5);
+  EXPECT_TRUE(0.5 < a);
+}
+
+TEST(mathFwdCoreFvarN, functions) {
+  using stan::math::exp;
+  using stan::math::expm1;
+  using stan::math::fabs;
+  using stan::math::inv;
+  using stan::math::inv_logit;
+  using stan::math::log;
+  using stan::math::log1p;
+  using stan::math::pow;
+  using stan::math::sqrt;
+  using stan::math::square;
+  using stan::math::tanh;
+  auto f = [](const auto& x, const auto& y) {
+    return exp(x) * log(y) + sqrt(y) - square(x) + inv(y) + sin(x) * cos(y)
+           + tanh(x) + log1p(y) + expm1(x) + inv_logit(x) + fabs(x)
+           + pow(x, y) + pow(2.0, x) + pow(y, 2.5) + pow(y, 2);
+  };
+  expect_fvar_n_matches_fvar(f, 0.8, 1.7);
+  expect_fvar_n_matches_fvar(f, 1.4, 0.4);
+  auto g = [](const auto& x, const auto& y) {
+    using stan::math::fabs;
+    return fabs(x) * y;
+  };
+  expect_fvar_n_matches_fvar(g, -0.3, 0.4);
+}
+
+TEST(mathFwdCoreFvarN, eigen) {
+  using stan::math::fvar_n;
+  Eigen::Matrix<fvar_n<double, 2>, Eigen::Dynamic, 1> v(3);
+  v << fvar_n<double, 2>(1.0, Eigen::Vector2d(1, 0)),
+      fvar_n<double, 2>(2.0, Eigen::Vector2d(0, 1)), 3.0;
+  Eigen::VectorXd w(3);
+  w << 4, 5, 6;
+  fvar_n<double, 2> dot = v.dot(v);
+  EXPECT_FLOAT_EQ(14, dot.val_);
+  EXPECT_FLOAT_EQ(2, dot.d_(0));
+  EXPECT_FLOAT_EQ(4, dot.d_(1));
+  Eigen::Matrix<fvar_n<double, 2>, Eigen::Dynamic, 1> prod
+      = v.cwiseProduct(w.cast<fvar_n<double, 2>>());
+  EXPECT_FLOAT_EQ(10, prod(1).val_);
+  EXPECT_FLOAT_EQ(5, prod(1).d_(1));
+  fvar_n<double, 2> s = v.sum();
+  EXPECT_FLOAT_EQ(6, s.val_);
+  EXPECT_FLOAT_EQ(1, s.d_(0));
+}
+
+TEST(mathFwdCoreFvarN, traits) {
+  using stan::math::fvar_n;
+  using F = fvar_n<double, 2>;
+  using F_vec = Eigen::Matrix<F, Eigen::Dynamic, 1>;
+  EXPECT_TRUE(stan::is_fvar<F>::value);
+  EXPECT_TRUE(stan::is_autodiff<F>::value);
+  EXPECT_TRUE(stan::is_stan_scalar<F>::value);
+  EXPECT_TRUE((std::is_same<F, stan::scalar_type_t<F_vec>>::value));
+  EXPECT_TRUE((std::is_same<double, stan::partials_type_t<F>>::value));
+  EXPECT_TRUE((std::is_same<F, stan::return_type_t<double, F_vec>>::value));
+  EXPECT_TRUE(
+      (std::is_same<F, stan::return_type_t<std::vector<F>, int>>::value));
+}
+
+TEST(mathFwdCoreFvarN, prim_dispatch) {
+  using stan::math::fvar_n;
+  using F = fvar_n<double, 2>;
+  Eigen::Matrix<F, Eigen::Dynamic, 1> v(3);
+  v << F(1.0, Eigen::Vector2d(1, 0)), F(2.0, Eigen::Vector2d(0, 1)), 3.0;
+  Eigen::VectorXd w(3);
+  w << 4, 5, 6;
+
+  // prim overloads selected through is_fvar / value_type_t
+  F self = stan::math::dot_self(v);
+  EXPECT_FLOAT_EQ(14, self.val_);
+  EXPECT_FLOAT_EQ(2, self.d_(0));
+  EXPECT_FLOAT_EQ(4, self.d_(1));
+
+  F dist = stan::math::squared_distance(v, w);
+  EXPECT_FLOAT_EQ(27, dist.val_);
+  EXPECT_FLOAT_EQ(-6, dist.d_(0));
+  EXPECT_FLOAT_EQ(-6, dist.d_(1));
+
+  F dot = stan::math::dot_product(v, w);
+  EXPECT_FLOAT_EQ(32, dot.val_);
+  EXPECT_FLOAT_EQ(4, dot.d_(0));
+  EXPECT_FLOAT_EQ(5, dot.d_(1));
+}
@@ -0,0 +1,116 @@
+#include <stan/math/fwd.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <sstream>
+
+TEST(mathFwdCoreTaylor, ctor) {
+  using stan::math::taylor;
+  taylor<double, 3> a;
+  for (int k = 0; k <= 3; ++k) {
+    EXPECT_FLOAT_EQ(0.0, a.c_[k]);
+  }
+
+  taylor<double, 3> b(1.9);
+  EXPECT_FLOAT_EQ(1.9, b.val());
+  for (int k = 1; k <= 3; ++k) {
+    EXPECT_FLOAT_EQ(0.0, b.c_[k]);
+  }
+
+  taylor<double, 2> c(1.93, -2);
+  EXPECT_FLOAT_EQ(1.93, c.c_[0]);
+  EXPECT_FLOAT_EQ(-2, c.c_[1]);
+  EXPECT_FLOAT_EQ(0, c.c_[2]);
+
+  std::stringstream ss;
+  ss << c;
+  EXPECT_EQ("1.93", ss.str());
+}
+
+// the coefficients of f(x) along x must match the derivatives from
+// fvar<fvar<fvar<double>>> divided by k!
+template <typename F>
+void expect_taylor_matches_fvar(const F& f, double x_val) {
+  using stan::math::fvar;
+  using stan::math::taylor;
+  fvar<fvar<fvar<double>>> x;
+  x.val_.val_.val_ = x_val;
+  x.val_.val_.d_ = 1;
+  x.val_.d_.val_ = 1;
+  x.d_.val_.val_ = 1;
+  fvar<fvar<fvar<double>>> y = f(x);
+  taylor<double, 3> y_taylor = f(taylor<double, 3>(x_val, 1));
+  EXPECT_FLOAT_EQ(y.val_.val_.val_, y_taylor.c_[0]);
+  EXPECT_FLOAT_EQ(y.val_.val_.d_, y_taylor.c_[1]);
+  EXPECT_FLOAT_EQ(y.val_.d_.d_ / 2, y_taylor.c_[2]);
+  EXPECT_FLOAT_EQ(y.d_.d_.d_ / 6, y_taylor.c_[3]);
+
+  taylor<double, 2> y_taylor_2 = f(taylor<double, 2>(x_val, 1));
+  EXPECT_FLOAT_EQ(y_taylor.c_[0], y_taylor_2.c_[0]);
+  EXPECT_FLOAT_EQ(y_taylor.c_[1], y_taylor_2.c_[1]);
+  EXPECT_FLOAT_EQ(y_taylor.c_[2], y_taylor_2.c_[2]);
+}
+
+// applies the function to a cubic, so all coefficients of its argument
+// are nonzero
+#define EXPECT_TAYLOR_UNARY(fun, x_val)                              \
+  expect_taylor_matches_fvar(                                        \
+      [](const auto& x) {                                            \
+        using stan::math::fun;                                       \
+        return fun(0.7 + x * (0.1 + x * (0.3 + 0.05 * x))) / (1 + x); \
+      },                                                             \
+      x_val)
+
+TEST(mathFwdCoreTaylor, functions) {
+  EXPECT_TAYLOR_UNARY(exp, 0.9);
+  EXPECT_TAYLOR_UNARY(log, 0.9);
+  EXPECT_TAYLOR_UNARY(sqrt, 0.9);
+  EXPECT_TAYLOR_UNARY(square, 0.9);
+  EXPECT_TAYLOR_UNARY(inv, 0.9);
+  EXPECT_TAYLOR_UNARY(sin, 0.9);
+  EXPECT_TAYLOR_UNARY(cos, 0.9);
+  EXPECT_TAYLOR_UNARY(tanh, 0.9);
+  EXPECT_TAYLOR_UNARY(log1p, 0.9);
+  EXPECT_TAYLOR_UNARY(expm1, 0.9);
+  EXPECT_TAYLOR_UNARY(inv_logit, -0.4);
+  EXPECT_TAYLOR_UNARY(fabs, -3.1);
+  EXPECT_TAYLOR_UNARY(lgamma, 0.9);
+}
+
+TEST(mathFwdCoreTaylor, operators) {
+  using stan::math::pow;
+  expect_taylor_matches_fvar(
+      [](const auto& x) {
+        auto y = 2.5 - x * x / 3.0 + 1 / (x + 2);
+        y *= x;
+        y /= (x - 5.0);
+        y -= -x;
+        return y;
+      },
+      1.3);
+  expect_taylor_matches_fvar([](const auto& x) { return pow(x, 2.7); }, 1.3);
+  expect_taylor_matches_fvar([](const auto& x) { return pow(x, 3); }, 1.3);
+  expect_taylor_matches_fvar([](const auto& x) { return pow(1.7, x); }, 1.3);
+  expect_taylor_matches_fvar(
+      [](const auto& x) { return pow(x * x + 1, x + 0.5); }, 1.3);
+}
+
+TEST(mathFwdCoreTaylor, powZero) {
+  using stan::math::taylor;
+  taylor<double, 3> y = pow(taylor<double, 3>(0, 1), 3.0);
+  EXPECT_FLOAT_EQ(0, y.c_[0]);
+  EXPECT_FLOAT_EQ(0, y.c_[1]);
+  EXPECT_FLOAT_EQ(0, y.c_[2]);
+  EXPECT_FLOAT_EQ(1, y.c_[3]);
+}
+
+TEST(mathFwdCoreTaylor, comparisons) {
+  using stan::math::taylor;
+  taylor<double, 3> a(1, 5);
+  taylor<double, 3> b(2, -1);
+  EXPECT_TRUE(a < b);
+  EXPECT_TRUE(a <= 1);
+  EXPECT_TRUE(2 > a);
+  EXPECT_TRUE(b >= a);
+  EXPECT_TRUE(a == (taylor<double, 3>(1, 0)));
+  EXPECT_TRUE(a != b);
+}
@@ -26,3 +26,30 @@ TEST(FwdFunctor, gradient) {
   EXPECT_FLOAT_EQ(2 * x(0) * x(1), grad_fx2(0));
   EXPECT_FLOAT_EQ(x(0) * x(0) + 3 * 2 * x(1), grad_fx2(1));
 }
+
+TEST(FwdFunctor, gradient_n) {
+  fun1 f;
+  Matrix<double, Dynamic, 1> x(2);
+  x << 5, 7;
+
+  double fx(0);
+  Matrix<double, Dynamic, 1> grad_fx;
+  stan::math::gradient<double>(f, x, fx, grad_fx);
+
+  double fx_n(0);
+  Matrix<double, Dynamic, 1> grad_fx_n;
+  stan::math::gradient<2>(f, x, fx_n, grad_fx_n);
+  EXPECT_FLOAT_EQ(fx, fx_n);
+  EXPECT_EQ(2, grad_fx_n.size());
+  EXPECT_FLOAT_EQ(grad_fx(0), grad_fx_n(0));
+  EXPECT_FLOAT_EQ(grad_fx(1), grad_fx_n(1));
+
+  // directions that do not fill the last pass
+  stan::math::gradient<3>(f, x, fx_n, grad_fx_n);
+  EXPECT_FLOAT_EQ(fx, fx_n);
+  EXPECT_FLOAT_EQ(grad_fx(0), grad_fx_n(0));
+  EXPECT_FLOAT_EQ(grad_fx(1), grad_fx_n(1));
+  stan::math::gradient<1>(f, x, fx_n, grad_fx_n);
+  EXPECT_FLOAT_EQ(grad_fx(0), grad_fx_n(0));
+  EXPECT_FLOAT_EQ(grad_fx(1), grad_fx_n(1));
+}
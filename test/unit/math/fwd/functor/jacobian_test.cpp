@@ -0,0 +1,84 @@
+#include <stan/math/fwd.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// fun2(x) = (x(i) * x(i + 1), exp(x(i)) / x(n - 1), ...)
+struct fun2 {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    using stan::math::exp;
+    const int n = x.size();
+    Matrix<T, Dynamic, 1> y(2 * n - 1);
+    for (int i = 0; i < n - 1; ++i) {
+      y(i) = x(i) * x(i + 1);
+    }
+    for (int i = 0; i < n; ++i) {
+      y(n - 1 + i) = exp(x(i)) / x(n - 1);
+    }
+    return y;
+  }
+};
+
+TEST(FwdFunctor, jacobian_n) {
+  fun2 f;
+  Matrix<double, Dynamic, 1> x(7);
+  x << 0.5, -1.2, 0.3, 2, 1.1, -0.4, 0.9;
+
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian<double>(f, x, fx, J);
+  EXPECT_EQ(13, J.rows());
+  EXPECT_EQ(7, J.cols());
+
+  Matrix<double, Dynamic, 1> fx_n;
+  Matrix<double, Dynamic, Dynamic> J_n;
+  stan::math::jacobian<4>(f, x, fx_n, J_n);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_n);
+  EXPECT_MATRIX_FLOAT_EQ(J, J_n);
+  stan::math::jacobian<7>(f, x, fx_n, J_n);
+  EXPECT_MATRIX_FLOAT_EQ(J, J_n);
+  stan::math::jacobian<2>(f, x, fx_n, J_n);
+  EXPECT_MATRIX_FLOAT_EQ(J, J_n);
+}
+
+TEST(FwdFunctor, jvp) {
+  fun2 f;
+  Matrix<double, Dynamic, 1> x(7);
+  x << 0.5, -1.2, 0.3, 2, 1.1, -0.4, 0.9;
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian<double>(f, x, fx, J);
+
+  Matrix<double, Dynamic, 1> v(7);
+  v << 1, -2, 0.5, 0, 3, 0.25, -1;
+  Matrix<double, Dynamic, 1> fx_jvp;
+  Matrix<double, Dynamic, 1> Jv;
+  stan::math::jvp(f, x, v, fx_jvp, Jv);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_jvp);
+  Matrix<double, Dynamic, 1> Jv_expected = J * v;
+  EXPECT_MATRIX_FLOAT_EQ(Jv_expected, Jv);
+
+  Matrix<double, Dynamic, Dynamic> V(7, 5);
+  V.setRandom();
+  Matrix<double, Dynamic, Dynamic> JV_expected = J * V;
+  Matrix<double, Dynamic, Dynamic> JV;
+  stan::math::jvp<2>(f, x, V, fx_jvp, JV);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_jvp);
+  EXPECT_MATRIX_FLOAT_EQ(JV_expected, JV);
+  stan::math::jvp<5>(f, x, V, fx_jvp, JV);
+  EXPECT_MATRIX_FLOAT_EQ(JV_expected, JV);
+  stan::math::jvp<8>(f, x, V, fx_jvp, JV);
+  EXPECT_MATRIX_FLOAT_EQ(JV_expected, JV);
+
+  Matrix<double, Dynamic, 1> v_bad(3);
+  EXPECT_THROW(stan::math::jvp(f, x, v_bad, fx_jvp, Jv),
+               std::invalid_argument);
+  Matrix<double, Dynamic, Dynamic> V_bad(3, 2);
+  EXPECT_THROW(stan::math::jvp<2>(f, x, V_bad, fx_jvp, JV),
+               std::invalid_argument);
+}
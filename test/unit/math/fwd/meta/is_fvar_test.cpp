@@ -8,4 +8,6 @@ TEST(MathMetaFwd, is_fvar) {
   EXPECT_TRUE(is_fvar<fvar<double>>::value);
   EXPECT_TRUE(is_fvar<fvar<fvar<double>>>::value);
   EXPECT_TRUE(is_fvar<fvar<fvar<fvar<double>>>>::value);
+  EXPECT_TRUE((is_fvar<stan::math::fvar_n<double, 4>>::value));
+  EXPECT_TRUE((is_fvar<const stan::math::fvar_n<double, 1>&>::value));
 }
@@ -12,4 +12,7 @@ TEST(MathMetaFwd, partials_type) {
   stan::partials_type<fvar<fvar<double> > >::type c(7.0, 1.0);
   EXPECT_EQ(7.0, c.val_);
   EXPECT_EQ(1.0, c.d_);
+  using fvar_n_partials_t
+      = partials_type<stan::math::fvar_n<double, 3>>::type;
+  EXPECT_TRUE((std::is_same<double, fvar_n_partials_t>::value));
 }
@@ -0,0 +1,37 @@
+#include <test/unit/math/test_ad.hpp>
+
+TEST(MathMixMatFun, eigendecomposeSym) {
+  auto sym = [](const auto& y) {
+    // maintain symmetry for finite diffs
+    return stan::math::eval(stan::math::multiply(
+        0.5, stan::math::add(y, y.transpose())));
+  };
+  auto f_values = [&sym](const auto& y) {
+    return std::get<0>(stan::math::eigendecompose_sym(sym(y)));
+  };
+  auto f_vectors = [&sym](const auto& y) {
+    return std::get<1>(stan::math::eigendecompose_sym(sym(y)));
+  };
+
+  Eigen::MatrixXd m00(0, 0);
+  stan::test::expect_ad(f_values, m00);
+  stan::test::expect_ad(f_vectors, m00);
+
+  stan::test::ad_tolerances tols;
+  tols.hessian_hessian_ = 5e-2;
+  tols.hessian_fvar_hessian_ = 5e-2;
+
+  Eigen::MatrixXd a11(1, 1);
+  a11 << 2.3;
+  stan::test::expect_ad(tols, f_values, a11);
+  stan::test::expect_ad(tols, f_vectors, a11);
+  stan::test::expect_ad_matvar(f_values, a11);
+  stan::test::expect_ad_matvar(f_vectors, a11);
+
+  Eigen::MatrixXd a33(3, 3);
+  a33 << 1, 2, 3, 2, 5, 7.9, 3, 7.9, 1.08;
+  stan::test::expect_ad(tols, f_values, a33);
+  stan::test::expect_ad(tols, f_vectors, a33);
+  stan::test::expect_ad_matvar(f_values, a33);
+  stan::test::expect_ad_matvar(f_vectors, a33);
+}
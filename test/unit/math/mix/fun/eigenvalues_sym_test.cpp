@@ -7,6 +7,11 @@ TEST(MathMixMatFun, eigenvaluesSym) {
     auto a = ((y + y.transpose()) * 0.5).eval();
     return stan::math::eigenvalues_sym(a);
   };
+  auto g = [](const auto& y) {
+    auto a = stan::math::eval(stan::math::multiply(
+        0.5, stan::math::add(y, y.transpose())));
+    return stan::math::eigenvalues_sym(a);
+  };
 
   Eigen::MatrixXd m00(0, 0);
   stan::test::expect_ad(f, m00);
@@ -25,6 +30,7 @@ TEST(MathMixMatFun, eigenvaluesSym) {
   Eigen::MatrixXd a33(3, 3);
   a33 << 1, 2, 3, 2, 5, 7.9, 3, 7.9, 1.08;
   stan::test::expect_ad(tols, f, a33);
+  stan::test::expect_ad_matvar(g, a33);
 
   // asymmetric 2 x 2 (asym ignored)
   Eigen::MatrixXd m22(2, 2);
@@ -60,6 +60,7 @@ TEST(MathMixMatFun, matrixExpMultiply) {
   u << -0.96, 0.39, 0.24, 0.74, 0.11, 0.88, -0.92, -0.37, 0.26;
   v << 0.13, 0.56, -0.46, 0.13, -0.11, -0.76, -0.23, -0.01, 0.37;
   stan::test::expect_ad(tols, f, u, v);
+  stan::test::expect_ad_matvar(tols, f, u, v);
 
   // scaled down to size 3 from previous tests to test all args
   // at all orders
@@ -50,6 +50,21 @@ TEST(MathMixMatFun, quadFormSym) {
   stan::test::expect_ad(f, a22, v2);
   stan::test::expect_ad(tols, f, a44, v4);
 
+  auto h = [](const auto& x, const auto& y) {
+    // symmetrize the input matrix
+    auto x_sym = stan::math::eval(
+        stan::math::multiply(0.5, stan::math::add(x, x.transpose())));
+    return stan::math::quad_form_sym(x_sym, y);
+  };
+
+  stan::test::expect_ad_matvar(h, a00, a00);
+  stan::test::expect_ad_matvar(h, a11, b11);
+  stan::test::expect_ad_matvar(tols, h, a22, b22);
+  stan::test::expect_ad_matvar(h, a22, b23);
+  stan::test::expect_ad_matvar(tols, h, a44, b42);
+  stan::test::expect_ad_matvar(h, a22, v2);
+  stan::test::expect_ad_matvar(tols, h, a44, v4);
+
   // asymmetric case should throw
 
   auto g = [](const auto& x, const auto& y) {
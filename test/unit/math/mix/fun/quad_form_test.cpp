@@ -64,3 +64,41 @@ TEST(MathMixMatFun, quadForm) {
   stan::test::expect_ad_matvar(f, a22, v2);
   stan::test::expect_ad_matvar(tols, f, a44, v4);
 }
+
+TEST(MathMixMatFun, quadFormSymmetric) {
+  using stan::test::relative_tolerance;
+  auto f = [](const auto& x, const auto& y) {
+    return stan::math::quad_form(x, y, true);
+  };
+
+  Eigen::MatrixXd a11(1, 1);
+  a11 << 1;
+  Eigen::MatrixXd b11(1, 1);
+  b11 << -2;
+  Eigen::MatrixXd a22(2, 2);
+  a22 << 1, 2, 3, 4;
+  Eigen::MatrixXd b22(2, 2);
+  b22 << -3, -2, -10, 112;
+  Eigen::MatrixXd b23(2, 3);
+  b23 << 1, 2, 3, 4, 5, 6;
+  Eigen::MatrixXd b42(4, 2);
+  b42 << 100, 10, 0, 1, -3, -3, 5, 2;
+  Eigen::MatrixXd a44(4, 4);
+  a44 << 2, 3, 4, 5, 6, 10, 2, 2, 7, 2, 7, 1, 8, 2, 1, 112;
+
+  stan::test::ad_tolerances tols;
+  tols.hessian_hessian_ = 2e-1;
+  tols.hessian_fvar_hessian_ = 2e-1;
+
+  stan::test::expect_ad_matvar(f, a11, b11);
+  stan::test::expect_ad_matvar(tols, f, a22, b22);
+  stan::test::expect_ad_matvar(f, a22, b23);
+  stan::test::expect_ad_matvar(tols, f, a44, b42);
+
+  // the symmetrized result is the average of C and C', not their sum
+  stan::math::var_value<Eigen::MatrixXd> A = a22;
+  stan::math::var_value<Eigen::MatrixXd> B = b23;
+  Eigen::MatrixXd c = b23.transpose() * a22 * b23;
+  EXPECT_MATRIX_NEAR(0.5 * (c + c.transpose()), f(A, B).val(), 1e-10);
+  stan::math::recover_memory();
+}
@@ -42,4 +42,6 @@ TEST(mathMixMatFun, scaleMatrixExpMultiply) {
   Eigen::MatrixXd b33(3, 3);
   b33 << -5, 4, -3, 2, 1, 0, -1, 2, -3;
   stan::test::expect_ad(tols, f, t, a33, b33);
+  stan::test::expect_ad_matvar(tols, f, t, a33, b33);
+  stan::test::expect_ad(tols, f, -0.7, a33, b31);
 }
@@ -1,6 +1,7 @@
 #include <stan/math/mix.hpp>
 #include <gtest/gtest.h>
 #include <test/unit/math/rev/fun/util.hpp>
+#include <test/unit/util.hpp>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
@@ -34,6 +35,21 @@ struct fun2 {
   }
 };
 
+// fun3(x) = sum_i exp(x_i) * x_{i+1}^2 + log(1 + x_0^2) * sin(x_{n-1})
+struct fun3 {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    using std::exp;
+    using std::log1p;
+    using std::sin;
+    T y = log1p(x(0) * x(0)) * sin(x(x.size() - 1));
+    for (int i = 0; i + 1 < x.size(); ++i) {
+      y += exp(x(i)) * x(i + 1) * x(i + 1);
+    }
+    return y;
+  }
+};
+
 struct norm_functor {
   template <typename T>
   inline T operator()(
@@ -108,6 +124,71 @@ TEST(MixFunctor, hessianTimesVector) {
   EXPECT_EQ(2, Hv.size());
   EXPECT_FLOAT_EQ(2 * x(1) * v(0) + 2 * x(0) * v(1), Hv(0));
   EXPECT_FLOAT_EQ(2 * x(0) * v(0) + 6 * v(1), Hv(1));
+
+  Matrix<double, Dynamic, 1> v_bad(3);
+  v_bad << 1, 2, 3;
+  EXPECT_THROW(hessian_times_vector(f, x, v_bad, fx, Hv),
+               std::invalid_argument);
+}
+
+TEST(MixFunctor, hessianTimesVectorBatched) {
+  using stan::math::hessian_times_vector;
+
+  fun3 f;
+  Matrix<double, Dynamic, 1> x(5);
+  x << 0.5, -1.2, 0.3, 2.1, -0.7;
+  Matrix<double, Dynamic, Dynamic> V(5, 3);
+  V << 1, 0, 0.5, -2, 1, 0.25, 0.5, 0, -1, 3, 1, 2, -1, 0, 0.75;
+
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(f, x, fx, grad, H);
+
+  double fx_batched;
+  Matrix<double, Dynamic, Dynamic> HV;
+  hessian_times_vector(f, x, V, fx_batched, HV);
+  EXPECT_FLOAT_EQ(fx, fx_batched);
+  EXPECT_MATRIX_NEAR(H * V, HV, 1e-10);
+
+  Matrix<double, Dynamic, Dynamic> V_empty(5, 0);
+  hessian_times_vector(f, x, V_empty, fx_batched, HV);
+  EXPECT_FLOAT_EQ(fx, fx_batched);
+  EXPECT_EQ(5, HV.rows());
+  EXPECT_EQ(0, HV.cols());
+
+  Matrix<double, Dynamic, Dynamic> V_bad(4, 2);
+  EXPECT_THROW(hessian_times_vector(f, x, V_bad, fx_batched, HV),
+               std::invalid_argument);
+}
+
+TEST(MixFunctor, hessianTimesVectorFwd) {
+  using stan::math::fvar;
+  using stan::math::hessian_times_vector;
+
+  fun3 f;
+  Matrix<double, Dynamic, 1> x(4);
+  x << 0.5, -1.2, 0.3, 2.1;
+  Matrix<double, Dynamic, 1> v(4);
+  v << 1, -2, 0.5, 3;
+  double fx;
+  Matrix<double, Dynamic, 1> Hv;
+  hessian_times_vector(f, x, v, fx, Hv);
+
+  Matrix<fvar<double>, Dynamic, 1> x_fvar(4);
+  Matrix<fvar<double>, Dynamic, 1> v_fvar(4);
+  for (int i = 0; i < 4; ++i) {
+    x_fvar(i) = x(i);
+    v_fvar(i) = v(i);
+  }
+  fvar<double> fx_fvar;
+  Matrix<fvar<double>, Dynamic, 1> Hv_fvar;
+  hessian_times_vector(f, x_fvar, v_fvar, fx_fvar, Hv_fvar);
+  EXPECT_FLOAT_EQ(fx, fx_fvar.val_);
+  ASSERT_EQ(4, Hv_fvar.size());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_FLOAT_EQ(Hv(i), Hv_fvar(i).val_);
+  }
 }
 
 TEST(MixFunctor, jacobian) {
@@ -186,6 +267,43 @@ TEST(MixFunctor, hessian) {
   EXPECT_FLOAT_EQ(2 * 3, H2(1, 1));
 }
 
+template <int K>
+void expect_batched_hessian(const Matrix<double, Dynamic, 1>& x) {
+  fun3 f;
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(f, x, fx, grad, H);
+
+  double fx_batched;
+  Matrix<double, Dynamic, 1> grad_batched;
+  Matrix<double, Dynamic, Dynamic> H_batched;
+  stan::math::hessian<K>(f, x, fx_batched, grad_batched, H_batched);
+
+  EXPECT_FLOAT_EQ(fx, fx_batched);
+  EXPECT_MATRIX_FLOAT_EQ(grad, grad_batched);
+  EXPECT_MATRIX_FLOAT_EQ(H, H_batched);
+  for (int i = 0; i < H_batched.rows(); ++i) {
+    for (int j = 0; j < i; ++j) {
+      EXPECT_EQ(H_batched(i, j), H_batched(j, i));
+    }
+  }
+}
+
+TEST(MixFunctor, hessianBatched) {
+  Matrix<double, Dynamic, 1> x(7);
+  x << 0.5, -1.2, 0.3, 2.1, -0.7, 1.1, 0.2;
+  expect_batched_hessian<1>(x);
+  expect_batched_hessian<3>(x);
+  expect_batched_hessian<4>(x);
+  expect_batched_hessian<7>(x);
+  expect_batched_hessian<8>(x);
+
+  Matrix<double, Dynamic, 1> x1(1);
+  x1 << 0.4;
+  expect_batched_hessian<4>(x1);
+}
+
 TEST(MixFunctor, GradientTraceMatrixTimesHessian) {
   Matrix<double, Dynamic, Dynamic> M(2, 2);
   M << 11, 13, 17, 23;
@@ -278,3 +396,42 @@ TEST(MixFunctor, GradientHessian) {
                         poly_grad_hess_agrad[i](j, k));
       }
 }
+
+TEST(MixFunctor, GradientHessianTaylor) {
+  Matrix<double, Dynamic, 1> poly_eval_vec(3);
+  poly_eval_vec << 1.5, 7.1, 3.1;
+  third_order_mixed mixed_third_poly;
+  double poly_eval;
+  Matrix<double, Dynamic, Dynamic> poly_hess;
+  std::vector<Matrix<double, Dynamic, Dynamic> > poly_grad_hess;
+  stan::math::grad_hessian_taylor(mixed_third_poly, poly_eval_vec, poly_eval,
+                                  poly_hess, poly_grad_hess);
+  EXPECT_FLOAT_EQ(mixed_third_poly(poly_eval_vec), poly_eval);
+  Matrix<double, Dynamic, Dynamic> poly_hess_analytic
+      = third_order_mixed_hess(poly_eval_vec);
+  std::vector<Matrix<double, Dynamic, Dynamic> > poly_grad_hess_analytic
+      = third_order_mixed_grad_hess(poly_eval_vec);
+  EXPECT_MATRIX_FLOAT_EQ(poly_hess_analytic, poly_hess);
+  ASSERT_EQ(3, poly_grad_hess.size());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_MATRIX_NEAR(poly_grad_hess_analytic[i], poly_grad_hess[i], 1e-10);
+  }
+
+  Matrix<double, Dynamic, 1> x(5);
+  x << 0.3, -0.8, 1.2, 0.5, -1.7;
+  fun3 f;
+  double fx;
+  double fx_taylor;
+  Matrix<double, Dynamic, Dynamic> H;
+  Matrix<double, Dynamic, Dynamic> H_taylor;
+  std::vector<Matrix<double, Dynamic, Dynamic> > grad_H;
+  std::vector<Matrix<double, Dynamic, Dynamic> > grad_H_taylor;
+  stan::math::grad_hessian(f, x, fx, H, grad_H);
+  stan::math::grad_hessian_taylor(f, x, fx_taylor, H_taylor, grad_H_taylor);
+  EXPECT_FLOAT_EQ(fx, fx_taylor);
+  EXPECT_MATRIX_NEAR(H, H_taylor, 1e-12);
+  ASSERT_EQ(5, grad_H_taylor.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_MATRIX_NEAR(grad_H[i], grad_H_taylor[i], 1e-12);
+  }
+}
@@ -1,6 +1,7 @@
 #include <stan/math/mix.hpp>
 #include <gtest/gtest.h>
 #include <test/unit/math/rev/fun/util.hpp>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,20 @@ void test_grad_hessian_finite_diff(const std::string& msg, const F& f,
   std::vector<Eigen::MatrixXd> grad_hess_fx;
   stan::math::finite_diff_grad_hessian_auto(f, x, fx, hess_fx, grad_hess_fx);
 
+  double fx_par;
+  Eigen::MatrixXd hess_fx_par;
+  std::vector<Eigen::MatrixXd> grad_hess_fx_par;
+  stan::math::finite_diff_grad_hessian_auto_parallel(f, x, fx_par, hess_fx_par,
+                                                     grad_hess_fx_par);
+  EXPECT_EQ(0, std::memcmp(&fx, &fx_par, sizeof(double))) << msg;
+  ASSERT_EQ(grad_hess_fx.size(), grad_hess_fx_par.size()) << msg;
+  for (size_t i = 0; i < grad_hess_fx.size(); ++i) {
+    ASSERT_EQ(grad_hess_fx[i].size(), grad_hess_fx_par[i].size()) << msg;
+    EXPECT_EQ(0, std::memcmp(grad_hess_fx[i].data(), grad_hess_fx_par[i].data(),
+                             grad_hess_fx[i].size() * sizeof(double)))
+        << msg;
+  }
+
   double fx_ad;
   Eigen::VectorXd grad_fx_ad;
   Eigen::MatrixXd hess_fx_ad;
@@ -1,6 +1,7 @@
 #include <stan/math/mix.hpp>
 #include <test/unit/math/expect_near_rel.hpp>
 #include <gtest/gtest.h>
+#include <cstring>
 #include <vector>
 
 template <typename F>
@@ -9,6 +10,15 @@ void expect_match_autodiff(const F& f, Eigen::VectorXd x) {
   Eigen::VectorXd grad_fx_fd;
   stan::math::finite_diff_gradient_auto(f, x, fx_fd, grad_fx_fd);
 
+  double fx_fd_par;
+  Eigen::VectorXd grad_fx_fd_par;
+  stan::math::finite_diff_gradient_auto_parallel(f, x, fx_fd_par,
+                                                 grad_fx_fd_par);
+  EXPECT_EQ(0, std::memcmp(&fx_fd, &fx_fd_par, sizeof(double)));
+  ASSERT_EQ(grad_fx_fd.size(), grad_fx_fd_par.size());
+  EXPECT_EQ(0, std::memcmp(grad_fx_fd.data(), grad_fx_fd_par.data(),
+                           grad_fx_fd.size() * sizeof(double)));
+
   double fx;
   Eigen::VectorXd grad_fx;
   stan::math::gradient(f, x, fx, grad_fx);
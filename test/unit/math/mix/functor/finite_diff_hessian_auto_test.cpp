@@ -1,6 +1,7 @@
 #include <stan/math/mix.hpp>
 #include <gtest/gtest.h>
 #include <test/unit/math/rev/fun/util.hpp>
+#include <cstring>
 #include <vector>
 
 struct norm_functor {
@@ -56,6 +57,28 @@ TEST(AgradFiniteDiff, gradient) {
   }
 }
 
+TEST(AgradFiniteDiff, gradientParallel) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+
+  norm_functor norm;
+  Matrix<double, Dynamic, 1> x(3);
+  x << 0.5, 0.3, 0.7;
+
+  double fx;
+  Matrix<double, Dynamic, 1> grad_fx;
+  stan::math::finite_diff_gradient(norm, x, fx, grad_fx);
+
+  double fx_par;
+  Matrix<double, Dynamic, 1> grad_fx_par;
+  stan::math::finite_diff_gradient_parallel(norm, x, fx_par, grad_fx_par);
+
+  EXPECT_EQ(0, std::memcmp(&fx, &fx_par, sizeof(double)));
+  ASSERT_EQ(3, grad_fx_par.size());
+  EXPECT_EQ(0, std::memcmp(grad_fx.data(), grad_fx_par.data(),
+                           3 * sizeof(double)));
+}
+
 TEST(AgradFiniteDiff, hessian) {
   using Eigen::Dynamic;
   using Eigen::Matrix;
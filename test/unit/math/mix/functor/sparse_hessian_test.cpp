@@ -0,0 +1,66 @@
+#include <stan/math/mix.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// f(x) = sum_i exp(x_i) * x_{i+1}^2 + x_0 * x_{n-1}
+struct chain_fun {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    using std::exp;
+    T y = x(0) * x(x.size() - 1);
+    for (int i = 0; i + 1 < x.size(); ++i) {
+      y += exp(x(i)) * x(i + 1) * x(i + 1);
+    }
+    return y;
+  }
+};
+
+TEST(MixFunctor, sparse_hessian) {
+  chain_fun f;
+  Matrix<double, Dynamic, 1> x(9);
+  x << 0.5, -1.2, 0.3, 2.1, -0.7, 1.1, 0.2, 1.5, -0.4;
+
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(f, x, fx, grad, H);
+
+  Eigen::SparseMatrix<double> pattern = stan::math::hessian_sparsity(f, x);
+  EXPECT_EQ(9 + 2 * 8 + 2, pattern.nonZeros());
+  std::vector<int> colors = stan::math::column_coloring(pattern);
+  EXPECT_LE(*std::max_element(colors.begin(), colors.end()) + 1, 4);
+
+  double fx_sparse;
+  Matrix<double, Dynamic, 1> grad_sparse;
+  Eigen::SparseMatrix<double> H_sparse;
+  stan::math::sparse_hessian(f, x, pattern, fx_sparse, grad_sparse, H_sparse);
+  EXPECT_FLOAT_EQ(fx, fx_sparse);
+  EXPECT_MATRIX_FLOAT_EQ(grad, grad_sparse);
+  EXPECT_EQ(pattern.nonZeros(), H_sparse.nonZeros());
+  EXPECT_MATRIX_FLOAT_EQ(H, H_sparse.toDense());
+
+  // the pattern can be reused at other arguments
+  x << 1.5, 0.2, -0.3, 0.1, 0.7, -1.1, 0.4, 0.5, 0.9;
+  stan::math::hessian(f, x, fx, grad, H);
+  stan::math::sparse_hessian(f, x, pattern, fx_sparse, grad_sparse, H_sparse);
+  EXPECT_FLOAT_EQ(fx, fx_sparse);
+  EXPECT_MATRIX_FLOAT_EQ(grad, grad_sparse);
+  EXPECT_MATRIX_FLOAT_EQ(H, H_sparse.toDense());
+}
+
+TEST(MixFunctor, sparse_hessian_pattern_size) {
+  chain_fun f;
+  Matrix<double, Dynamic, 1> x = Matrix<double, Dynamic, 1>::Ones(4);
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Eigen::SparseMatrix<double> H;
+  Eigen::SparseMatrix<double> pattern(4, 3);
+  EXPECT_THROW(stan::math::sparse_hessian(f, x, pattern, fx, grad, H),
+               std::invalid_argument);
+}
@@ -0,0 +1,126 @@
+#ifdef STAN_OPENCL
+#include <stan/math/opencl/rev.hpp>
+#include <stan/math.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(opencl_buffer_pool, size_class) {
+  using stan::math::opencl_buffer_pool;
+  EXPECT_EQ(opencl_buffer_pool::size_class(0), 256);
+  EXPECT_EQ(opencl_buffer_pool::size_class(1), 256);
+  EXPECT_EQ(opencl_buffer_pool::size_class(256), 256);
+  EXPECT_EQ(opencl_buffer_pool::size_class(257), 320);
+  EXPECT_EQ(opencl_buffer_pool::size_class(512), 512);
+  EXPECT_EQ(opencl_buffer_pool::size_class(513), 640);
+  EXPECT_EQ(opencl_buffer_pool::size_class(1000), 1024);
+  for (std::size_t bytes = 1; bytes < 100000; bytes += 37) {
+    std::size_t rounded = opencl_buffer_pool::size_class(bytes);
+    EXPECT_GE(rounded, bytes);
+    EXPECT_LE(rounded, std::max<std::size_t>(256, bytes * 5 / 4 + 1));
+    EXPECT_EQ(opencl_buffer_pool::size_class(rounded), rounded);
+  }
+}
+
+TEST(opencl_buffer_pool, matrix_cl_reuses_buffers) {
+  using stan::math::matrix_cl;
+  auto& pool = stan::math::opencl_context.buffer_pool();
+  pool.clear();
+  pool.reset_statistics();
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(30, 40);
+  { matrix_cl<double> a_cl(a); }
+  auto stats = pool.statistics();
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.buffers_held, 1);
+  EXPECT_EQ(stats.bytes_held,
+            stan::math::opencl_buffer_pool::size_class(sizeof(double) * 1200));
+  {
+    matrix_cl<double> b_cl(a);
+    Eigen::MatrixXd b = stan::math::from_matrix_cl(b_cl);
+    EXPECT_MATRIX_EQ(a, b);
+  }
+  stats = pool.statistics();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.buffers_held, 1);
+  EXPECT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+  pool.clear();
+  EXPECT_EQ(pool.statistics().buffers_held, 0);
+  EXPECT_EQ(pool.statistics().bytes_held, 0);
+}
+
+TEST(opencl_buffer_pool, shared_buffers_are_not_pooled) {
+  using stan::math::matrix_cl;
+  auto& pool = stan::math::opencl_context.buffer_pool();
+  pool.clear();
+  cl::Buffer buffer(stan::math::opencl_context.context(), CL_MEM_READ_WRITE,
+                    sizeof(double) * 32);
+  { matrix_cl<double> a_cl(buffer, 4, 8); }
+  EXPECT_EQ(pool.statistics().buffers_held, 0);
+}
+
+TEST(opencl_buffer_pool, shared_pool_buffers_return_after_last_owner) {
+  using stan::math::matrix_cl;
+  auto& pool = stan::math::opencl_context.buffer_pool();
+  pool.clear();
+  {
+    matrix_cl<double> a_cl(4, 8);
+    {
+      matrix_cl<double> b_cl(a_cl.buffer(), 4, 8);
+      matrix_cl<double> c_cl(a_cl.buffer(), 8, 4);
+    }
+    EXPECT_EQ(pool.statistics().buffers_held, 0);
+  }
+  EXPECT_EQ(pool.statistics().buffers_held, 1);
+  {
+    matrix_cl<double> b_cl(1, 1);
+    {
+      matrix_cl<double> a_cl(4, 8);
+      b_cl = matrix_cl<double>(a_cl.buffer(), 4, 8);
+    }
+    EXPECT_EQ(pool.statistics().buffers_held, 1);
+  }
+  EXPECT_EQ(pool.statistics().buffers_held, 2);
+  pool.clear();
+}
+
+TEST(opencl_buffer_pool, max_bytes_held) {
+  using stan::math::matrix_cl;
+  auto& pool = stan::math::opencl_context.buffer_pool();
+  pool.clear();
+  pool.set_max_bytes_held(0);
+  { matrix_cl<double> a_cl(10, 10); }
+  EXPECT_EQ(pool.statistics().buffers_held, 0);
+  pool.set_max_bytes_held(std::numeric_limits<std::size_t>::max());
+}
+
+TEST(opencl_buffer_pool, steady_state_gradients_do_not_allocate) {
+  using stan::math::matrix_cl;
+  using stan::math::var_value;
+  auto& pool = stan::math::opencl_context.buffer_pool();
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(50, 50);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(50, 50);
+  Eigen::MatrixXd adj_first;
+  for (int i = 0; i < 3; i++) {
+    if (i == 1) {
+      pool.reset_statistics();
+    }
+    var_value<matrix_cl<double>> a_cl = stan::math::to_matrix_cl(a);
+    var_value<matrix_cl<double>> b_cl = stan::math::to_matrix_cl(b);
+    stan::math::var res = stan::math::sum(
+        stan::math::exp(stan::math::elt_multiply(a_cl, b_cl)));
+    res.grad();
+    Eigen::MatrixXd adj = stan::math::from_matrix_cl(a_cl.adj());
+    if (i == 0) {
+      adj_first = adj;
+    } else {
+      EXPECT_MATRIX_EQ(adj_first, adj);
+    }
+    stan::math::recover_memory();
+  }
+  EXPECT_EQ(pool.statistics().misses, 0);
+  EXPECT_GT(pool.statistics().hits, 0);
+}
+
+#endif
@@ -41,16 +41,16 @@ TEST(KernelGenerator, kernel_caching) {
   EXPECT_EQ(cache::kernel_cache_.size(), cache_size);
   matrix_cl<double> res_cl = tmp;
   EXPECT_EQ(cache::kernel_cache_.size(), cache_size + 1);
-  cl_kernel cached_kernel = cache::kernel_cache_.at(uid)();
+  cl_kernel cached_kernel = cache::kernel_cache_.at(uid)[0]();
   EXPECT_NE(cached_kernel, nullptr);
 
   auto tmp2 = m1_cl + 0.1234 * m2_cl;
   matrix_cl<double> res2_cl = tmp2;
-  EXPECT_EQ(cache::kernel_cache_.at(uid)(), cached_kernel);
+  EXPECT_EQ(cache::kernel_cache_.at(uid)[0](), cached_kernel);
   EXPECT_EQ(cache::kernel_cache_.size(), cache_size + 1);
 
   matrix_cl<double> res3_cl = res_cl + 0.1234 * res2_cl;
-  EXPECT_EQ(cache::kernel_cache_.at(uid)(), cached_kernel);
+  EXPECT_EQ(cache::kernel_cache_.at(uid)[0](), cached_kernel);
   EXPECT_EQ(cache::kernel_cache_.size(), cache_size + 1);
 
   EXPECT_EQ(unused_cache::kernel_cache_.size(), unused_cache_size);
@@ -0,0 +1,130 @@
+#ifdef STAN_OPENCL
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+#include <type_traits>
+
+class OpenCLOffload : public ::testing::Test {
+ public:
+  void SetUp() { saved_ = stan::math::opencl_context.tuning_opts(); }
+  void TearDown() { stan::math::opencl_context.tuning_opts() = saved_; }
+
+  void host_only() {
+    auto& opts = stan::math::opencl_context.tuning_opts();
+    opts.multiply_dim_prod_worth_transfer = std::numeric_limits<int>::max();
+    opts.cholesky_size_worth_transfer = std::numeric_limits<int>::max();
+    opts.tri_inverse_size_worth_transfer = std::numeric_limits<int>::max();
+  }
+
+  void device_only() {
+    auto& opts = stan::math::opencl_context.tuning_opts();
+    opts.multiply_dim_prod_worth_transfer = 0;
+    opts.cholesky_size_worth_transfer = 0;
+    opts.tri_inverse_size_worth_transfer = 0;
+  }
+
+ private:
+  std::decay_t<decltype(stan::math::opencl_context.tuning_opts())> saved_;
+};
+
+TEST_F(OpenCLOffload, default_crossovers) {
+  std::decay_t<decltype(stan::math::opencl_context.tuning_opts())> defaults;
+  stan::math::opencl_context.tuning_opts() = defaults;
+  EXPECT_EQ(defaults.multiply_dim_prod_worth_transfer, 2000000);
+  EXPECT_EQ(defaults.cholesky_size_worth_transfer, 1250);
+  EXPECT_EQ(defaults.tri_inverse_size_worth_transfer, 100);
+  EXPECT_FALSE(stan::math::opencl_offload_multiply(100, 100, 200));
+  EXPECT_TRUE(stan::math::opencl_offload_multiply(100, 100, 201));
+  EXPECT_FALSE(stan::math::opencl_offload_tri_inverse(100));
+  EXPECT_TRUE(stan::math::opencl_offload_tri_inverse(101));
+}
+
+TEST_F(OpenCLOffload, predicates) {
+  auto& opts = stan::math::opencl_context.tuning_opts();
+  opts.multiply_dim_prod_worth_transfer = 1000;
+  EXPECT_FALSE(stan::math::opencl_offload_multiply(10, 10, 10));
+  EXPECT_TRUE(stan::math::opencl_offload_multiply(10, 10, 11));
+  // does not overflow
+  EXPECT_TRUE(stan::math::opencl_offload_multiply(100000, 100000, 100000));
+  opts.cholesky_size_worth_transfer = 100;
+  EXPECT_FALSE(stan::math::opencl_offload_cholesky_decompose(100));
+  EXPECT_TRUE(stan::math::opencl_offload_cholesky_decompose(101));
+  opts.tri_inverse_size_worth_transfer = 100;
+  EXPECT_FALSE(stan::math::opencl_offload_tri_inverse(100));
+  EXPECT_TRUE(stan::math::opencl_offload_tri_inverse(101));
+}
+
+TEST_F(OpenCLOffload, multiply) {
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(37, 23);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(23, 41);
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> b_row
+      = b;
+  host_only();
+  Eigen::MatrixXd res_host = stan::math::multiply(a, b);
+  device_only();
+  Eigen::MatrixXd res_device = stan::math::multiply(a, b);
+  EXPECT_MATRIX_NEAR(res_host, res_device, 1e-12);
+  Eigen::MatrixXd res_device_row = stan::math::multiply(a, b_row);
+  EXPECT_MATRIX_NEAR(res_host, res_device_row, 1e-12);
+  Eigen::MatrixXd res_device_expr = stan::math::multiply(a, b * 2.0);
+  EXPECT_MATRIX_NEAR(res_host * 2.0, res_device_expr, 1e-12);
+  Eigen::MatrixXi ai = Eigen::MatrixXi::Ones(3, 3);
+  Eigen::MatrixXi res_int = stan::math::multiply(ai, ai);
+  EXPECT_MATRIX_EQ(res_int, Eigen::MatrixXi::Constant(3, 3, 3));
+  // products of doubles are evaluated, as they might be computed on the
+  // device, other products stay expressions
+  EXPECT_TRUE((std::is_same<decltype(stan::math::multiply(a, b)),
+                            Eigen::MatrixXd>::value));
+  EXPECT_TRUE((std::is_same<decltype(stan::math::multiply(a.row(0), b)),
+                            Eigen::RowVectorXd>::value));
+  EXPECT_FALSE((std::is_same<decltype(stan::math::multiply(ai, ai)),
+                             Eigen::MatrixXi>::value));
+  EXPECT_THROW(stan::math::multiply(a, a), std::invalid_argument);
+}
+
+TEST_F(OpenCLOffload, cholesky_decompose) {
+  Eigen::MatrixXd r = Eigen::MatrixXd::Random(53, 53);
+  Eigen::MatrixXd a = r * r.transpose();
+  a.diagonal().array() += 1.0;
+  host_only();
+  Eigen::MatrixXd res_host = stan::math::cholesky_decompose(a);
+  device_only();
+  Eigen::MatrixXd res_device = stan::math::cholesky_decompose(a);
+  EXPECT_MATRIX_NEAR(res_host, res_device, 1e-8);
+  Eigen::MatrixXd not_pd = -a;
+  EXPECT_THROW(stan::math::cholesky_decompose(not_pd), std::domain_error);
+}
+
+TEST_F(OpenCLOffload, mdivide_left_tri_low) {
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(45, 45);
+  a.diagonal().array() += 100.0;
+  Eigen::MatrixXd lower = a.triangularView<Eigen::Lower>();
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(45, 7);
+  host_only();
+  Eigen::MatrixXd res_host = stan::math::mdivide_left_tri_low(a, b);
+  Eigen::MatrixXd inv_host = stan::math::mdivide_left_tri_low(a);
+  device_only();
+  Eigen::MatrixXd res_device = stan::math::mdivide_left_tri_low(a, b);
+  Eigen::MatrixXd inv_device = stan::math::mdivide_left_tri_low(a);
+  EXPECT_MATRIX_NEAR(res_host, res_device, 1e-10);
+  EXPECT_MATRIX_NEAR(inv_host, inv_device, 1e-10);
+  EXPECT_MATRIX_NEAR(lower * res_device, b, 1e-10);
+  // upper triangular systems stay on the host
+  Eigen::MatrixXd res_upper
+      = stan::math::mdivide_left_tri<Eigen::Upper>(a, b);
+  EXPECT_MATRIX_NEAR(
+      Eigen::MatrixXd(a.triangularView<Eigen::Upper>()) * res_upper, b, 1e-10);
+}
+
+TEST_F(OpenCLOffload, calibrate) {
+  stan::math::opencl_calibrate_offload(64, 1);
+  auto& opts = stan::math::opencl_context.tuning_opts();
+  EXPECT_GE(opts.multiply_dim_prod_worth_transfer, 0);
+  EXPECT_GE(opts.cholesky_size_worth_transfer, 0);
+  EXPECT_GE(opts.tri_inverse_size_worth_transfer, 0);
+  EXPECT_THROW(stan::math::opencl_calibrate_offload(0), std::domain_error);
+  EXPECT_THROW(stan::math::opencl_calibrate_offload(64, 0), std::domain_error);
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifdef STAN_OPENCL
+#include <stan/math.hpp>
+#include <test/unit/math/opencl/util.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+auto fma_functor = [](const auto& a, const auto& b, const auto& c) {
+  return stan::math::fma(a, b, c);
+};
+
+TEST(OpenCLMatrix_fma, prim_rev_values_small) {
+  int N = 2;
+  int M = 3;
+
+  Eigen::MatrixXd a(N, M);
+  a << 1, 2, 3, 4, 5, 6;
+  Eigen::MatrixXd b(N, M);
+  b << 12, 1, 10, -3, 4, 88;
+  Eigen::MatrixXd c(N, M);
+  c << -1, 0.5, 2, 7, -4, 0.1;
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, a, b, c);
+}
+
+TEST(OpenCLMatrix_fma, prim_rev_size_0) {
+  int N = 0;
+  int M = 3;
+
+  Eigen::MatrixXd a(N, M);
+  Eigen::MatrixXd b(N, M);
+  Eigen::MatrixXd c(N, M);
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, a, b, c);
+}
+
+TEST(OpenCLMatrix_fma, prim_rev_values_large) {
+  int N = 71;
+  int M = 83;
+
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(N, M);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(N, M);
+  Eigen::MatrixXd c = Eigen::MatrixXd::Random(N, M);
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, a, b, c);
+}
+
+TEST(OpenCLMatrix_fma, prim_rev_scalar_values_large) {
+  int N = 71;
+  int M = 83;
+
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(N, M);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(N, M);
+  double c = 0.3;
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, a, b, c);
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, a, c, b);
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, c, a, b);
+  stan::math::test::compare_cpu_opencl_prim_rev(fma_functor, c, c, a);
+}
+
+TEST(OpenCLMatrix_fma, prim_rev_size_mismatch) {
+  using stan::math::matrix_cl;
+  using stan::math::var_value;
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(2, 3);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(3, 2);
+  matrix_cl<double> a_cl(a);
+  matrix_cl<double> b_cl(b);
+  var_value<matrix_cl<double>> a_var(a_cl);
+  EXPECT_THROW(stan::math::fma(a_var, b_cl, a_cl), std::invalid_argument);
+  EXPECT_THROW(stan::math::fma(a_var, a_cl, b_cl), std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+#endif
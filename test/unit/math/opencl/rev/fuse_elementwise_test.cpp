@@ -0,0 +1,163 @@
+#ifdef STAN_OPENCL
+#include <stan/math.hpp>
+#include <test/unit/math/opencl/util.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+auto exp_fma_elementwise = [](const auto& a, const auto& b, const auto& c) {
+  return exp(elt_multiply(a, b) + c);
+};
+
+auto exp_fma_cpu = [](const auto& a, const auto& b, const auto& c) {
+  return stan::math::exp(
+      stan::math::add(stan::math::elt_multiply(a, b), c));
+};
+
+auto exp_fma_cl = [](const auto& a, const auto& b, const auto& c) {
+  return stan::math::fuse_elementwise(exp_fma_elementwise, a, b, c);
+};
+
+TEST(OpenCLFuseElementwise, prim_rev_values_small) {
+  Eigen::MatrixXd a(2, 3);
+  a << 1, 2, 3, 4, 5, 6;
+  Eigen::MatrixXd b(2, 3);
+  b << 0.5, 0.1, -0.4, -0.3, 0.4, 0.2;
+  Eigen::MatrixXd c(2, 3);
+  c << -1, 0.5, 2, 0.7, -4, 0.1;
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(exp_fma_cpu,
+                                                         exp_fma_cl, a, b, c);
+}
+
+TEST(OpenCLFuseElementwise, prim_rev_size_0) {
+  Eigen::MatrixXd a(0, 3);
+  Eigen::MatrixXd b(0, 3);
+  Eigen::MatrixXd c(0, 3);
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(exp_fma_cpu,
+                                                         exp_fma_cl, a, b, c);
+}
+
+TEST(OpenCLFuseElementwise, prim_rev_values_large) {
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(71, 83);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(71, 83);
+  Eigen::MatrixXd c = Eigen::MatrixXd::Random(71, 83);
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(exp_fma_cpu,
+                                                         exp_fma_cl, a, b, c);
+}
+
+TEST(OpenCLFuseElementwise, prim_rev_scalar_values) {
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(7, 3);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(7, 3);
+  double c = 0.3;
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(exp_fma_cpu,
+                                                         exp_fma_cl, a, b, c);
+}
+
+auto functions_elementwise = [](const auto& a, const auto& b) {
+  return tanh(a) + inv_logit(b) - log_inv_logit(a) + lgamma(b) + sqrt(b)
+         + expm1(a) - cos(b) + log1p_exp(a) + 2.0 * log(b)
+         + elt_divide(sin(a), log1p(b)) - elt_multiply(a, -b);
+};
+
+TEST(OpenCLFuseElementwise, prim_rev_functions) {
+  auto functions_cpu = [](const auto& a, const auto& b) {
+    using stan::math::add;
+    using stan::math::elt_divide;
+    using stan::math::elt_multiply;
+    using stan::math::multiply;
+    using stan::math::subtract;
+    auto r1 = subtract(add(stan::math::tanh(a), stan::math::inv_logit(b)),
+                       stan::math::log_inv_logit(a));
+    auto r2 = add(add(stan::math::lgamma(b), stan::math::sqrt(b)),
+                  stan::math::expm1(a));
+    auto r3 = add(subtract(r2, stan::math::cos(b)), stan::math::log1p_exp(a));
+    auto r4 = add(add(r1, r3), multiply(2.0, stan::math::log(b)));
+    return subtract(
+        add(r4, elt_divide(stan::math::sin(a), stan::math::log1p(b))),
+        elt_multiply(a, stan::math::minus(b)));
+  };
+  auto functions_cl = [](const auto& a, const auto& b) {
+    return stan::math::fuse_elementwise(functions_elementwise, a, b);
+  };
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(9, 4);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(9, 4).array() + 1.5;
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(functions_cpu,
+                                                         functions_cl, a, b);
+}
+
+auto scalar_multiply_elementwise = [](const auto& a, const auto& b,
+                                      const auto& c) {
+  return 2.0 * a * c + c * exp(b) * 0.5;
+};
+
+TEST(OpenCLFuseElementwise, prim_rev_scalar_multiply) {
+  auto scalar_multiply_cpu = [](const auto& a, const auto& b, const auto& c) {
+    using stan::math::multiply;
+    return stan::math::add(multiply(multiply(2.0, a), c),
+                           multiply(multiply(c, stan::math::exp(b)), 0.5));
+  };
+  auto scalar_multiply_cl = [](const auto& a, const auto& b, const auto& c) {
+    return stan::math::fuse_elementwise(scalar_multiply_elementwise, a, b, c);
+  };
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(6, 5);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(6, 5);
+  double c = -1.3;
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(
+      scalar_multiply_cpu, scalar_multiply_cl, a, b, c);
+}
+
+template <typename T_a, typename T_b, typename = void>
+struct has_operator_multiply : std::false_type {};
+template <typename T_a, typename T_b>
+struct has_operator_multiply<
+    T_a, T_b,
+    stan::void_t<decltype(std::declval<T_a>() * std::declval<T_b>())>>
+    : std::true_type {};
+
+TEST(OpenCLFuseElementwise, matrix_product_not_defined_on_duals) {
+  // on matrix_cl, * is the matrix product, so it is not defined for two
+  // matrix duals, which only have elementwise derivatives
+  using stan::math::matrix_cl;
+  using stan::math::internal::elt_dual::make_elt_dual;
+  using stan::math::internal::elt_dual::zero_tangent_cl;
+  using matrix_dual = decltype(make_elt_dual(
+      stan::math::as_operation_cl(std::declval<const matrix_cl<double>&>()),
+      zero_tangent_cl{}));
+  using scalar_dual = decltype(
+      make_elt_dual(stan::math::as_operation_cl(1.0), zero_tangent_cl{}));
+  EXPECT_FALSE((has_operator_multiply<matrix_dual, matrix_dual>::value));
+  EXPECT_FALSE(
+      (has_operator_multiply<matrix_dual, const matrix_cl<double>&>::value));
+  EXPECT_TRUE((has_operator_multiply<matrix_dual, scalar_dual>::value));
+  EXPECT_TRUE((has_operator_multiply<scalar_dual, matrix_dual>::value));
+  EXPECT_TRUE((has_operator_multiply<matrix_dual, double>::value));
+  EXPECT_TRUE((has_operator_multiply<double, matrix_dual>::value));
+}
+
+TEST(OpenCLFuseElementwise, prim_rev_unused_argument) {
+  // the product with 0 only gives the CPU result the scalar type of b
+  auto unused_cpu = [](const auto& a, const auto& b) {
+    return stan::math::add(stan::math::exp(a), stan::math::multiply(0.0, b));
+  };
+  auto unused_cl = [](const auto& a, const auto& b) {
+    return stan::math::fuse_elementwise(
+        [](const auto& x, const auto& y) { return exp(x); }, a, b);
+  };
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(5, 2);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(5, 2);
+  stan::math::test::compare_cpu_opencl_prim_rev_separate(unused_cpu,
+                                                         unused_cl, a, b);
+}
+
+TEST(OpenCLFuseElementwise, prim_rev_size_mismatch) {
+  using stan::math::matrix_cl;
+  using stan::math::var_value;
+  matrix_cl<double> a_cl(Eigen::MatrixXd::Random(2, 3));
+  matrix_cl<double> b_cl(Eigen::MatrixXd::Random(3, 2));
+  var_value<matrix_cl<double>> a_var(a_cl);
+  EXPECT_THROW(
+      stan::math::fuse_elementwise(exp_fma_elementwise, a_var, b_cl, a_cl),
+      std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+#endif
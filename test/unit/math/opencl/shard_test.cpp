@@ -0,0 +1,117 @@
+#ifdef STAN_OPENCL
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+class OpenCLShard : public ::testing::Test {
+ public:
+  void SetUp() { saved_ = stan::math::opencl_context.tuning_opts(); }
+  void TearDown() {
+    // back to the single test device if a test selected several
+    if (stan::math::opencl_context.num_devices() > 1) {
+      stan::math::opencl_context.select_device(OPENCL_PLATFORM_ID,
+                                               OPENCL_DEVICE_ID);
+    }
+    stan::math::opencl_context.tuning_opts() = saved_;
+  }
+
+ private:
+  std::decay_t<decltype(stan::math::opencl_context.tuning_opts())> saved_;
+};
+
+TEST_F(OpenCLShard, device_scope) {
+  using stan::math::opencl_context;
+  using stan::math::opencl_device_scope;
+  EXPECT_EQ(opencl_context.active_device(), 0);
+  {
+    opencl_device_scope scope(opencl_context.num_devices() - 1);
+    EXPECT_EQ(opencl_context.active_device(), opencl_context.num_devices() - 1);
+  }
+  EXPECT_EQ(opencl_context.active_device(), 0);
+  EXPECT_THROW(opencl_device_scope(-1), std::domain_error);
+  EXPECT_THROW(opencl_device_scope(opencl_context.num_devices()),
+               std::domain_error);
+  EXPECT_EQ(opencl_context.active_device(), 0);
+}
+
+TEST_F(OpenCLShard, row_shards) {
+  for (int rows : {0, 1, 7, 1000}) {
+    auto shards = stan::math::internal::opencl_row_shards(rows);
+    int next = 0;
+    for (const auto& shard : shards) {
+      EXPECT_EQ(shard.start, next);
+      EXPECT_GT(shard.rows, 0);
+      EXPECT_LT(shard.device, stan::math::opencl_context.num_devices());
+      next += shard.rows;
+    }
+    EXPECT_EQ(next, rows);
+  }
+}
+
+TEST_F(OpenCLShard, multiply) {
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(37, 23);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(23, 41);
+  Eigen::MatrixXd res
+      = stan::math::internal::opencl_sharded_multiply<Eigen::MatrixXd>(a, b);
+  EXPECT_MATRIX_NEAR(res, a * b, 1e-12);
+  Eigen::RowVectorXd row
+      = stan::math::internal::opencl_sharded_multiply<Eigen::RowVectorXd>(
+          a.row(3), b);
+  EXPECT_MATRIX_NEAR(row, a.row(3) * b, 1e-12);
+}
+
+TEST_F(OpenCLShard, compute_units) {
+  using stan::math::opencl_context;
+  EXPECT_EQ(opencl_context.compute_units().size(),
+            opencl_context.num_devices());
+  for (int i = 0; i < opencl_context.num_devices(); i++) {
+    cl::Device& device = opencl_context.devices()[i];
+    EXPECT_EQ(opencl_context.compute_units()[i],
+              device.getInfo<CL_DEVICE_MAX_COMPUTE_UNITS>());
+  }
+}
+
+TEST_F(OpenCLShard, multiply_sub_devices) {
+  // splits the test device in two, so the sharded multiply runs on two
+  // devices (for example with PoCL on a CPU)
+  using stan::math::opencl_context;
+  cl::Device device = opencl_context.device()[0];
+  std::vector<cl_device_partition_property> partitions
+      = device.getInfo<CL_DEVICE_PARTITION_PROPERTIES>();
+  const int compute_units = device.getInfo<CL_DEVICE_MAX_COMPUTE_UNITS>();
+  if (std::find(partitions.begin(), partitions.end(),
+                CL_DEVICE_PARTITION_EQUALLY)
+          == partitions.end()
+      || compute_units < 2) {
+    GTEST_SKIP() << "the OpenCL device can not be partitioned";
+  }
+  const cl_device_partition_property properties[]
+      = {CL_DEVICE_PARTITION_EQUALLY,
+         static_cast<cl_device_partition_property>(compute_units / 2), 0};
+  std::vector<cl::Device> sub_devices;
+  device.createSubDevices(properties, &sub_devices);
+  sub_devices.resize(2);
+  opencl_context.select_devices(OPENCL_PLATFORM_ID, sub_devices);
+  EXPECT_EQ(opencl_context.num_devices(), 2);
+
+  auto shards = stan::math::internal::opencl_row_shards(100);
+  ASSERT_EQ(shards.size(), 2);
+  EXPECT_EQ(shards[0].device, 0);
+  EXPECT_EQ(shards[1].device, 1);
+  EXPECT_EQ(shards[0].rows + shards[1].rows, 100);
+
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(37, 23);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(23, 41);
+  Eigen::MatrixXd res
+      = stan::math::internal::opencl_sharded_multiply<Eigen::MatrixXd>(a, b);
+  EXPECT_MATRIX_NEAR(res, a * b, 1e-12);
+  opencl_context.tuning_opts().multiply_dim_prod_worth_transfer = 0;
+  Eigen::MatrixXd res_offload = stan::math::multiply(a, b);
+  EXPECT_MATRIX_NEAR(res_offload, a * b, 1e-12);
+}
+
+#endif
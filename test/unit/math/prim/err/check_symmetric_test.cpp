@@ -64,3 +64,21 @@ TEST(ErrorHandlingMatrix, checkSymmetric_non_square) {
   EXPECT_THROW(stan::math::check_symmetric("checkSymmetric", "y", y),
                std::invalid_argument);
 }
+
+TEST(ErrorHandlingMatrix, checkSymmetric_sparse) {
+  Eigen::MatrixXd y(3, 3);
+  y << 2, 0, 1, 0, 2, 0, 1, 0, 2;
+  Eigen::SparseMatrix<double> y_sparse = y.sparseView();
+  EXPECT_NO_THROW(
+      stan::math::check_symmetric("checkSymmetric", "y", y_sparse));
+
+  y(0, 1) = 0.5;
+  y_sparse = y.sparseView();
+  EXPECT_THROW(stan::math::check_symmetric("checkSymmetric", "y", y_sparse),
+               std::domain_error);
+
+  Eigen::SparseMatrix<double> not_square(2, 3);
+  EXPECT_THROW(
+      stan::math::check_symmetric("checkSymmetric", "y", not_square),
+      std::invalid_argument);
+}
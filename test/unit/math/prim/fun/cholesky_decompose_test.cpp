@@ -35,3 +35,23 @@ TEST(MathMatrixPrimMat, cholesky_decompose_exception) {
   EXPECT_THROW_MSG(stan::math::cholesky_decompose(m), std::domain_error,
                    "is not symmetric");
 }
+
+TEST(MathMatrixPrimMat, cholesky_decompose_tiled) {
+  const int N = 70;
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd m = X * X.transpose();
+  m.diagonal().array() += N;
+  Eigen::MatrixXd L_llt = m.llt().matrixL();
+
+  auto& opts = stan::math::cholesky_tuning_opts();
+  const stan::math::cholesky_tuning_struct defaults = opts;
+  opts.tile_size = 16;
+  opts.min_rows = 40;
+  Eigen::MatrixXd L = stan::math::cholesky_decompose(m);
+  EXPECT_MATRIX_NEAR(L_llt, L, 1e-10);
+
+  m(N - 1, N - 1) = -1.0;
+  EXPECT_THROW_MSG(stan::math::cholesky_decompose(m), std::domain_error,
+                   "Matrix m is not positive definite");
+  opts = defaults;
+}
@@ -0,0 +1,70 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+void expect_structurally_orthogonal(const Eigen::MatrixXd& m,
+                                    const std::vector<int>& colors) {
+  ASSERT_EQ(m.cols(), colors.size());
+  for (int i = 0; i < m.rows(); ++i) {
+    for (int j = 0; j < m.cols(); ++j) {
+      for (int k = j + 1; k < m.cols(); ++k) {
+        if (m(i, j) != 0 && m(i, k) != 0) {
+          EXPECT_NE(colors[j], colors[k]);
+        }
+      }
+    }
+  }
+}
+
+TEST(MathFunctions, column_coloring_tridiagonal) {
+  Eigen::MatrixXd m = Eigen::MatrixXd::Zero(7, 7);
+  for (int i = 0; i < 7; ++i) {
+    m(i, i) = 1;
+    if (i > 0) {
+      m(i, i - 1) = 1;
+      m(i - 1, i) = 1;
+    }
+  }
+  Eigen::SparseMatrix<double> pattern = m.sparseView();
+  std::vector<int> colors = stan::math::column_coloring(pattern);
+  expect_structurally_orthogonal(m, colors);
+  EXPECT_EQ(3, *std::max_element(colors.begin(), colors.end()) + 1);
+}
+
+TEST(MathFunctions, column_coloring_diagonal_and_dense) {
+  Eigen::SparseMatrix<double> diagonal
+      = Eigen::MatrixXd::Identity(5, 5).sparseView();
+  std::vector<int> colors = stan::math::column_coloring(diagonal);
+  EXPECT_EQ(std::vector<int>(5, 0), colors);
+
+  Eigen::MatrixXd dense = Eigen::MatrixXd::Ones(3, 4);
+  Eigen::SparseMatrix<double> dense_pattern = dense.sparseView();
+  colors = stan::math::column_coloring(dense_pattern);
+  EXPECT_EQ(std::vector<int>({0, 1, 2, 3}), colors);
+}
+
+TEST(MathFunctions, column_coloring_arrow) {
+  // every column shares the last row, which has no other entries
+  Eigen::MatrixXd m = Eigen::MatrixXd::Identity(6, 6);
+  m.row(5).setOnes();
+  m.col(5).setOnes();
+  Eigen::SparseMatrix<double> pattern = m.sparseView();
+  std::vector<int> colors = stan::math::column_coloring(pattern);
+  expect_structurally_orthogonal(m, colors);
+  EXPECT_EQ(6, *std::max_element(colors.begin(), colors.end()) + 1);
+
+  Eigen::MatrixXd rect = Eigen::MatrixXd::Zero(2, 4);
+  rect(0, 0) = rect(0, 2) = rect(1, 1) = rect(1, 3) = 1;
+  Eigen::SparseMatrix<double> rect_pattern = rect.sparseView();
+  colors = stan::math::column_coloring(rect_pattern);
+  expect_structurally_orthogonal(rect, colors);
+  EXPECT_EQ(std::vector<int>({0, 0, 1, 1}), colors);
+}
+
+TEST(MathFunctions, column_coloring_empty) {
+  Eigen::SparseMatrix<double> pattern(3, 0);
+  EXPECT_TRUE(stan::math::column_coloring(pattern).empty());
+  Eigen::SparseMatrix<double> no_entries(0, 3);
+  EXPECT_EQ(std::vector<int>(3, 0), stan::math::column_coloring(no_entries));
+}
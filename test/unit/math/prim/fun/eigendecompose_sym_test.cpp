@@ -0,0 +1,25 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(MathMatrixPrimMat, eigendecompose_sym) {
+  using stan::math::eigendecompose_sym;
+  stan::math::matrix_d m0;
+  stan::math::matrix_d m1(2, 3);
+  m1 << 1, 2, 3, 4, 5, 6;
+  stan::math::matrix_d m2(2, 2);
+  m2 << 1, 2, 3, 4;
+  EXPECT_THROW(eigendecompose_sym(m0), std::invalid_argument);
+  EXPECT_THROW(eigendecompose_sym(m1), std::invalid_argument);
+  EXPECT_THROW(eigendecompose_sym(m2), std::domain_error);
+
+  stan::math::matrix_d a(3, 3);
+  a << 1, 2, 3, 2, 5, 7.9, 3, 7.9, 1.08;
+  auto wv = eigendecompose_sym(a);
+  EXPECT_MATRIX_NEAR(stan::math::eigenvalues_sym(a), std::get<0>(wv), 1e-12);
+  EXPECT_MATRIX_NEAR(stan::math::eigenvectors_sym(a), std::get<1>(wv), 1e-12);
+  EXPECT_MATRIX_NEAR(a,
+                     std::get<1>(wv) * std::get<0>(wv).asDiagonal()
+                         * std::get<1>(wv).transpose(),
+                     1e-10);
+}
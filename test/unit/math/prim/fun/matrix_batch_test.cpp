@@ -0,0 +1,40 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(MathMatrixPrimMat, fixed_size_dispatch) {
+  for (int n = 0; n < 12; ++n) {
+    int size = -2;
+    stan::math::internal::fixed_size_dispatch(
+        n, [&](auto N) { size = decltype(N)::value; });
+    EXPECT_EQ(n >= 2 && n <= 8 ? n : Eigen::Dynamic, size);
+  }
+}
+
+TEST(MathMatrixPrimMat, batch_overloads) {
+  std::vector<Eigen::MatrixXd> A;
+  std::vector<Eigen::VectorXd> b;
+  for (int k = 0; k < 3; ++k) {
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(4, 4);
+    A.emplace_back(X * X.transpose() + 4 * Eigen::MatrixXd::Identity(4, 4));
+    b.emplace_back(Eigen::VectorXd::Random(4));
+  }
+  auto L = stan::math::cholesky_decompose(A);
+  auto A_inv = stan::math::inverse(A);
+  auto A_exp = stan::math::matrix_exp(A);
+  auto log_det = stan::math::log_determinant(A);
+  auto x = stan::math::mdivide_left(A, b);
+  ASSERT_EQ(3, L.size());
+  ASSERT_EQ(3, x.size());
+  for (int k = 0; k < 3; ++k) {
+    EXPECT_MATRIX_NEAR(stan::math::cholesky_decompose(A[k]), L[k], 1e-12);
+    EXPECT_MATRIX_NEAR(stan::math::inverse(A[k]), A_inv[k], 1e-12);
+    EXPECT_MATRIX_NEAR(stan::math::matrix_exp(A[k]), A_exp[k], 1e-12);
+    EXPECT_FLOAT_EQ(stan::math::log_determinant(A[k]), log_det[k]);
+    EXPECT_MATRIX_NEAR(stan::math::mdivide_left(A[k], b[k]), x[k], 1e-12);
+  }
+
+  b.pop_back();
+  EXPECT_THROW(stan::math::mdivide_left(A, b), std::invalid_argument);
+}
@@ -1,4 +1,5 @@
 #include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
 #include <gtest/gtest.h>
 
 TEST(MathMatrixPrim, mdivide_left_spd_val) {
@@ -33,3 +34,45 @@ TEST(MathMatrixPrim, mdivide_left_spd_size_zero) {
   EXPECT_EQ(m1.rows(), res.rows());
   EXPECT_EQ(m2.cols(), res.cols());
 }
+
+TEST(MathMatrixPrim, mdivide_left_spd_sparse) {
+  using stan::math::mdivide_left_spd;
+  Eigen::MatrixXd A(4, 4);
+  A << 4, -1, 0, 0.5, -1, 4, -1, 0, 0, -1, 4, -1, 0.5, 0, -1, 4;
+  Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+  Eigen::MatrixXd b(4, 2);
+  b << 1, 2, 3, 4, 5, 6, 7, 8;
+
+  EXPECT_MATRIX_NEAR(A.llt().solve(b), mdivide_left_spd(A_sparse, b), 1e-12);
+  Eigen::VectorXd b_col = b.col(1);
+  EXPECT_MATRIX_NEAR(A.llt().solve(b_col), mdivide_left_spd(A_sparse, b_col),
+                     1e-12);
+  // the cached ordering is reused for new values with the same pattern
+  A_sparse.coeffs() *= 2.0;
+  EXPECT_MATRIX_NEAR((2.0 * A).llt().solve(b), mdivide_left_spd(A_sparse, b),
+                     1e-12);
+  EXPECT_FLOAT_EQ(std::log((2.0 * A).determinant()),
+                  stan::math::log_determinant_spd(A_sparse));
+
+  A(0, 0) = -4;
+  A_sparse = A.sparseView();
+  EXPECT_THROW(mdivide_left_spd(A_sparse, b), std::domain_error);
+  EXPECT_THROW(stan::math::log_determinant_spd(A_sparse), std::domain_error);
+  EXPECT_THROW(mdivide_left_spd(A_sparse, Eigen::MatrixXd(3, 2)),
+               std::invalid_argument);
+}
+
+TEST(MathMatrixPrim, sparse_llt_factor_outlives_next_call) {
+  Eigen::MatrixXd A(3, 3);
+  A << 4, 1, 0, 1, 3, 1, 0, 1, 2;
+  Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+  Eigen::MatrixXd B = Eigen::MatrixXd::Identity(2, 2) * 5.0;
+  Eigen::SparseMatrix<double> B_sparse = B.sparseView();
+  Eigen::VectorXd b(3);
+  b << 1, 2, 3;
+
+  stan::math::internal::sparse_llt_factor A_llt
+      = stan::math::internal::sparse_llt("sparse_llt", "A", A_sparse);
+  stan::math::internal::sparse_llt("sparse_llt", "B", B_sparse);
+  EXPECT_MATRIX_NEAR(A.llt().solve(b), A_llt.solve(b), 1e-12);
+}
@@ -0,0 +1,19 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(MathMatrixPrim, transpose_multiply) {
+  using stan::math::transpose_multiply;
+  Eigen::MatrixXd A(3, 2);
+  A << 1, 0, -2, 3, 0, 4;
+  Eigen::MatrixXd B(3, 2);
+  B << 1, 2, 3, 4, 5, 6;
+  Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+
+  EXPECT_MATRIX_FLOAT_EQ(A.transpose() * B, transpose_multiply(A, B));
+  EXPECT_MATRIX_FLOAT_EQ(A.transpose() * B, transpose_multiply(A_sparse, B));
+  Eigen::VectorXd b = B.col(1);
+  EXPECT_MATRIX_FLOAT_EQ(A.transpose() * b, transpose_multiply(A_sparse, b));
+  EXPECT_THROW(transpose_multiply(A, Eigen::MatrixXd(2, 2)),
+               std::invalid_argument);
+}
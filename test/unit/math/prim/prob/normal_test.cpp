@@ -111,3 +111,28 @@ TEST(ProbDistributionsNormal, chiSquareGoodnessFitTest) {
   // Assert that they match
   assert_matches_quantiles(samples, quantiles, 1e-6);
 }
+
+TEST(ProbDistributionsNormal, vectorized_double) {
+  using stan::math::normal_lpdf;
+  Eigen::VectorXd y(3);
+  y << -0.3, 1.2, 4.0;
+  Eigen::VectorXd mu(3);
+  mu << 0.1, -0.2, 0.3;
+  std::vector<double> sigma{1.1, 2.0, 0.7};
+
+  double expected = 0;
+  double expected_bcast = 0;
+  for (int i = 0; i < 3; ++i) {
+    expected += normal_lpdf(y[i], mu[i], sigma[i]);
+    expected_bcast += normal_lpdf(y[i], 0.5, 1.3);
+  }
+  EXPECT_FLOAT_EQ(expected, normal_lpdf(y, mu, sigma));
+  EXPECT_FLOAT_EQ(expected_bcast, normal_lpdf(y, 0.5, 1.3));
+  EXPECT_FLOAT_EQ(0.0, normal_lpdf<true>(y, mu, sigma));
+
+  sigma[1] = -1;
+  EXPECT_THROW(normal_lpdf(y, mu, sigma), std::domain_error);
+  EXPECT_THROW(normal_lpdf<true>(y, mu, sigma), std::domain_error);
+  mu[2] = stan::math::INFTY;
+  EXPECT_THROW(normal_lpdf(y, mu, 1.0), std::domain_error);
+}
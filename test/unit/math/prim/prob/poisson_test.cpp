@@ -148,3 +148,27 @@ TEST(ProbPoisson, log_matches_lpmf) {
   EXPECT_FLOAT_EQ((stan::math::poisson_lpmf<int, double>(y, lambda)),
                   (stan::math::poisson_log<int, double>(y, lambda)));
 }
+
+TEST(ProbPoisson, vectorized_double) {
+  using stan::math::poisson_lpmf;
+  std::vector<int> n{0, 3, 5};
+  Eigen::VectorXd lambda(3);
+  lambda << 0.4, 2.3, 7.1;
+
+  double expected = 0;
+  double expected_bcast = 0;
+  for (int i = 0; i < 3; ++i) {
+    expected += poisson_lpmf(n[i], lambda[i]);
+    expected_bcast += poisson_lpmf(n[i], 1.7);
+  }
+  EXPECT_FLOAT_EQ(expected, poisson_lpmf(n, lambda));
+  EXPECT_FLOAT_EQ(expected_bcast, poisson_lpmf(n, 1.7));
+  EXPECT_FLOAT_EQ(0.0, poisson_lpmf<true>(n, lambda));
+
+  lambda[1] = 0;
+  EXPECT_FLOAT_EQ(stan::math::LOG_ZERO, poisson_lpmf(n, lambda));
+  EXPECT_FLOAT_EQ(0.0, poisson_lpmf(0, 0.0));
+  n[2] = -1;
+  EXPECT_THROW(poisson_lpmf(n, lambda), std::domain_error);
+  EXPECT_THROW(poisson_lpmf<true>(n, lambda), std::domain_error);
+}
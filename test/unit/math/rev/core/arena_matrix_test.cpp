@@ -104,3 +104,39 @@ TEST(AgradRev, arena_matrix_transpose_test) {
 
   stan::math::recover_memory();
 }
+
+TEST(AgradRev, arena_matrix_sparse_test) {
+  using stan::math::arena_matrix;
+  using sparse_t = Eigen::SparseMatrix<double>;
+  Eigen::MatrixXd m(3, 3);
+  m << 1, 0, 2, 0, 3, 0, 4, 0, 5;
+  sparse_t s = m.sparseView();
+
+  arena_matrix<sparse_t> a(s);
+  arena_matrix<sparse_t> b(a);
+  arena_matrix<sparse_t> c = a.zeros_like();
+  EXPECT_EQ(5, a.nonZeros());
+  EXPECT_MATRIX_EQ(m, Eigen::MatrixXd(a));
+  // copies and zeros_like share the indices of a
+  EXPECT_EQ(a.valuePtr(), b.valuePtr());
+  EXPECT_EQ(a.innerIndexPtr(), c.innerIndexPtr());
+  EXPECT_NE(a.valuePtr(), c.valuePtr());
+  EXPECT_MATRIX_EQ(Eigen::MatrixXd::Zero(3, 3), Eigen::MatrixXd(c));
+
+  // in place updates stay inside the sparsity pattern
+  c += s;
+  c += Eigen::MatrixXd::Ones(3, 3);
+  c -= (2 * s).eval();
+  Eigen::MatrixXd expected = -m;
+  for (Eigen::Index i = 0; i < m.size(); ++i) {
+    if (m(i) != 0) {
+      expected(i) += 1;
+    }
+  }
+  EXPECT_MATRIX_EQ(expected, Eigen::MatrixXd(c));
+
+  a = s * s;
+  EXPECT_MATRIX_EQ(m * m, Eigen::MatrixXd(a));
+  EXPECT_MATRIX_EQ(m, Eigen::MatrixXd(b));
+  stan::math::recover_memory();
+}
@@ -160,6 +160,26 @@ TEST(StanAgradRevInternal,
   stan::math::recover_memory();
 }
 
+TEST(StanAgradRevInternal, precomputed_gradients_containers_block_view) {
+  // the adjoint of a block view maps into the adjoint of the matrix, so it
+  // must be accumulated in place rather than rebound to new memory
+  double value = 1;
+  std::vector<stan::math::var> vars;
+  std::vector<double> gradients;
+  stan::math::var_value<Eigen::MatrixXd> a(Eigen::MatrixXd::Constant(3, 3, 2));
+  auto a_block = a.block(1, 1, 2, 2);
+  Eigen::MatrixXd grad_a = Eigen::MatrixXd::Constant(3, 3, -1);
+
+  stan::math::var lp = stan::math::precomputed_gradients(
+      value, vars, gradients, std::forward_as_tuple(a),
+      std::forward_as_tuple(grad_a));
+  (2 * lp).grad();
+  EXPECT_MATRIX_EQ(a.adj(), Eigen::MatrixXd::Constant(3, 3, -2));
+  EXPECT_MATRIX_EQ(a_block.adj(), Eigen::MatrixXd::Constant(2, 2, -2));
+
+  stan::math::recover_memory();
+}
+
 TEST(StanAgradRevInternal, precomputed_gradients_mismatched_containers) {
   double value = 1;
   std::vector<stan::math::var> vars;
@@ -181,3 +201,38 @@ TEST(StanAgradRevInternal, precomputed_gradients_mismatched_containers) {
                std::invalid_argument);
   stan::math::recover_memory();
 }
+
+TEST(StanAgradRevInternal, precomputed_gradients_repeated_operands) {
+  using stan::math::var;
+  var mu = 1.5;
+  var sigma = 2;
+  std::vector<var> vars{mu, mu, mu, sigma, sigma, mu};
+  std::vector<double> gradients{1, 2, 3, 4, 5, 6};
+  var y = stan::math::precomputed_gradients(3.0, vars, gradients);
+  y.grad();
+  EXPECT_FLOAT_EQ(12, mu.adj());
+  EXPECT_FLOAT_EQ(9, sigma.adj());
+  stan::math::recover_memory();
+}
+
+TEST(StanAgradRevInternal, merge_repeated_operands) {
+  using stan::math::vari;
+  vari* a = new vari(1.0);
+  vari* b = new vari(2.0);
+  std::vector<vari*> varis{a, a, b, a, b, b};
+  std::vector<double> gradients{1, 2, 3, 4, 5, 6};
+  size_t size = stan::math::internal::merge_repeated_operands(
+      varis.data(), gradients.data(), varis.size());
+  EXPECT_EQ(4, size);
+  EXPECT_EQ(a, varis[0]);
+  EXPECT_FLOAT_EQ(3, gradients[0]);
+  EXPECT_EQ(b, varis[1]);
+  EXPECT_FLOAT_EQ(3, gradients[1]);
+  EXPECT_EQ(a, varis[2]);
+  EXPECT_FLOAT_EQ(4, gradients[2]);
+  EXPECT_EQ(b, varis[3]);
+  EXPECT_FLOAT_EQ(11, gradients[3]);
+  EXPECT_EQ(0, stan::math::internal::merge_repeated_operands(
+                   varis.data(), gradients.data(), 0));
+  stan::math::recover_memory();
+}
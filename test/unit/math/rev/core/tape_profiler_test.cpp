@@ -0,0 +1,88 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+TEST(TapeProfiler, record) {
+  using stan::math::var;
+  stan::math::tape_profiler profiler;
+  var a = 2.0;
+  var b = 3.0;
+  var c = a * b + a * a + exp(b);
+  profiler.record();
+  auto entries = profiler.entries();
+  std::size_t count = 0;
+  std::size_t multiply_count = 0;
+  for (const auto& entry : entries) {
+    count += entry.second.count;
+    EXPECT_GT(entry.second.bytes, 0);
+    EXPECT_FLOAT_EQ(0, entry.second.chain_time);
+    if (entry.first.find("multiply_vv_vari") != std::string::npos) {
+      multiply_count = entry.second.count;
+    }
+  }
+  // a, b, two products, two sums and exp
+  EXPECT_EQ(7, count);
+  EXPECT_EQ(2, multiply_count);
+  EXPECT_EQ(2, entries[0].second.count);
+
+  profiler.grad(c.vi_);
+  EXPECT_FLOAT_EQ(b.val() + 2 * a.val(), a.adj());
+  EXPECT_FLOAT_EQ(a.val() + exp(b.val()), b.adj());
+  stan::math::recover_memory();
+}
+
+TEST(TapeProfiler, nested) {
+  using stan::math::var;
+  stan::math::tape_profiler profiler;
+  var a = 2.0;
+  var outer = a * a;
+  {
+    stan::math::nested_rev_autodiff nested;
+    var b = 3.0;
+    var c = log(b);
+    profiler.record();
+    profiler.grad(c.vi_);
+    EXPECT_FLOAT_EQ(1 / 3.0, b.adj());
+  }
+  std::size_t count = 0;
+  for (const auto& entry : profiler.entries()) {
+    count += entry.second.count;
+  }
+  EXPECT_EQ(2, count);
+  EXPECT_FLOAT_EQ(0, a.adj());
+  stan::math::recover_memory();
+}
+
+TEST(TapeProfiler, export) {
+  using stan::math::var;
+  stan::math::tape_profiler profiler;
+  var a = 2.0;
+  var c = a * a;
+  profiler.record();
+  profiler.grad(c.vi_);
+
+  std::stringstream csv;
+  profiler.write_csv(csv);
+  std::string line;
+  std::getline(csv, line);
+  EXPECT_EQ("type,count,bytes,chain_time", line);
+  int lines = 0;
+  while (std::getline(csv, line)) {
+    EXPECT_EQ('"', line[0]);
+    ++lines;
+  }
+  EXPECT_EQ(2, lines);
+
+  std::stringstream json;
+  profiler.write_json(json);
+  EXPECT_EQ('[', json.str().front());
+  EXPECT_NE(std::string::npos, json.str().find("\"count\": 1"));
+  EXPECT_NE(std::string::npos, json.str().find("\"chain_time\": "));
+
+  profiler.clear();
+  std::stringstream empty;
+  profiler.write_json(empty);
+  EXPECT_EQ("[]\n", empty.str());
+  stan::math::recover_memory();
+}
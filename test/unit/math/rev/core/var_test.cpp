@@ -127,9 +127,13 @@ void ctor_overloads_sparse_matrix(EigenMat&& x) {
   eigen_plain test_y = make_sparse_matrix_random(10, 10);
   inplace_add_var.vi_->init_dependent();
   inplace_add_var.adj() += test_y;
-  // adjoints sparsity pattern will be pattern of x and test_y for addition
+  // adjoints keep the sparsity pattern of x, entries of test_y outside of
+  // it are dropped
+  using arena_inner_iterator =
+      typename stan::arena_t<eigen_plain>::InnerIterator;
   for (int k = 0; k < x.outerSize(); ++k) {
-    for (inner_iterator it(test_y, k), iz(inplace_add_var.adj(), k); iz; ++iz) {
+    inner_iterator it(test_y, k);
+    for (arena_inner_iterator iz(inplace_add_var.adj(), k); iz; ++iz) {
       if (iz.row() == it.row() && iz.col() == it.col()) {
         EXPECT_FLOAT_EQ(iz.value() - 1, it.value());
         ++it;
@@ -47,12 +47,14 @@ TEST(AgradRev, sparse_matrix_vari) {
   using stan::math::vari_value;
   using eig_mat = Eigen::SparseMatrix<double>;
   using inner_iterator = typename eig_mat::InnerIterator;
+  using arena_inner_iterator = typename stan::arena_t<eig_mat>::InnerIterator;
   using stan::test::make_sparse_matrix_random;
   vari_value<eig_mat> A_vari(make_sparse_matrix_random(10, 10));
   eig_mat B = make_sparse_matrix_random(10, 10);
   vari_value<eig_mat> B_vari(B);
   for (int k = 0; k < B.outerSize(); ++k) {
-    for (inner_iterator it(B, k), iz(B_vari.val(), k); it; ++it, ++iz) {
+    arena_inner_iterator iz(B_vari.val(), k);
+    for (inner_iterator it(B, k); it; ++it, ++iz) {
       EXPECT_FLOAT_EQ(iz.value(), it.value());
     }
   }
@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <gtest/gtest.h>
 #include <test/unit/math/rev/util.hpp>
+#include <test/unit/util.hpp>
 #include <boost/random/mersenne_twister.hpp>
 #include <vector>
 
@@ -472,3 +473,44 @@ TEST(AgradRevMatrix, cholesky_replicated_input) {
   fd_ref = (f(size, ydbl + dx) - f(size, ydbl - dx)) / (2.0 * dx);
   EXPECT_FLOAT_EQ(y.adj(), fd_ref);
 }
+
+TEST(AgradRevMatrix, cholesky_tiled_matches_blocked) {
+  using stan::math::var;
+  using stan::math::var_value;
+  const int N = 75;
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd A_val = X * X.transpose();
+  A_val.diagonal().array() += N;
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(N, N);
+
+  auto adjoints = [&](bool varmat) {
+    Eigen::MatrixXd A_adj;
+    if (varmat) {
+      var_value<Eigen::MatrixXd> A = A_val;
+      var_value<Eigen::MatrixXd> L = stan::math::cholesky_decompose(A);
+      stan::math::sum(stan::math::elt_multiply(W, L)).grad();
+      A_adj = A.adj();
+    } else {
+      Eigen::Matrix<var, -1, -1> A = A_val;
+      Eigen::Matrix<var, -1, -1> L = stan::math::cholesky_decompose(A);
+      stan::math::sum(stan::math::elt_multiply(W, L)).grad();
+      A_adj = A.adj();
+    }
+    stan::math::recover_memory();
+    return A_adj;
+  };
+
+  auto& opts = stan::math::cholesky_tuning_opts();
+  const stan::math::cholesky_tuning_struct defaults = opts;
+  Eigen::MatrixXd blocked = adjoints(false);
+  Eigen::MatrixXd blocked_varmat = adjoints(true);
+  opts.tile_size = 16;
+  opts.min_rows = 40;
+  Eigen::MatrixXd tiled = adjoints(false);
+  Eigen::MatrixXd tiled_varmat = adjoints(true);
+  opts = defaults;
+
+  EXPECT_MATRIX_NEAR(blocked, tiled, 1e-10);
+  EXPECT_MATRIX_NEAR(blocked_varmat, tiled_varmat, 1e-10);
+  EXPECT_MATRIX_NEAR(blocked, blocked_varmat, 1e-10);
+}
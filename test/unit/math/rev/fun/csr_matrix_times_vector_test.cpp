@@ -0,0 +1,77 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(AgradRev, csr_matrix_times_vector_matches_dense) {
+  using stan::math::var;
+  Eigen::MatrixXd m(3, 4);
+  m << 2.0, 0.0, 6.0, 0.0, 0.0, 0.0, 0.0, 0.0, 8.0, -1.5, 0.0, 12.0;
+  Eigen::SparseMatrix<double, Eigen::RowMajor> a = m.sparseView();
+  Eigen::VectorXd w = stan::math::csr_extract_w(a);
+  std::vector<int> v = stan::math::csr_extract_v(a);
+  std::vector<int> u = stan::math::csr_extract_u(a);
+  Eigen::VectorXd b(4);
+  b << 0.5, -1.0, 2.5, 3.0;
+  Eigen::VectorXd c(3);
+  c << 1.0, -2.0, 0.7;
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> w_v = w;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> b_v = b;
+  var lp = stan::math::dot_product(
+      c, stan::math::csr_matrix_times_vector(3, 4, w_v, v, u, b_v));
+  lp.grad();
+  EXPECT_FLOAT_EQ(c.dot(m * b), lp.val());
+
+  // d/db c' A b = A' c, and d/dw is c[row] * b[col] for each non-zero
+  Eigen::VectorXd b_adj = m.transpose() * c;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_FLOAT_EQ(b_adj(i), b_v(i).adj());
+  }
+  int nze = 0;
+  for (int row = 0; row < 3; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      if (m(row, col) != 0) {
+        EXPECT_FLOAT_EQ(c(row) * b(col), w_v(nze).adj());
+        ++nze;
+      }
+    }
+  }
+
+  stan::math::set_zero_all_adjoints();
+  var lp_b = stan::math::dot_product(
+      c, stan::math::csr_matrix_times_vector(3, 4, w, v, u, b_v));
+  lp_b.grad();
+  EXPECT_FLOAT_EQ(c.dot(m * b), lp_b.val());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_FLOAT_EQ(b_adj(i), b_v(i).adj());
+  }
+
+  stan::math::set_zero_all_adjoints();
+  var lp_w = stan::math::dot_product(
+      c, stan::math::csr_matrix_times_vector(3, 4, w_v, v, u, b));
+  lp_w.grad();
+  EXPECT_FLOAT_EQ(c.dot(m * b), lp_w.val());
+  EXPECT_FLOAT_EQ(c(2) * b(3), w_v(4).adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, csr_matrix_times_vector_throws) {
+  using stan::math::var;
+  Eigen::MatrixXd m(2, 3);
+  m << 2.0, 4.0, 6.0, 8.0, 10.0, 12.0;
+  Eigen::SparseMatrix<double, Eigen::RowMajor> a = m.sparseView();
+  Eigen::Matrix<var, Eigen::Dynamic, 1> w = stan::math::csr_extract_w(a);
+  std::vector<int> v = stan::math::csr_extract_v(a);
+  std::vector<int> u = stan::math::csr_extract_u(a);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> b(3);
+  b << 22, 33, 44;
+
+  EXPECT_THROW(stan::math::csr_matrix_times_vector(0, 3, w, v, u, b),
+               std::domain_error);
+  EXPECT_THROW(stan::math::csr_matrix_times_vector(2, 4, w, v, u, b),
+               std::invalid_argument);
+  v[3] = 4;
+  EXPECT_THROW(stan::math::csr_matrix_times_vector(2, 3, w, v, u, b),
+               std::out_of_range);
+  stan::math::recover_memory();
+}
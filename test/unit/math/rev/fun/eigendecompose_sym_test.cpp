@@ -0,0 +1,76 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+Eigen::MatrixXd spd_matrix(int n) {
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(n, n);
+  Eigen::MatrixXd A = X * X.transpose();
+  A.diagonal().array() += 1.0;
+  return A;
+}
+}  // namespace
+
+TEST(AgradRev, eigendecomposeSymMatchesSeparate) {
+  using stan::math::matrix_v;
+  using stan::math::var;
+  for (int n : {1, 4, 12}) {
+    Eigen::MatrixXd a = spd_matrix(n);
+    Eigen::VectorXd u = Eigen::VectorXd::Random(n);
+    Eigen::MatrixXd W = Eigen::MatrixXd::Random(n, n);
+
+    matrix_v a_sep(a);
+    // eigenvector signs are fixed by the solver, so both calls agree
+    matrix_v v_sep = stan::math::eigenvectors_sym(a_sep);
+    var lp_sep = stan::math::dot_product(u, stan::math::eigenvalues_sym(a_sep))
+                 + stan::math::sum(stan::math::elt_multiply(
+                     W, stan::math::square(v_sep)));
+    lp_sep.grad();
+    const double val_sep = lp_sep.val();
+    const Eigen::MatrixXd adj_sep = a_sep.adj();
+    stan::math::recover_memory();
+
+    matrix_v a_v(a);
+    auto wv = stan::math::eigendecompose_sym(a_v);
+    var lp = stan::math::dot_product(u, std::get<0>(wv))
+             + stan::math::sum(stan::math::elt_multiply(
+                 W, stan::math::square(std::get<1>(wv))));
+    lp.grad();
+    EXPECT_NEAR(val_sep, lp.val(), 1e-8);
+    EXPECT_MATRIX_NEAR(adj_sep, a_v.adj(), 1e-8);
+    stan::math::recover_memory();
+
+    stan::math::var_value<Eigen::MatrixXd> a_vv(a);
+    auto wv_vv = stan::math::eigendecompose_sym(a_vv);
+    lp = stan::math::dot_product(u, std::get<0>(wv_vv))
+         + stan::math::sum(stan::math::elt_multiply(
+             W, stan::math::square(std::get<1>(wv_vv))));
+    lp.grad();
+    EXPECT_MATRIX_NEAR(adj_sep, a_vv.adj(), 1e-8);
+    stan::math::recover_memory();
+  }
+}
+
+TEST(AgradRev, eigenvaluesSymSparseAdjoint) {
+  // the largest eigenvalue only takes the rank one path of the adjoint,
+  // whose gradient is the outer product of its eigenvector
+  int n = 20;
+  Eigen::MatrixXd a = spd_matrix(n);
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(a);
+  Eigen::VectorXd v = solver.eigenvectors().col(n - 1);
+
+  stan::math::matrix_v a_v(a);
+  stan::math::var w_max = stan::math::eigenvalues_sym(a_v)(n - 1);
+  w_max.grad();
+  EXPECT_MATRIX_NEAR(v * v.transpose(), a_v.adj(), 1e-8);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, eigendecomposeSymThrows) {
+  stan::math::matrix_v m0;
+  EXPECT_THROW(stan::math::eigendecompose_sym(m0), std::invalid_argument);
+  stan::math::matrix_v m(2, 2);
+  m << 1, 2, 3, 4;
+  EXPECT_THROW(stan::math::eigendecompose_sym(m), std::domain_error);
+  stan::math::recover_memory();
+}
@@ -0,0 +1,143 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+
+namespace {
+using ldlt_t = Eigen::LDLT<Eigen::MatrixXd>;
+
+size_t cache_size() {
+  return stan::math::internal::cached_factorization<ldlt_t>::size();
+}
+}  // namespace
+
+TEST(AgradRevMatrix, value_ldlt_cached) {
+  using stan::math::value_ldlt;
+  using stan::math::var;
+  Eigen::MatrixXd a(3, 3);
+  a << 4, 1, 0.5, 1, 3, 0.2, 0.5, 0.2, 2;
+
+  Eigen::Matrix<var, -1, -1> A = a;
+  Eigen::Matrix<var, -1, -1> A_copy = A;
+  Eigen::Matrix<var, -1, -1> B = a;
+  stan::math::var_value<Eigen::MatrixXd> A_vm = a;
+
+  const ldlt_t& ldlt_A = value_ldlt<double>(A);
+  EXPECT_EQ(&ldlt_A, &value_ldlt<double>(A));
+  EXPECT_EQ(&ldlt_A, &value_ldlt<double>(A_copy));
+  EXPECT_EQ(&ldlt_A, &stan::math::make_ldlt_factor(A).ldlt());
+  EXPECT_NE(&ldlt_A, &value_ldlt<double>(B));
+  EXPECT_EQ(&value_ldlt<double>(A_vm), &value_ldlt<double>(A_vm));
+  EXPECT_MATRIX_NEAR(a.ldlt().solve(a), ldlt_A.solve(a), 1e-12);
+
+  // matrices that share the first vari are told apart
+  Eigen::Matrix<var, -1, -1> A_other = A;
+  A_other(2, 2) = 5;
+  EXPECT_NE(&ldlt_A, &value_ldlt<double>(A_other));
+  EXPECT_NE(&ldlt_A, &value_ldlt<double>(A.block(0, 0, 2, 2)));
+  EXPECT_EQ(&ldlt_A, &value_ldlt<double>(A));
+
+  stan::math::recover_memory();
+  EXPECT_EQ(0, cache_size());
+}
+
+TEST(AgradRevMatrix, value_ldlt_nested) {
+  using stan::math::value_ldlt;
+  using stan::math::var;
+  Eigen::MatrixXd a(2, 2);
+  a << 2, 1, 1, 2;
+  Eigen::Matrix<var, -1, -1> A = a;
+  value_ldlt<double>(A);
+  EXPECT_EQ(1, cache_size());
+
+  stan::math::start_nested();
+  Eigen::Matrix<var, -1, -1> A_nested = a;
+  value_ldlt<double>(A_nested);
+  value_ldlt<double>(A);
+  EXPECT_EQ(2, cache_size());
+  stan::math::recover_memory_nested();
+  EXPECT_EQ(1, cache_size());
+
+  stan::math::recover_memory();
+  EXPECT_EQ(0, cache_size());
+}
+
+TEST(AgradRevMatrix, value_ldlt_shared_by_lpdfs) {
+  using stan::math::var;
+  Eigen::MatrixXd sigma(3, 3);
+  sigma << 4, 1, 0.5, 1, 3, 0.2, 0.5, 0.2, 2;
+  Eigen::VectorXd y(3);
+  y << 1, -0.5, 2;
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(3);
+  Eigen::MatrixXd W = sigma + Eigen::MatrixXd::Identity(3, 3);
+
+  auto lp_fun = [&](const auto& Sigma) {
+    return stan::math::multi_normal_lpdf(y, mu, Sigma)
+           + stan::math::multi_student_t_lpdf(y, 4.0, mu, Sigma)
+           + stan::math::wishart_lpdf(W, 5.0, Sigma)
+           + stan::math::inv_wishart_lpdf(W, 5.0, Sigma);
+  };
+
+  Eigen::Matrix<var, -1, -1> Sigma = sigma;
+  var lp = lp_fun(Sigma);
+  EXPECT_EQ(1, cache_size());
+  lp.grad();
+  const Eigen::MatrixXd adj = Sigma.adj();
+  const double lp_val = lp.val();
+  stan::math::recover_memory();
+
+  // each term on its own copy of the matrix factors it separately
+  var lp_sep = 0;
+  std::vector<Eigen::Matrix<var, -1, -1>> Sigmas;
+  for (int i = 0; i < 4; ++i) {
+    Sigmas.emplace_back(sigma);
+  }
+  lp_sep += stan::math::multi_normal_lpdf(y, mu, Sigmas[0]);
+  lp_sep += stan::math::multi_student_t_lpdf(y, 4.0, mu, Sigmas[1]);
+  lp_sep += stan::math::wishart_lpdf(W, 5.0, Sigmas[2]);
+  lp_sep += stan::math::inv_wishart_lpdf(W, 5.0, Sigmas[3]);
+  EXPECT_EQ(4, cache_size());
+  lp_sep.grad();
+  EXPECT_FLOAT_EQ(lp_val, lp_sep.val());
+  Eigen::MatrixXd adj_sep = Eigen::MatrixXd::Zero(3, 3);
+  for (const auto& S : Sigmas) {
+    adj_sep += S.adj();
+  }
+  EXPECT_MATRIX_NEAR(adj_sep, adj, 1e-10);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, value_ldlt_var_value_assigned_in_place) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd sigma(3, 3);
+  sigma << 4, 1, 0.5, 1, 3, 0.2, 0.5, 0.2, 2;
+  Eigen::MatrixXd sigma_new(3, 3);
+  sigma_new << 5, 0.3, 0.1, 0.3, 2, 0.4, 0.1, 0.4, 3;
+  Eigen::VectorXd y(3);
+  y << 1, -0.5, 2;
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(3);
+
+  var_value<Eigen::MatrixXd> Sigma = sigma;
+  var lp1 = stan::math::multi_normal_lpdf(y, mu, Sigma);
+  EXPECT_FLOAT_EQ(stan::math::multi_normal_lpdf(y, mu, sigma), lp1.val());
+
+  // assigning a block writes the values in place and keeps the vari
+  var_value<Eigen::MatrixXd> Sigma_new = sigma_new;
+  Sigma.block(0, 0, 3, 3) = Sigma_new;
+  var lp2 = stan::math::multi_normal_lpdf(y, mu, Sigma);
+  EXPECT_FLOAT_EQ(stan::math::multi_normal_lpdf(y, mu, sigma_new), lp2.val());
+  EXPECT_EQ(2, cache_size());
+
+  lp2.grad();
+  Eigen::MatrixXd inv = sigma_new.inverse();
+  Eigen::MatrixXd adj_expected
+      = 0.5 * (inv * y * y.transpose() * inv - inv);
+  EXPECT_MATRIX_NEAR(adj_expected, Sigma_new.adj(), 1e-10);
+
+  // the reverse pass restores the previous values in place
+  EXPECT_MATRIX_EQ(sigma, Sigma.val());
+  EXPECT_MATRIX_NEAR(sigma.ldlt().solve(y),
+                     stan::math::value_ldlt<double>(Sigma).solve(y), 1e-12);
+  stan::math::recover_memory();
+  EXPECT_EQ(0, cache_size());
+}
@@ -0,0 +1,171 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+using stan::math::var;
+using mat_v = Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>;
+
+std::vector<Eigen::MatrixXd> spd_batch(int n, int K) {
+  std::vector<Eigen::MatrixXd> batch;
+  for (int k = 0; k < K; ++k) {
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(n, n);
+    batch.emplace_back(X * X.transpose());
+    batch.back().diagonal().array() += n;
+  }
+  return batch;
+}
+
+std::vector<mat_v> to_var_batch(const std::vector<Eigen::MatrixXd>& batch) {
+  return std::vector<mat_v>(batch.begin(), batch.end());
+}
+
+/**
+ * Compare values and adjoints of a batched function with calling the
+ * single-matrix function on each matrix. `f` maps a batch of matrices
+ * of vars to a `var`, `f_single` does the same one matrix at a time.
+ */
+template <typename F, typename G>
+void expect_batch_matches(const std::vector<Eigen::MatrixXd>& batch,
+                          const F& f, const G& f_single) {
+  std::vector<mat_v> x_single = to_var_batch(batch);
+  var lp_single = 0;
+  for (const auto& x_k : x_single) {
+    lp_single += f_single(x_k);
+  }
+  lp_single.grad();
+  const double val_single = lp_single.val();
+  std::vector<Eigen::MatrixXd> adj_single;
+  for (const auto& x_k : x_single) {
+    adj_single.emplace_back(x_k.adj());
+  }
+  stan::math::recover_memory();
+
+  std::vector<mat_v> x = to_var_batch(batch);
+  var lp = f(x);
+  lp.grad();
+  EXPECT_NEAR(val_single, lp.val(), 1e-8);
+  for (size_t k = 0; k < batch.size(); ++k) {
+    EXPECT_MATRIX_NEAR(adj_single[k], x[k].adj(), 1e-8);
+  }
+  stan::math::recover_memory();
+}
+
+template <typename F>
+auto weighted_sum(const F& f, const Eigen::MatrixXd& W) {
+  return [f, W](const auto& x) {
+    var lp = 0;
+    for (const auto& y : f(x)) {
+      lp += stan::math::sum(stan::math::elt_multiply(W, y));
+    }
+    return lp;
+  };
+}
+
+template <typename F>
+auto weighted_single(const F& f, const Eigen::MatrixXd& W) {
+  return [f, W](const auto& x) {
+    return stan::math::sum(stan::math::elt_multiply(W, f(x)));
+  };
+}
+}  // namespace
+
+TEST(AgradRevMatrix, batch_matches_single) {
+  for (int n : {2, 3, 8, 10}) {
+    std::vector<Eigen::MatrixXd> batch = spd_batch(n, 5);
+    Eigen::MatrixXd W = Eigen::MatrixXd::Random(n, n);
+    auto chol
+        = [](const auto& x) { return stan::math::cholesky_decompose(x); };
+    auto inv = [](const auto& x) { return stan::math::inverse(x); };
+    auto expm = [](const auto& x) { return stan::math::matrix_exp(x); };
+
+    expect_batch_matches(batch, weighted_sum(chol, W),
+                         weighted_single(chol, W));
+    expect_batch_matches(batch, weighted_sum(inv, W),
+                         weighted_single(inv, W));
+
+    std::vector<Eigen::MatrixXd> small_batch;
+    for (const auto& m : batch) {
+      small_batch.emplace_back(m / (2.0 * n));
+    }
+    expect_batch_matches(small_batch, weighted_sum(expm, W),
+                         weighted_single(expm, W));
+
+    expect_batch_matches(
+        batch,
+        [](const auto& x) {
+          return stan::math::sum(stan::math::log_determinant(x));
+        },
+        [](const auto& x) { return stan::math::log_determinant(x); });
+  }
+}
+
+TEST(AgradRevMatrix, batch_mdivide_left) {
+  for (int n : {3, 9}) {
+    std::vector<Eigen::MatrixXd> A = spd_batch(n, 4);
+    std::vector<Eigen::MatrixXd> B;
+    for (int k = 0; k < 4; ++k) {
+      B.emplace_back(Eigen::MatrixXd::Random(n, 2));
+    }
+    Eigen::MatrixXd W = Eigen::MatrixXd::Random(n, 2);
+
+    std::vector<mat_v> A_single = to_var_batch(A);
+    std::vector<mat_v> B_single = to_var_batch(B);
+    var lp_single = 0;
+    for (int k = 0; k < 4; ++k) {
+      lp_single += stan::math::sum(stan::math::elt_multiply(
+          W, stan::math::mdivide_left(A_single[k], B_single[k])));
+    }
+    lp_single.grad();
+    const double val_single = lp_single.val();
+    std::vector<Eigen::MatrixXd> A_adj, B_adj;
+    for (int k = 0; k < 4; ++k) {
+      A_adj.emplace_back(A_single[k].adj());
+      B_adj.emplace_back(B_single[k].adj());
+    }
+    stan::math::recover_memory();
+
+    std::vector<mat_v> A_v = to_var_batch(A);
+    std::vector<mat_v> B_v = to_var_batch(B);
+    var lp = 0;
+    for (const auto& x : stan::math::mdivide_left(A_v, B_v)) {
+      lp += stan::math::sum(stan::math::elt_multiply(W, x));
+    }
+    lp.grad();
+    EXPECT_NEAR(val_single, lp.val(), 1e-8);
+    for (int k = 0; k < 4; ++k) {
+      EXPECT_MATRIX_NEAR(A_adj[k], A_v[k].adj(), 1e-8);
+      EXPECT_MATRIX_NEAR(B_adj[k], B_v[k].adj(), 1e-8);
+    }
+    stan::math::recover_memory();
+
+    std::vector<mat_v> B_only = to_var_batch(B);
+    lp = 0;
+    for (const auto& x : stan::math::mdivide_left(A, B_only)) {
+      lp += stan::math::sum(stan::math::elt_multiply(W, x));
+    }
+    lp.grad();
+    for (int k = 0; k < 4; ++k) {
+      EXPECT_MATRIX_NEAR(B_adj[k], B_only[k].adj(), 1e-8);
+    }
+    stan::math::recover_memory();
+  }
+}
+
+TEST(AgradRevMatrix, batch_throws) {
+  std::vector<mat_v> empty;
+  EXPECT_EQ(0, stan::math::cholesky_decompose(empty).size());
+
+  std::vector<mat_v> mixed{Eigen::MatrixXd::Identity(2, 2),
+                           Eigen::MatrixXd::Identity(3, 3)};
+  EXPECT_THROW(stan::math::inverse(mixed), std::invalid_argument);
+
+  std::vector<mat_v> not_pd{Eigen::MatrixXd::Identity(2, 2),
+                            -Eigen::MatrixXd::Identity(2, 2)};
+  EXPECT_THROW(stan::math::cholesky_decompose(not_pd), std::domain_error);
+
+  std::vector<mat_v> B{Eigen::MatrixXd::Ones(2, 1)};
+  EXPECT_THROW(stan::math::mdivide_left(not_pd, B), std::invalid_argument);
+  stan::math::recover_memory();
+}
@@ -0,0 +1,71 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(AgradRevMatrix, scale_matrix_exp_multiply_matches_matrix_exp) {
+  using stan::math::var;
+  using stan::math::var_value;
+  const int N = 30;
+  Eigen::MatrixXd A_val = Eigen::MatrixXd::Random(N, N);
+  A_val.diagonal().array() -= 2.0;
+  Eigen::MatrixXd B_val = Eigen::MatrixXd::Random(N, 2);
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(N, 2);
+  const double t_val = 1.7;
+
+  Eigen::Matrix<var, -1, -1> A_ref = A_val;
+  Eigen::Matrix<var, -1, -1> B_ref = B_val;
+  var t_ref = t_val;
+  var lp_ref = stan::math::sum(stan::math::elt_multiply(
+      W, stan::math::multiply(
+             stan::math::matrix_exp(stan::math::multiply(t_ref, A_ref)),
+             B_ref)));
+  lp_ref.grad();
+  double lp_val = lp_ref.val();
+  Eigen::MatrixXd A_adj = A_ref.adj();
+  Eigen::MatrixXd B_adj = B_ref.adj();
+  double t_adj = t_ref.adj();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, -1> A = A_val;
+  Eigen::Matrix<var, -1, -1> B = B_val;
+  var t = t_val;
+  var lp = stan::math::sum(stan::math::elt_multiply(
+      W, stan::math::scale_matrix_exp_multiply(t, A, B)));
+  lp.grad();
+  EXPECT_NEAR(lp_val, lp.val(), 1e-10);
+  EXPECT_MATRIX_NEAR(A_adj, A.adj(), 1e-9);
+  EXPECT_MATRIX_NEAR(B_adj, B.adj(), 1e-9);
+  EXPECT_NEAR(t_adj, t.adj(), 1e-9);
+  stan::math::recover_memory();
+
+  var_value<Eigen::MatrixXd> A_mv = A_val;
+  var lp_mv = stan::math::sum(stan::math::elt_multiply(
+      W, stan::math::scale_matrix_exp_multiply(t_val, A_mv, B_val)));
+  lp_mv.grad();
+  EXPECT_MATRIX_NEAR(A_adj, A_mv.adj(), 1e-9);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, matrix_exp_multiply_vector) {
+  using stan::math::var;
+  const int N = 12;
+  Eigen::MatrixXd A_val = Eigen::MatrixXd::Random(N, N);
+  Eigen::VectorXd b_val = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd w = Eigen::VectorXd::Random(N);
+
+  Eigen::Matrix<var, -1, 1> b_ref = b_val;
+  var lp_ref = stan::math::dot_product(
+      w, stan::math::multiply(stan::math::matrix_exp(A_val), b_ref));
+  lp_ref.grad();
+  double lp_val = lp_ref.val();
+  Eigen::VectorXd b_adj = b_ref.adj();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, 1> b = b_val;
+  Eigen::Matrix<var, -1, 1> y = stan::math::matrix_exp_multiply(A_val, b);
+  var lp = stan::math::dot_product(w, y);
+  lp.grad();
+  EXPECT_NEAR(lp_val, lp.val(), 1e-10);
+  EXPECT_MATRIX_NEAR(b_adj, b.adj(), 1e-10);
+  stan::math::recover_memory();
+}
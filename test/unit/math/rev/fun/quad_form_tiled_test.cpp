@@ -0,0 +1,98 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+
+namespace {
+// sizes that take the tiled code paths
+constexpr int N = 300;
+constexpr int K = 250;
+}  // namespace
+
+TEST(AgradRevMatrix, quad_form_tiled_matches_dense) {
+  using stan::math::var;
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(N, K);
+  Eigen::MatrixXd c_adj = Eigen::MatrixXd::Random(K, K);
+  Eigen::MatrixXd c_adj_sym = 0.5 * (c_adj + c_adj.transpose());
+
+  for (bool symmetric : {false, true}) {
+    Eigen::Matrix<var, -1, -1> A = a;
+    stan::math::var_value<Eigen::MatrixXd> B = b;
+    auto C = stan::math::quad_form(A, B, symmetric);
+    Eigen::MatrixXd c = b.transpose() * a * b;
+    const Eigen::MatrixXd& g = symmetric ? c_adj_sym : c_adj;
+    if (symmetric) {
+      c = (0.5 * (c + c.transpose())).eval();
+    }
+    EXPECT_MATRIX_NEAR(c, C.val(), 1e-9);
+
+    var lp = stan::math::sum(stan::math::elt_multiply(C, c_adj));
+    lp.grad();
+    EXPECT_MATRIX_NEAR(b * g * b.transpose(), A.adj(), 1e-9);
+    EXPECT_MATRIX_NEAR(a * b * g.transpose() + a.transpose() * b * g,
+                       B.adj(), 1e-9);
+    stan::math::recover_memory();
+  }
+}
+
+TEST(AgradRevMatrix, quad_form_sym_tiled_matches_dense) {
+  using stan::math::var;
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(N, N);
+  a = (a + a.transpose()).eval();
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(N, K);
+  Eigen::MatrixXd c_adj = Eigen::MatrixXd::Random(K, K);
+  Eigen::MatrixXd g = 0.5 * (c_adj + c_adj.transpose());
+
+  stan::math::var_value<Eigen::MatrixXd> A = a;
+  Eigen::Matrix<var, -1, -1> B = b;
+  stan::math::var_value<Eigen::MatrixXd> C = stan::math::quad_form_sym(A, B);
+  EXPECT_MATRIX_NEAR(b.transpose() * a * b, C.val(), 1e-9);
+  EXPECT_MATRIX_EQ(C.val(), C.val().transpose());
+
+  var lp = stan::math::sum(stan::math::elt_multiply(C, c_adj));
+  lp.grad();
+  EXPECT_MATRIX_NEAR(b * g * b.transpose(), A.adj(), 1e-9);
+  EXPECT_MATRIX_NEAR(2 * a * b * g, B.adj(), 1e-9);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, trace_quad_form_tiled_matches_dense) {
+  using stan::math::var;
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(N, K);
+
+  Eigen::Matrix<var, -1, -1> A = a;
+  Eigen::Matrix<var, -1, -1> B = b;
+  var res = stan::math::trace_quad_form(A, B);
+  EXPECT_NEAR((b.transpose() * a * b).trace(), res.val(), 1e-8);
+
+  res.grad();
+  EXPECT_MATRIX_NEAR(b * b.transpose(), A.adj(), 1e-9);
+  EXPECT_MATRIX_NEAR((a + a.transpose()) * b, B.adj(), 1e-9);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, trace_gen_quad_form_tiled_matches_dense) {
+  using stan::math::var;
+  Eigen::MatrixXd d = Eigen::MatrixXd::Random(K, K);
+  Eigen::MatrixXd a = Eigen::MatrixXd::Random(N, N);
+  Eigen::MatrixXd b = Eigen::MatrixXd::Random(N, K);
+
+  // the public function stores the products at this size, so check the
+  // tiled path that it takes for larger matrices as well
+  for (bool tiled : {false, true}) {
+    stan::math::var_value<Eigen::MatrixXd> D = d;
+    Eigen::Matrix<var, -1, -1> A = a;
+    stan::math::var_value<Eigen::MatrixXd> B = b;
+    var res = tiled ? stan::math::internal::trace_gen_quad_form_tiled(D, A, B)
+                    : stan::math::trace_gen_quad_form(D, A, B);
+    EXPECT_NEAR((d * b.transpose() * a * b).trace(), res.val(), 1e-8);
+
+    res.grad();
+    EXPECT_MATRIX_NEAR(b.transpose() * a.transpose() * b, D.adj(), 1e-9);
+    EXPECT_MATRIX_NEAR(b * d.transpose() * b.transpose(), A.adj(), 1e-9);
+    EXPECT_MATRIX_NEAR(a * b * d + a.transpose() * b * d.transpose(),
+                       B.adj(), 1e-9);
+    stan::math::recover_memory();
+  }
+}
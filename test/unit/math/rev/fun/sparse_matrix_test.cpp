@@ -0,0 +1,267 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+using sparse_t = Eigen::SparseMatrix<double>;
+
+Eigen::MatrixXd sparse_test_matrix() {
+  Eigen::MatrixXd m(3, 3);
+  m << 1.5, 0, 2, 0, -3, 0, 4, 0, 5;
+  return m;
+}
+
+// zero out the entries of a dense gradient outside the pattern of m
+Eigen::MatrixXd on_pattern(const Eigen::MatrixXd& grad,
+                           const Eigen::MatrixXd& m) {
+  return (m.array() != 0).select(grad, 0.0);
+}
+
+// gradient of f with respect to a dense matrix of vars holding m
+template <typename F>
+Eigen::MatrixXd dense_grad(const F& f, const Eigen::MatrixXd& m) {
+  Eigen::Matrix<stan::math::var, -1, -1> m_v = m;
+  f(m_v).grad();
+  Eigen::MatrixXd grad = m_v.adj();
+  stan::math::recover_memory();
+  return grad;
+}
+}  // namespace
+
+TEST(AgradRevSparse, var_value_storage) {
+  using stan::math::var_value;
+  Eigen::MatrixXd m = sparse_test_matrix();
+  sparse_t s = m.sparseView();
+  var_value<sparse_t> A(s);
+  EXPECT_MATRIX_EQ(m, Eigen::MatrixXd(A.val()));
+  EXPECT_EQ(A.val().nonZeros(), A.adj().nonZeros());
+  EXPECT_EQ(A.val().innerIndexPtr(), A.adj().innerIndexPtr());
+  EXPECT_EQ(A.val().outerIndexPtr(), A.adj().outerIndexPtr());
+  A.vi_->init_dependent();
+  EXPECT_MATRIX_EQ(Eigen::MatrixXd((m.array() != 0).cast<double>()),
+                   Eigen::MatrixXd(A.adj()));
+  stan::math::set_zero_all_adjoints();
+  EXPECT_FLOAT_EQ(0.0, Eigen::MatrixXd(A.adj()).norm());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSparse, multiply) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd m = sparse_test_matrix();
+  sparse_t s = m.sparseView();
+  Eigen::MatrixXd B(3, 2);
+  B << 1, -2, 0.5, 4, 3, 1;
+
+  Eigen::MatrixXd A_grad = on_pattern(
+      dense_grad(
+          [&](const auto& x) {
+            return stan::math::sum(stan::math::multiply(x, B));
+          },
+          m),
+      m);
+  var_value<sparse_t> A(s);
+  Eigen::Matrix<var, -1, -1> B_v = B;
+  var f = stan::math::sum(stan::math::multiply(A, B_v));
+  f.grad();
+  EXPECT_FLOAT_EQ((m * B).sum(), f.val());
+  EXPECT_MATRIX_FLOAT_EQ(A_grad, Eigen::MatrixXd(A.adj()));
+  EXPECT_MATRIX_FLOAT_EQ(m.transpose() * Eigen::MatrixXd::Ones(3, 2),
+                         B_v.adj());
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, 1> b_v = B.col(0);
+  var g = stan::math::sum(stan::math::multiply(s, b_v));
+  g.grad();
+  EXPECT_FLOAT_EQ((m * B.col(0)).sum(), g.val());
+  EXPECT_MATRIX_FLOAT_EQ(m.transpose() * Eigen::VectorXd::Ones(3), b_v.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSparse, transpose_multiply) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd m = sparse_test_matrix();
+  sparse_t s = m.sparseView();
+  Eigen::MatrixXd B(3, 2);
+  B << 1, -2, 0.5, 4, 3, 1;
+
+  Eigen::MatrixXd A_grad = on_pattern(
+      dense_grad(
+          [&](const auto& x) {
+            return stan::math::sum(
+                stan::math::multiply(stan::math::transpose(x), B));
+          },
+          m),
+      m);
+  var_value<sparse_t> A(s);
+  var_value<Eigen::MatrixXd> B_v = B;
+  var f = stan::math::sum(stan::math::transpose_multiply(A, B_v));
+  f.grad();
+  EXPECT_FLOAT_EQ((m.transpose() * B).sum(), f.val());
+  EXPECT_MATRIX_FLOAT_EQ(A_grad, Eigen::MatrixXd(A.adj()));
+  EXPECT_MATRIX_FLOAT_EQ(m * Eigen::MatrixXd::Ones(3, 2), B_v.adj());
+  stan::math::recover_memory();
+
+  EXPECT_THROW(stan::math::transpose_multiply(
+                   var_value<sparse_t>(s), Eigen::MatrixXd::Ones(2, 2)),
+               std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSparse, quad_form) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd m = sparse_test_matrix();
+  sparse_t s = m.sparseView();
+  Eigen::VectorXd b(3);
+  b << 1, -1, 2;
+
+  var_value<sparse_t> A(s);
+  Eigen::Matrix<var, -1, 1> b_v = b;
+  var f = stan::math::quad_form(A, b_v);
+  f.grad();
+  EXPECT_FLOAT_EQ(b.dot(m * b), f.val());
+  EXPECT_MATRIX_FLOAT_EQ(on_pattern(b * b.transpose(), m),
+                         Eigen::MatrixXd(A.adj()));
+  EXPECT_MATRIX_FLOAT_EQ((m + m.transpose()) * b, b_v.adj());
+  stan::math::recover_memory();
+
+  Eigen::MatrixXd B(3, 2);
+  B << 1, -2, 0.5, 4, 3, 1;
+  Eigen::Matrix<var, -1, -1> B_v = B;
+  Eigen::MatrixXd C = Eigen::MatrixXd::Random(2, 2);
+  var g = stan::math::sum(
+      stan::math::elt_multiply(stan::math::quad_form(s, B_v, true), C));
+  g.grad();
+  Eigen::MatrixXd res = B.transpose() * m * B;
+  EXPECT_FLOAT_EQ(
+      (0.5 * (res + res.transpose())).cwiseProduct(C).sum(), g.val());
+  Eigen::MatrixXd C_sym = 0.5 * (C + C.transpose());
+  EXPECT_MATRIX_FLOAT_EQ((m + m.transpose()) * B * C_sym, B_v.adj());
+  stan::math::recover_memory();
+
+  EXPECT_THROW(stan::math::quad_form(var_value<sparse_t>(s),
+                                     Eigen::VectorXd::Ones(2)),
+               std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSparse, add_elt_multiply) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd m = sparse_test_matrix();
+  Eigen::MatrixXd d = Eigen::MatrixXd::Zero(3, 3);
+  d(1, 1) = 2;
+  d(1, 2) = -1;
+  sparse_t s = m.sparseView();
+  sparse_t e = d.sparseView();
+  Eigen::VectorXd b(3);
+  b << 1, -1, 2;
+
+  var_value<sparse_t> A(s);
+  var_value<sparse_t> E(e);
+  var_value<sparse_t> sum_AE = A + E;
+  EXPECT_EQ(6, sum_AE.val().nonZeros());
+  EXPECT_MATRIX_FLOAT_EQ(m + d, Eigen::MatrixXd(sum_AE.val()));
+  var_value<sparse_t> prod_AE = stan::math::elt_multiply(A, E);
+  EXPECT_EQ(1, prod_AE.val().nonZeros());
+  var f = stan::math::sum(stan::math::multiply(sum_AE, b))
+          + stan::math::sum(stan::math::multiply(prod_AE, b))
+          + stan::math::sum(
+              stan::math::multiply(stan::math::add(e, A), b))
+          + stan::math::sum(
+              stan::math::multiply(stan::math::elt_multiply(s, A), b));
+  f.grad();
+  // d/dX sum(X b) is b' in every row
+  Eigen::MatrixXd row_b = Eigen::VectorXd::Ones(3) * b.transpose();
+  EXPECT_MATRIX_FLOAT_EQ(
+      on_pattern(2 * row_b + row_b.cwiseProduct(d) + row_b.cwiseProduct(m),
+                 m),
+      Eigen::MatrixXd(A.adj()));
+  EXPECT_MATRIX_FLOAT_EQ(on_pattern(row_b + row_b.cwiseProduct(m), d),
+                         Eigen::MatrixXd(E.adj()));
+  stan::math::recover_memory();
+
+  EXPECT_THROW(stan::math::add(var_value<sparse_t>(s),
+                               sparse_t(Eigen::MatrixXd::Ones(2, 2)
+                                            .sparseView())),
+               std::invalid_argument);
+  stan::math::recover_memory();
+}
+
+namespace {
+// precision matrix of a first order random walk on a ring
+Eigen::MatrixXd sparse_test_precision(int n) {
+  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    Q(i, i) = 2.5 + 0.1 * i;
+    Q(i, (i + 1) % n) = -1;
+    Q((i + 1) % n, i) = -1;
+  }
+  return Q;
+}
+}  // namespace
+
+TEST(AgradRevSparse, log_determinant_spd) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd Q = sparse_test_precision(9);
+  sparse_t Q_sparse = Q.sparseView();
+
+  var_value<sparse_t> Q_v(Q_sparse);
+  var lp = stan::math::log_determinant_spd(Q_v);
+  lp.grad();
+  EXPECT_FLOAT_EQ(std::log(Q.determinant()), lp.val());
+  // the selected inverse only fills in the pattern of Q
+  EXPECT_MATRIX_NEAR(on_pattern(Q.inverse(), Q), Eigen::MatrixXd(Q_v.adj()),
+                     1e-12);
+  stan::math::recover_memory();
+
+  EXPECT_FLOAT_EQ(0.0, stan::math::log_determinant_spd(
+                           var_value<sparse_t>(sparse_t(0, 0)))
+                           .val());
+  Q(0, 0) = -1;
+  EXPECT_THROW(
+      stan::math::log_determinant_spd(var_value<sparse_t>(Q.sparseView())),
+      std::domain_error);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSparse, mdivide_left_spd) {
+  using stan::math::var;
+  using stan::math::var_value;
+  Eigen::MatrixXd Q = sparse_test_precision(7);
+  sparse_t Q_sparse = Q.sparseView();
+  Eigen::MatrixXd B = Eigen::MatrixXd::Random(7, 2);
+  Eigen::MatrixXd W = Eigen::MatrixXd::Random(7, 2);
+  Eigen::MatrixXd x = Q.llt().solve(B);
+  Eigen::MatrixXd B_adj = Q.llt().solve(W);
+
+  var_value<sparse_t> Q_v(Q_sparse);
+  Eigen::Matrix<var, -1, -1> B_v = B;
+  var f = stan::math::sum(
+      stan::math::elt_multiply(stan::math::mdivide_left_spd(Q_v, B_v), W));
+  f.grad();
+  EXPECT_FLOAT_EQ(x.cwiseProduct(W).sum(), f.val());
+  EXPECT_MATRIX_NEAR(B_adj, B_v.adj(), 1e-12);
+  EXPECT_MATRIX_NEAR(on_pattern(-B_adj * x.transpose(), Q),
+                     Eigen::MatrixXd(Q_v.adj()), 1e-12);
+  stan::math::recover_memory();
+
+  var_value<sparse_t> Q_v2(Q_sparse);
+  var g = stan::math::sum(
+      stan::math::elt_multiply(stan::math::mdivide_left_spd(Q_v2, B), W));
+  g.grad();
+  EXPECT_MATRIX_NEAR(on_pattern(-B_adj * x.transpose(), Q),
+                     Eigen::MatrixXd(Q_v2.adj()), 1e-12);
+  stan::math::recover_memory();
+
+  var_value<Eigen::VectorXd> b_v = B.col(0);
+  var h = stan::math::dot_product(
+      stan::math::mdivide_left_spd(Q_sparse, b_v), W.col(0));
+  h.grad();
+  EXPECT_FLOAT_EQ(x.col(0).dot(W.col(0)), h.val());
+  EXPECT_MATRIX_NEAR(B_adj.col(0), b_v.adj(), 1e-12);
+  stan::math::recover_memory();
+}
@@ -5,6 +5,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
 
+#include <cstring>
 #include <stdexcept>
 #include <vector>
 #include <thread>
@@ -73,6 +74,16 @@ void test_hessian_finite_diff(const std::string& msg, const F& f,
   Eigen::MatrixXd hess_fx;
   stan::math::internal::finite_diff_hessian_auto(f, x, fx, grad_fx, hess_fx);
 
+  double fx_par;
+  Eigen::VectorXd grad_fx_par;
+  Eigen::MatrixXd hess_fx_par;
+  stan::math::internal::finite_diff_hessian_auto_parallel(
+      f, x, fx_par, grad_fx_par, hess_fx_par);
+  ASSERT_EQ(hess_fx.size(), hess_fx_par.size()) << msg;
+  EXPECT_EQ(0, std::memcmp(hess_fx.data(), hess_fx_par.data(),
+                           hess_fx.size() * sizeof(double)))
+      << msg;
+
   double fx_ad;
   Eigen::VectorXd grad_fx_ad;
   Eigen::MatrixXd hess_fx_ad;
@@ -0,0 +1,125 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <stdexcept>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using Eigen::VectorXd;
+
+// fun_chain(x) = sum_i exp(x_i) * x_{i+1}^2 + log1p(x_0^2)
+struct fun_chain {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    using stan::math::exp;
+    using stan::math::log1p;
+    T y = log1p(x(0) * x(0));
+    for (int i = 0; i + 1 < x.size(); ++i) {
+      y += exp(x(i)) * x(i + 1) * x(i + 1);
+    }
+    return y;
+  }
+};
+
+TEST(RevFunctor, gradient_evaluator) {
+  using stan::math::ChainableStack;
+  fun_chain f;
+  auto evaluator = stan::math::make_gradient_evaluator(f, 1 << 20);
+  const size_t var_stack_size = ChainableStack::instance_->var_stack_.size();
+  const size_t nochain_size
+      = ChainableStack::instance_->var_nochain_stack_.size();
+  for (int n : {5, 5, 3, 8, 8}) {
+    for (int k = 0; k < 3; ++k) {
+      VectorXd x = VectorXd::Random(n);
+      double fx;
+      VectorXd grad_fx;
+      stan::math::gradient(f, x, fx, grad_fx);
+      double fx_eval;
+      VectorXd grad_fx_eval;
+      evaluator(x, fx_eval, grad_fx_eval);
+      EXPECT_FLOAT_EQ(fx, fx_eval);
+      EXPECT_MATRIX_FLOAT_EQ(grad_fx, grad_fx_eval);
+    }
+  }
+  EXPECT_TRUE(stan::math::empty_nested());
+  EXPECT_EQ(var_stack_size, ChainableStack::instance_->var_stack_.size());
+  EXPECT_EQ(nochain_size, ChainableStack::instance_->var_nochain_stack_.size());
+}
+
+// first_input(x) = x_0, so the other inputs are never used
+struct first_input {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    return x(0);
+  }
+};
+
+TEST(RevFunctor, gradient_evaluator_resets_inputs) {
+  auto evaluator = stan::math::make_gradient_evaluator(first_input());
+  const size_t bytes
+      = stan::math::ChainableStack::instance_->memalloc_.bytes_allocated();
+  for (int k = 0; k < 3; ++k) {
+    VectorXd x = VectorXd::Random(4);
+    double fx;
+    VectorXd grad_fx;
+    evaluator(x, fx, grad_fx);
+    EXPECT_FLOAT_EQ(x(0), fx);
+    EXPECT_MATRIX_FLOAT_EQ(VectorXd::Unit(4, 0), grad_fx);
+  }
+  EXPECT_EQ(bytes,
+            stan::math::ChainableStack::instance_->memalloc_.bytes_allocated());
+}
+
+stan::math::var sum_and_throw_eval(
+    const Matrix<stan::math::var, Dynamic, 1>& x) {
+  stan::math::var y = 0;
+  for (int i = 0; i < x.size(); ++i)
+    y += x(i);
+  throw std::domain_error("fooey");
+  return y;
+}
+
+TEST(RevFunctor, gradient_evaluator_recover_memory) {
+  auto evaluator = stan::math::make_gradient_evaluator(sum_and_throw_eval);
+  VectorXd x(5);
+  x << 1, 2, 3, 4, 5;
+  double fx;
+  VectorXd grad_fx;
+  for (int i = 0; i < 100000; ++i) {
+    EXPECT_THROW(evaluator(x, fx, grad_fx), std::domain_error);
+  }
+  EXPECT_TRUE(stan::math::empty_nested());
+  EXPECT_LT(stan::math::ChainableStack::instance_->memalloc_.bytes_allocated(),
+            2000000);
+}
+
+#ifdef STAN_THREADS
+TEST(RevFunctor, gradient_evaluator_threaded_tbb) {
+  fun_chain f;
+  std::vector<VectorXd> x(100);
+  std::vector<VectorXd> grad_ref(100);
+  for (int i = 0; i < 100; ++i) {
+    x[i] = VectorXd::Random(6);
+    double fx;
+    stan::math::gradient(f, x[i], fx, grad_ref[i]);
+  }
+
+  std::vector<VectorXd> grad_eval(100);
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, 100, 10),
+                    [&](const tbb::blocked_range<size_t>& r) {
+                      auto evaluator = stan::math::make_gradient_evaluator(f);
+                      for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                        double fx;
+                        evaluator(x[i], fx, grad_eval[i]);
+                      }
+                    });
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_MATRIX_FLOAT_EQ(grad_ref[i], grad_eval[i]);
+  }
+}
+#endif
@@ -0,0 +1,97 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+#include <stdexcept>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// y_i = x_i * x_{i+1}, y_{n-1+i} = exp(x_i) / x_{n-1}
+struct vjp_fun {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    using stan::math::exp;
+    const int n = x.size();
+    Matrix<T, Dynamic, 1> y(2 * n - 1);
+    for (int i = 0; i < n - 1; ++i) {
+      y(i) = x(i) * x(i + 1);
+    }
+    for (int i = 0; i < n; ++i) {
+      y(n - 1 + i) = exp(x(i)) / x(n - 1);
+    }
+    return y;
+  }
+};
+
+TEST(RevFunctor, vjp) {
+  vjp_fun f;
+  Matrix<double, Dynamic, 1> x(5);
+  x << 0.5, -1.2, 0.3, 2, 1.1;
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian(f, x, fx, J);
+
+  Matrix<double, Dynamic, 1> u(9);
+  u << 1, -2, 0.5, 0, 3, 0.25, -1, 2, 0.1;
+  Matrix<double, Dynamic, 1> fx_vjp;
+  Matrix<double, Dynamic, 1> uJ;
+  stan::math::vjp(f, x, u, fx_vjp, uJ);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_vjp);
+  Matrix<double, Dynamic, 1> uJ_expected = J.transpose() * u;
+  EXPECT_MATRIX_FLOAT_EQ(uJ_expected, uJ);
+
+  Matrix<double, Dynamic, Dynamic> U(3, 9);
+  U.setRandom();
+  Matrix<double, Dynamic, Dynamic> UJ;
+  stan::math::vjp(f, x, U, fx_vjp, UJ);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_vjp);
+  Matrix<double, Dynamic, Dynamic> UJ_expected = U * J;
+  EXPECT_MATRIX_FLOAT_EQ(UJ_expected, UJ);
+
+  EXPECT_TRUE(stan::math::empty_nested());
+
+  Matrix<double, Dynamic, 1> u_bad(4);
+  EXPECT_THROW(stan::math::vjp(f, x, u_bad, fx_vjp, uJ),
+               std::invalid_argument);
+  Matrix<double, Dynamic, Dynamic> U_bad(2, 4);
+  EXPECT_THROW(stan::math::vjp(f, x, U_bad, fx_vjp, UJ),
+               std::invalid_argument);
+}
+
+// returns x_0 twice, and x_1 itself
+struct vjp_repeated_fun {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    Matrix<T, Dynamic, 1> y(4);
+    y << x(0), x(0), x(1), x(0) * x(1);
+    return y;
+  }
+};
+
+TEST(RevFunctor, vjp_repeated_outputs) {
+  vjp_repeated_fun f;
+  Matrix<double, Dynamic, 1> x(2);
+  x << 1.5, -0.5;
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian(f, x, fx, J);
+
+  Matrix<double, Dynamic, 1> u(4);
+  u << 2, 3, -1, 0.5;
+  Matrix<double, Dynamic, 1> fx_vjp;
+  Matrix<double, Dynamic, 1> uJ;
+  stan::math::vjp(f, x, u, fx_vjp, uJ);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_vjp);
+  Matrix<double, Dynamic, 1> uJ_expected = J.transpose() * u;
+  EXPECT_MATRIX_FLOAT_EQ(uJ_expected, uJ);
+  EXPECT_FLOAT_EQ(2 + 3 + 0.5 * -0.5, uJ(0));
+
+  Matrix<double, Dynamic, Dynamic> U(2, 4);
+  U << 2, 3, -1, 0.5, 1, -1, 4, 2;
+  Matrix<double, Dynamic, Dynamic> UJ;
+  stan::math::vjp(f, x, U, fx_vjp, UJ);
+  Matrix<double, Dynamic, Dynamic> UJ_expected = U * J;
+  EXPECT_MATRIX_FLOAT_EQ(UJ_expected, UJ);
+}
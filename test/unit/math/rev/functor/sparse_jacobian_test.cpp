@@ -0,0 +1,66 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/util.hpp>
+#include <stdexcept>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// banded: y_i = x_i^2 * x_{i+1} + exp(x_{i+2}), y_{n-1} = sum(x)
+struct banded_fun {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    using std::exp;
+    const int n = x.size();
+    Matrix<T, Dynamic, 1> y(n);
+    for (int i = 0; i + 2 < n; ++i) {
+      y(i) = x(i) * x(i) * x(i + 1) + exp(x(i + 2));
+    }
+    y(n - 2) = x(n - 2) * x(n - 1);
+    y(n - 1) = stan::math::sum(x);
+    return y;
+  }
+};
+
+TEST(RevFunctor, sparse_jacobian) {
+  banded_fun f;
+  Matrix<double, Dynamic, 1> x(8);
+  x << 0.5, -1.2, 0.3, 2.1, -0.7, 1.1, 0.2, 1.5;
+
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian(f, x, fx, J);
+
+  Eigen::SparseMatrix<double> pattern = stan::math::jacobian_sparsity(f, x);
+  EXPECT_EQ(8, pattern.rows());
+  EXPECT_EQ(8, pattern.cols());
+  EXPECT_EQ(3 * 6 + 2 + 8, pattern.nonZeros());
+
+  Matrix<double, Dynamic, 1> fx_sparse;
+  Eigen::SparseMatrix<double> J_sparse;
+  stan::math::sparse_jacobian(f, x, pattern, fx_sparse, J_sparse);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_sparse);
+  EXPECT_EQ(pattern.nonZeros(), J_sparse.nonZeros());
+  EXPECT_MATRIX_FLOAT_EQ(J, J_sparse.toDense());
+
+  // the pattern can be reused at other arguments
+  x << 1.5, 0.2, -0.3, 0.1, 0.7, -1.1, 0.4, 0.5;
+  stan::math::jacobian(f, x, fx, J);
+  stan::math::sparse_jacobian(f, x, pattern, fx_sparse, J_sparse);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx_sparse);
+  EXPECT_MATRIX_FLOAT_EQ(J, J_sparse.toDense());
+}
+
+TEST(RevFunctor, sparse_jacobian_pattern_size) {
+  banded_fun f;
+  Matrix<double, Dynamic, 1> x = Matrix<double, Dynamic, 1>::Ones(4);
+  Matrix<double, Dynamic, 1> fx;
+  Eigen::SparseMatrix<double> J;
+  Eigen::SparseMatrix<double> pattern(3, 4);
+  EXPECT_THROW(stan::math::sparse_jacobian(f, x, pattern, fx, J),
+               std::invalid_argument);
+  Eigen::SparseMatrix<double> pattern2(4, 3);
+  EXPECT_THROW(stan::math::sparse_jacobian(f, x, pattern2, fx, J),
+               std::invalid_argument);
+}
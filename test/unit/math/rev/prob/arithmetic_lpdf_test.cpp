@@ -0,0 +1,139 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// The overloads for arithmetic arguments must match the general ones,
+// which are used for var arguments, in value and in the errors thrown.
+
+namespace {
+
+template <typename F>
+std::string error_message(const F& f) {
+  try {
+    f();
+  } catch (const std::domain_error& e) {
+    return e.what();
+  }
+  return "";
+}
+
+// with propto, the var overload keeps the terms that depend on the
+// var argument, while the arithmetic overload drops all of them
+template <typename F>
+void expect_matches_var(const F& f, bool propto) {
+  using stan::math::var;
+  std::string msg = error_message([&]() { f(0.0); });
+  std::string msg_var = error_message([&]() { f(var(0.0)); });
+  EXPECT_EQ(msg_var, msg);
+  if (msg.empty()) {
+    EXPECT_FLOAT_EQ(propto ? 0 : f(var(0.0)).val(), f(0.0));
+  }
+  stan::math::recover_memory();
+}
+
+}  // namespace
+
+TEST(ProbArithmetic, normal_lpdf) {
+  Eigen::VectorXd y(4);
+  y << -1.2, 0.3, 2.5, 0.0;
+  std::vector<double> mu{0.1, -0.4, 1.9, 0.0};
+  Eigen::VectorXd sigma(4);
+  sigma << 0.5, 1.7, 2.0, 1.0;
+  Eigen::VectorXd sigma_bad = sigma;
+  sigma_bad(2) = -1;
+  for (bool propto : {false, true}) {
+    auto lpdf = [&](const auto& a, const auto& b, const auto& c) {
+      return propto ? stan::math::normal_lpdf<true>(a, b, c)
+                    : stan::math::normal_lpdf<false>(a, b, c);
+    };
+    expect_matches_var(
+        [&](auto z) { return lpdf(y, mu, sigma.array() + z); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(y, 0.3 + z, 1.5); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(0.7, mu, 1.5 + z); }, propto);
+    expect_matches_var(
+        [&](auto z) { return lpdf(y, mu, sigma_bad.array() + z); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(y, mu, -1 + z); }, propto);
+    expect_matches_var(
+        [&](auto z) {
+          return lpdf(y, std::numeric_limits<double>::infinity() + z, 1.5);
+        },
+        propto);
+    expect_matches_var(
+        [&](auto z) {
+          return lpdf(std::vector<double>{}, mu[0] + z, -1);
+        },
+        propto);
+  }
+  EXPECT_FLOAT_EQ(stan::math::normal_lpdf(y, mu, sigma),
+                  stan::math::normal_lpdf(y, mu, 2 * sigma - sigma));
+  EXPECT_FLOAT_EQ(-0.5 - std::log(std::sqrt(2 * stan::math::pi())),
+                  stan::math::normal_lpdf(1, 0, 1));
+}
+
+TEST(ProbArithmetic, lognormal_lpdf) {
+  std::vector<double> y{1.2, 0.3, 2.5, 4.0};
+  Eigen::VectorXd mu(4);
+  mu << 0.1, -0.4, 1.9, 0.0;
+  std::vector<double> y_zero{1.2, 0.0};
+  for (bool propto : {false, true}) {
+    auto lpdf = [&](const auto& a, const auto& b, const auto& c) {
+      return propto ? stan::math::lognormal_lpdf<true>(a, b, c)
+                    : stan::math::lognormal_lpdf<false>(a, b, c);
+    };
+    expect_matches_var([&](auto z) { return lpdf(y, mu, 0.5 + z); }, propto);
+    expect_matches_var(
+        [&](auto z) { return lpdf(1.3, mu.array() + z, 2); }, propto);
+    expect_matches_var(
+        [&](auto z) { return lpdf(y_zero, 0.4 + z, 2); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(y, mu, 0 + z); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(-1.0, mu, 1 + z); }, propto);
+  }
+}
+
+TEST(ProbArithmetic, exponential_lpdf) {
+  Eigen::VectorXd y(3);
+  y << 1.2, 0.0, 2.5;
+  std::vector<double> beta{0.5, 1.5, 3.0};
+  for (bool propto : {false, true}) {
+    auto lpdf = [&](const auto& a, const auto& b) {
+      return propto ? stan::math::exponential_lpdf<true>(a, b)
+                    : stan::math::exponential_lpdf<false>(a, b);
+    };
+    expect_matches_var(
+        [&](auto z) { return lpdf(y.array() + z, beta); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(y, 2.1 + z); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(0.7 + z, beta); }, propto);
+    expect_matches_var([&](auto z) { return lpdf(y, -2.1 + z); }, propto);
+    expect_matches_var(
+        [&](auto z) { return lpdf(-y.array() + z, 1.0); }, propto);
+  }
+}
+
+TEST(ProbArithmetic, poisson_lpmf) {
+  std::vector<int> n{0, 3, 1, 7};
+  Eigen::VectorXd lambda(4);
+  lambda << 0.5, 3.1, 0.0, 6.0;
+  std::vector<int> n_bad{0, -1};
+  for (bool propto : {false, true}) {
+    auto lpmf = [&](const auto& a, const auto& b) {
+      return propto ? stan::math::poisson_lpmf<true>(a, b)
+                    : stan::math::poisson_lpmf<false>(a, b);
+    };
+    expect_matches_var(
+        [&](auto z) { return lpmf(n, lambda.array() + z); }, propto);
+    expect_matches_var([&](auto z) { return lpmf(n, 2.5 + z); }, propto);
+    expect_matches_var(
+        [&](auto z) { return lpmf(4, lambda.array() + 1 + z); }, propto);
+    expect_matches_var([&](auto z) { return lpmf(n, 0 + z); }, propto);
+    expect_matches_var(
+        [&](auto z) {
+          return lpmf(n, std::numeric_limits<double>::infinity() + z);
+        },
+        propto);
+    expect_matches_var([&](auto z) { return lpmf(n_bad, 1 + z); }, propto);
+    expect_matches_var([&](auto z) { return lpmf(n, -1 + z); }, propto);
+  }
+}
@@ -6,6 +6,7 @@
 #include <test/unit/math/prim/prob/agrad_distributions_multi_normal_multi_row.hpp>
 #include <test/unit/math/prim/prob/agrad_distributions_multi_normal.hpp>
 #include <test/unit/math/util.hpp>
+#include <test/unit/util.hpp>
 #include <vector>
 #include <string>
 
@@ -477,3 +478,45 @@ TEST(ProbDistributionsMultiNormal, TestGradFunctionalVectorized) {
 
   stan::math::recover_memory();
 }
+
+TEST(ProbDistributionsMultiNormal, matchesCholeskyPath) {
+  using stan::math::var;
+  Eigen::MatrixXd Sigma(3, 3);
+  Sigma << 9.0, -3.0, 0.5, -3.0, 4.0, 1.0, 0.5, 1.0, 5.0;
+  std::vector<Eigen::VectorXd> y(2, Eigen::VectorXd(3));
+  y[0] << 2.0, -2.0, 11.0;
+  y[1] << -1.0, 0.5, 3.0;
+  Eigen::VectorXd mu(3);
+  mu << 1.0, -1.0, 3.0;
+
+  Eigen::Matrix<var, -1, -1> Sigma_v = Sigma;
+  Eigen::Matrix<var, -1, 1> mu_v = mu;
+  var lp = stan::math::multi_normal_lpdf(y, mu_v, Sigma_v);
+  lp.grad();
+  double lp_val = lp.val();
+  Eigen::MatrixXd Sigma_adj = Sigma_v.adj();
+  Eigen::VectorXd mu_adj = mu_v.adj();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, -1> Sigma_chol_v = Sigma;
+  Eigen::Matrix<var, -1, 1> mu_chol_v = mu;
+  var lp_chol = stan::math::multi_normal_cholesky_lpdf(
+      y, mu_chol_v, stan::math::cholesky_decompose(Sigma_chol_v));
+  lp_chol.grad();
+  EXPECT_FLOAT_EQ(lp_chol.val(), lp_val);
+  EXPECT_MATRIX_NEAR(mu_chol_v.adj(), mu_adj, 1e-10);
+  // the Cholesky path only sees the lower triangle, symmetrize to compare
+  Eigen::MatrixXd Sigma_chol_adj = Sigma_chol_v.adj();
+  Sigma_chol_adj = 0.5 * (Sigma_chol_adj + Sigma_chol_adj.transpose()).eval();
+  EXPECT_MATRIX_NEAR(Sigma_chol_adj, Sigma_adj, 1e-10);
+
+  // 0.5 * sum_i (Sigma^-1 r_i r_i' Sigma^-1 - Sigma^-1)
+  Eigen::MatrixXd Sigma_inv = Sigma.inverse();
+  Eigen::MatrixXd expected = -Sigma_inv;
+  for (const auto& y_i : y) {
+    Eigen::VectorXd alpha = Sigma_inv * (y_i - mu);
+    expected += 0.5 * alpha * alpha.transpose();
+  }
+  EXPECT_MATRIX_NEAR(expected, Sigma_adj, 1e-10);
+  stan::math::recover_memory();
+}